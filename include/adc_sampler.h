@@ -0,0 +1,85 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Acquisition ADC sous interruption
+// ════════════════════════════════════════════════════════════════
+// Fichier: adc_sampler.h
+// Description: ADC en conversion continue (free-running), canaux
+//              potentiomètres Az/El alternés dans l'ISR, suréchantil-
+//              lonnage et décimation, résultat en double buffer
+// ════════════════════════════════════════════════════════════════
+// analogRead() bloque ~112 µs par appel (13 cycles ADC à 125 kHz).
+// Ici l'ADC convertit en continu; l'ISR ADC_vect accumule 4^n
+// conversions d'un canal (n = ADC_OVERSAMPLE_BITS), publie la somme
+// décalée de n bits puis passe au canal suivant. updateEncoders() ne
+// fait que lire la dernière valeur publiée.
+//
+// Résolution: 10 + n bits. Le bruit ADC (≥ 1 LSB sur les pots)
+// joue le rôle de dither, la moyenne de 4^n conversions gagne n bits.
+//
+// Cadence (prescaler 128, ~9600 conversions/s):
+//   n = 2 → 16 conversions + 1 jetée par changement de canal
+//   → ~280 résultats/s par canal avec deux pots, ~190 avec en plus
+//     la tension d'alimentation (ENABLE_POWER_MONITOR), ~110 avec en
+//     plus les courants des deux moteurs DC
+//
+// Double buffer: l'ISR écrit la case inactive puis bascule l'index;
+// la lecture d'une valeur 16 bits n'est jamais coupée par l'ISR.
+//
+// Hors AVR (HAL native): lecture analogRead() décalée de n bits.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define ADC_CH_AZ      0
+#define ADC_CH_EL      1
+#define ADC_CH_SUPPLY  2    // Pont diviseur alimentation (power_monitor.h)
+#define ADC_CH_CURRENT_AZ  3  // Courant moteur DC Az, sortie FB MC33926 (motor_dc.h)
+#define ADC_CH_CURRENT_EL  4  // Courant moteur DC El
+#define ADC_CHANNELS   5
+
+// Axes lus par potentiomètre (canaux échantillonnés)
+#define ADC_POT_AZ ((ENCODER_AZ_TYPE == ENCODER_POT_1T) || (ENCODER_AZ_TYPE == ENCODER_POT_MT))
+#define ADC_POT_EL ((ENCODER_EL_TYPE == ENCODER_POT_1T) || (ENCODER_EL_TYPE == ENCODER_POT_MT))
+#define ADC_SUPPLY (ENABLE_POWER_MONITOR)
+#define ADC_CURRENT_AZ (MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED)
+#define ADC_CURRENT_EL (MOTOR_EL_TYPE == MOTOR_DC_BRUSHED)
+
+// Bits fractionnaires des lectures potentiomètre (unités "fines")
+#if ENABLE_ADC_SAMPLER
+  #if ADC_OVERSAMPLE_BITS > 3
+    #error "ADC_OVERSAMPLE_BITS > 3: somme de 4^n conversions hors uint16_t"
+  #endif
+  #define POT_FINE_BITS  ADC_OVERSAMPLE_BITS
+#else
+  #define POT_FINE_BITS  0
+#endif
+
+#define POT_FINE_MAX  ((1024 << POT_FINE_BITS) - 1)
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Démarrage conversion continue (appelé par setupEncoders)
+ * Attend le premier résultat de chaque canal (~4 ms)
+ */
+void setupAdcSampler();
+
+/**
+ * Dernier résultat décimé d'un canal (non bloquant)
+ *
+ * @param ch ADC_CH_AZ, ADC_CH_EL, ADC_CH_SUPPLY ou ADC_CH_CURRENT_xx
+ * @return 0 à POT_FINE_MAX (10 + POT_FINE_BITS bits, sens brut)
+ */
+uint16_t adcSamplerRead(uint8_t ch);
+
+/**
+ * Nombre de résultats publiés pour un canal (diagnostic cadence)
+ */
+unsigned long adcSamplerCount(uint8_t ch);
+
+#endif // ADC_SAMPLER_H
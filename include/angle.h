@@ -0,0 +1,64 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Angles en virgule fixe
+// ════════════════════════════════════════════════════════════════
+// Fichier: angle.h
+// Description: Type angle_t (millidegrés, int32_t), conversions
+//              compteurs → angle et bord protocole (float)
+// ════════════════════════════════════════════════════════════════
+// L'ATmega2560 n'a pas d'unité flottante: chaque addition float
+// coûte ~100 cycles, une multiplication ~150, une division ~500.
+// La position circule donc en millidegrés entiers depuis les
+// compteurs ADC/SSI jusqu'au formatage Easycom/Nextion:
+//
+//   compteurs → tables / échelle Q16 → filtre → erreur → dixièmes
+//
+// Plage: ±2147483° (largement au-delà des butées mécaniques).
+// Résolution 0.001°, dix fois meilleure que le pas ADC (~0.02°).
+//
+// Le float reste au bord protocole: consignes Easycom (atof),
+// réglages utilisateur, et le miroir currentAz/currentEl lu par
+// les modules hors chemin critique (motor_stepper, debug).
+// ════════════════════════════════════════════════════════════════
+
+#ifndef ANGLE_H
+#define ANGLE_H
+
+#include <Arduino.h>
+
+typedef int32_t angle_t;            // Millidegrés
+
+#define ANGLE_PER_DEG     1000L
+
+/**
+ * Constante de configuration en degrés → angle_t
+ * Argument constant: évalué à la compilation, aucun float embarqué
+ */
+#define ANGLE_DEG(deg)    ((angle_t)((deg) * 1000.0 + ((deg) >= 0 ? 0.5 : -0.5)))
+
+/**
+ * Facteur d'échelle Q16 (millidegrés par unité de compteur)
+ * Ex: ANGLE_SCALE_Q16(360000.0 / 4096.0) pour un encodeur 12 bits
+ */
+#define ANGLE_SCALE_Q16(mdegPerUnit)  ((long)((mdegPerUnit) * 65536.0 + 0.5))
+
+/**
+ * Compteur → angle: produit 32×32 → 64 bits puis décalage
+ * (__mulsidi3 sur AVR, sans flottant)
+ */
+inline angle_t angleScale(long units, long scaleQ16) {
+    return (angle_t)(((int64_t)units * scaleQ16) >> 16);
+}
+
+// ════════════════════════════════════════════════════════════════
+// BORD PROTOCOLE (float)
+// ════════════════════════════════════════════════════════════════
+
+inline angle_t angleFromDegrees(float deg) {
+    return (angle_t)lround((double)deg * 1000.0);
+}
+
+inline float angleToDegrees(angle_t angle) {
+    return (float)angle * 0.001f;
+}
+
+#endif // ANGLE_H
@@ -60,6 +60,13 @@
 #define NANO_STATUS_PIN     22
 #define NANO_TIMEOUT_MS     2000  // Timeout 2 secondes sans réponse = communication perdue
 
+// Protocole binaire Mega ↔ Nano (voir motor_nano.h)
+// Trames 5 octets avec numéro de séquence et CRC-8, négociées au
+// démarrage ("BIN?" → "BIN:OK"). Nano sans support → protocole texte.
+#define NANO_BINARY_PROTOCOL 1    // 1=négocier trames binaires, 0=texte seul
+#define NANO_ACK_TIMEOUT_MS  50   // ACK attendu en < 50 ms (aller-retour ~1 ms)
+#define NANO_MAX_MISSED_ACKS 3    // ACK perdus consécutifs = communication perdue
+
 // ════════════════════════════════════════════════════════════════
 // PINS ENCODEURS SSI (Synchronous Serial Interface)
 // ════════════════════════════════════════════════════════════════
@@ -75,6 +82,12 @@
 #define SSI_CS_EL     A1   // Chip Select élévation
 #define SSI_DATA_EL   A3   // Data élévation
 
+// Trame SSI: 12 bits position + 6 bits état (OCF, COF, LIN, MagINC, MagDEC, parité)
+// Les deux encodeurs sont cadencés par la même rafale CLK (accès direct ports)
+#define SSI_FRAME_BITS       18   // Impulsions CLK par lecture
+#define SSI_HALF_PERIOD_US   1    // Demi-période CLK (µs) → ~500 kHz, HH-12 max 1 MHz
+#define SSI_MAX_RETRIES      2    // Relectures d'une trame invalide (parité/état) avant rejet
+
 // ════════════════════════════════════════════════════════════════
 // PINS POTENTIOMÈTRE ANALOGIQUE (Simple 1 tour OU multi-tours)
 // ════════════════════════════════════════════════════════════════
@@ -203,9 +216,25 @@
 // Filtrage ADC (moyenne glissante pour stabiliser affichage)
 // Plus le nombre d'échantillons est élevé, plus le filtrage est fort
 // mais plus la réponse est lente
+// Puissance de 2 obligatoire (RunningAverage: moyenne par décalage)
 #define POT_SAMPLES_AZ      16     // Nombre d'échantillons azimuth (plus filtré)
 #define POT_SAMPLES_EL       8     // Nombre d'échantillons élévation (4-16 typique)
 
+// Acquisition ADC sous interruption (adc_sampler.cpp)
+// ADC en conversion continue, canaux pots alternés dans l'ISR:
+// loop() lit le dernier résultat au lieu d'attendre ~112 µs par analogRead()
+// Suréchantillonnage 4^n conversions par résultat → n bits de plus (bruit ≥ 1 LSB)
+#define ENABLE_ADC_SAMPLER   1     // 1=ISR ADC continue, 0=analogRead() bloquant
+#define ADC_OVERSAMPLE_BITS  2     // 2 → 16 conversions, résultat 12 bits (0-4095), max 3
+
+// Estimateur position/vitesse pots multi-tours (position_estimator.h)
+// Filtre alpha-beta à la place de l'EMA fixe 0.10 (~180 ms de retard en mouvement)
+// Moteur commandé: suivi position + vitesse; arrêté: lissage seul
+#define ESTIMATOR_ALPHA_MOVING  0.25  // Gain position, moteur commandé (0-1)
+#define ESTIMATOR_BETA_MOVING   0.035 // Gain vitesse, moteur commandé (α²/(2-α): amortissement critique)
+#define ESTIMATOR_ALPHA_HOLD    0.10  // Gain position, moteur arrêté (ancienne EMA)
+#define ESTIMATOR_JUMP_DEG      2.0   // Écart mesure/prédiction → réinitialisation (°)
+
 // ════════════════════════════════════════════════════════════════
 // VITESSES MOTEURS PAS-À-PAS (Délais en microsecondes)
 // ════════════════════════════════════════════════════════════════
@@ -216,6 +245,24 @@
 #define SPEED_FAST    50     // Vitesse rapide (µs par phase) - Loin de cible (>3°)
 #define SPEED_SLOW    200    // Vitesse lente (µs par phase) - Approche finale précise (<3°)
 
+// Générateur d'impulsions STEP en arrière-plan (mode direct, sans Nano):
+// Timer1 (Az) et Timer3 (El) en mode CTC, l'ISR de comparaison bascule
+// la broche STEP toutes les SPEED_xxx µs. loop() ne fixe plus que la
+// vitesse et le sens (step_generator.h). Sans lui, rafales de 10 pas
+// en delayMicroseconds: loop() bloquée 1 à 4 ms par axe.
+#define ENABLE_STEP_TIMER    1     // 1=ISR Timer1/Timer3, 0=rafales bloquantes
+
+// Rampe d'accélération (générateur STEP uniquement): la vitesse
+// transmise au générateur varie d'au plus STEPPER_ACCEL_DPS2 et le
+// freinage commence à la distance v²/2a de la cible. SPEED_FAST /
+// SPEED_SLOW deviennent les paliers. Départ arrêté directement à
+// STEPPER_START_DPS (zone start-stop du NEMA23 chargé).
+// Sans rampe: saut instantané 0 ↔ SPEED_FAST (décrochage à l'inertie
+// d'une parabole de 3 m).
+#define ENABLE_STEPPER_RAMP  1     // 1=profil trapézoïdal, 0=paliers instantanés
+#define STEPPER_ACCEL_DPS2   3.0   // Accélération max antenne (°/s²)
+#define STEPPER_START_DPS    0.25  // Vitesse de départ sans rampe (°/s antenne)
+
 // ════════════════════════════════════════════════════════════════
 // PARAMÈTRES ASSERVISSEMENT POSITION
 // ════════════════════════════════════════════════════════════════
@@ -225,6 +272,66 @@
 #define POSITION_RESTART       0.50  // Hystérésis redémarrage (0.50°) - évite micro-pas
 #define SPEED_SWITCH_THRESHOLD 3.0   // Erreur pour switch vitesse rapide→lente (3.0°)
 
+// ─────────────────────────────────────────────────────────────────
+// MOUVEMENT COORDONNÉ (motion_planner.h)
+// ─────────────────────────────────────────────────────────────────
+// Ralliement sur consigne fixe: palier et accélération de l'axe le
+// plus court réduits dans le rapport des durées → arrivée simultanée,
+// trajet en ligne droite dans le plan Az/El (plus de "L" en diagonale).
+// Commande en vitesse Nano et rampe pas-à-pas direct.
+
+#define ENABLE_COORDINATED_MOVE  1   // 1=axes coordonnés, 0=axes indépendants
+
+// ─────────────────────────────────────────────────────────────────
+// FUSION PAS / ENCODEUR (step_fusion.h, pots multi-tours)
+// ─────────────────────────────────────────────────────────────────
+// Position = pas commandés (générateur STEP, ou vitesses VEL intégrées
+// côté Nano) + décalage recalé sur le pot à vitesse constante. Sans
+// bruit pot, la bande morte passe de 0.15° / 0.50° à FUSION_TOLERANCE
+// / FUSION_RESTART.
+
+#define ENABLE_STEP_FUSION    1     // 1=pas + correction encodeur, 0=encodeur seul
+#define FUSION_SETTLE_MS      1000  // Attente à vitesse constante avant correction (retard filtre pot)
+#define FUSION_AVERAGE_MS     1000  // Moyenne du résidu à l'arrêt avant recalage
+#define FUSION_TAU_MS         4000  // Constante de temps du recalage en palier
+#define FUSION_RESYNC_DEG     0.5   // Écart à l'arrêt → recalage immédiat (pas perdus)
+#define FUSION_TOLERANCE      0.02  // Arrêt sous cette erreur (position sur les pas)
+#define FUSION_RESTART        0.05  // Reprise au-delà de cette erreur
+
+// ─────────────────────────────────────────────────────────────────
+// COMMANDE EN VITESSE (Nano en protocole binaire uniquement)
+// ─────────────────────────────────────────────────────────────────
+// Au lieu de direction + speedMode, le Mega envoie une vitesse continue
+// (steps/s) calculée toutes les 20 ms:
+//   vitesse = vitesse cible + VEL_KP × erreur
+//   bornée à ±VEL_MAX_DPS, variation limitée à VEL_ACCEL_DPS2
+//   (profil trapézoïdal: rampe, palier, approche proportionnelle)
+// Nano texte seul → ancien mode direction + speedMode
+
+#define NANO_VELOCITY_CONTROL  1     // 1=vitesse continue, 0=direction + speedMode
+#define MOTOR_GEAR_RATIO_AZ    100.0 // Tours moteur pour 1 tour antenne Az (réducteur, à mesurer)
+#define MOTOR_GEAR_RATIO_EL    100.0 // Tours moteur pour 1 tour antenne El (réducteur, à mesurer)
+#define VEL_KP                 1.0   // Gain proportionnel (°/s par degré d'erreur)
+#define VEL_MAX_DPS            1.5   // Vitesse max antenne (°/s), ancien mode RAPIDE
+#define VEL_ACCEL_DPS2         3.0   // Accélération max de la consigne (°/s²)
+#define VEL_DEADBAND           0.05  // Arrêt sous cette erreur (consigne fixe)
+#define VEL_RESTART            0.15  // Reprise au-delà de cette erreur (consigne fixe)
+
+// ─────────────────────────────────────────────────────────────────
+// PRÉDICTEUR DE TRAJECTOIRE (trajectory.h)
+// ─────────────────────────────────────────────────────────────────
+// Vitesse estimée sur les dernières consignes PstRotator: cible
+// interpolée entre deux consignes + anticipation en vitesse.
+// Commande "TRK" → erreur de poursuite mesurée (RMS / max)
+
+#define ENABLE_TRAJECTORY      1       // 1=cible interpolée, 0=consigne fixe
+#define TRAJ_HISTORY           12      // Consignes mémorisées par axe
+#define TRAJ_WINDOW_MS         120000  // Fenêtre d'estimation (consignes plus anciennes oubliées)
+#define TRAJ_MIN_SAMPLES       3       // Consignes minimum pour estimer une vitesse
+#define TRAJ_TIMEOUT_MS        15000   // Sans consigne → retour consigne fixe
+#define TRAJ_JUMP_DEG          1.0     // Écart à la prédiction = nouveau ralliement
+#define TRAJ_MAX_RATE_DPS      0.05    // Vitesse max crédible (lune ~0.004°/s)
+
 // ════════════════════════════════════════════════════════════════
 // MOUVEMENT MANUEL (Boutons locaux)
 // ════════════════════════════════════════════════════════════════
@@ -275,17 +382,72 @@
 // Port Easycom (standard ham radio tracking)
 #define EASYCOM_PORT  4533  // Port TCP pour PstRotator
 
+// Sessions Easycom simultanées (PstRotator, script de log, 2e poste...)
+// W5500: 8 sockets dont 1 réservé à l'écoute → 7 sessions maximum
+// RAM: ~110 octets par session (buffer ligne + anneau réception)
+#define EASYCOM_MAX_CLIENTS  4
+
+// ─────────────────────────────────────────────────────────────────
+// TÉLÉMÉTRIE PUSH (telemetry.h) - moniteurs abonnés, sans polling
+// ─────────────────────────────────────────────────────────────────
+// Trame JSON position/cible/état envoyée sur changement ≥ seuil,
+// au plus toutes les TELEMETRY_PERIOD_MS, heartbeat sinon.
+// Sockets: EASYCOM_MAX_CLIENTS + TELEMETRY_MAX_CLIENTS + 2 écoutes ≤ 8
+
+#define ENABLE_TELEMETRY        1     // Port télémétrie (1=ON, 0=OFF), USE_ETHERNET=1 requis
+#define TELEMETRY_PORT          5000  // Port TCP abonnés
+#define TELEMETRY_MAX_CLIENTS   2     // Abonnés simultanés
+#define TELEMETRY_PERIOD_MS     100   // Intervalle minimum entre trames (10 Hz max)
+#define TELEMETRY_HEARTBEAT_MS  1000  // Trame même sans changement
+#define TELEMETRY_THRESHOLD     0.1   // Changement minimum (°) pour émettre
+                                      // 0.0 = émission à chaque période
+
 // ════════════════════════════════════════════════════════════════
 // ADRESSES EEPROM (Sauvegarde calibration)
 // ════════════════════════════════════════════════════════════════
 // EEPROM ATmega2560 = 4096 bytes
 // Structure: [turnsAz(4)][offsetAz(4)][offsetEl(4)][...réservé]
 
-#define EEPROM_TURNS_AZ    0   // Nombre de tours azimuth (long, 4 bytes)
-#define EEPROM_TURNS_EL    4   // Nombre de tours élévation (long, 4 bytes)
+#define EEPROM_TURNS_AZ    0   // Ancien emplacement tours/ADC cumulé Az (long, 4 bytes)
+#define EEPROM_TURNS_EL    4   // Ancien emplacement tours/ADC cumulé El (long, 4 bytes)
+                               // Lus une seule fois si le journal est vierge (migration)
 #define EEPROM_OFFSET_AZ   8   // Offset calibration azimuth (long, 4 bytes)
 #define EEPROM_OFFSET_EL   16  // Offset calibration élévation (long, 4 bytes)
 
+// ────────────────────────────────────────────────────────────────
+// JOURNAL POSITION ACCUMULÉE (voir position_journal.h)
+// ────────────────────────────────────────────────────────────────
+// Tours (SSI) ou ADC cumulé (POT_MT) Az/El, enregistrés dans la case
+// suivante d'un anneau: usure répartie sur toutes les cases.
+// Durée de vie (100 000 cycles/cellule, mouvement permanent):
+//   256 cases × 100 000 × 5 s ≈ 4 ans (1 case: ~6 jours)
+
+#define EEPROM_JOURNAL_START      512   // Adresse première case
+#define EEPROM_JOURNAL_SLOTS      256   // Cases de 12 bytes → adresses 512-3583
+#define EEPROM_JOURNAL_PERIOD_MS  5000  // Intervalle mini entre enregistrements
+#define EEPROM_JOURNAL_DEADBAND   1     // Écart ignoré (LSB ADC cumulés, POT_MT seulement):
+                                        // bruit ±1 LSB au repos → aucune écriture
+
+// ════════════════════════════════════════════════════════════════
+// SURVEILLANCE ALIMENTATION (Coupure secteur, voir power_monitor.h)
+// ════════════════════════════════════════════════════════════════
+// Pont diviseur sur l'alimentation principale (avant le régulateur 5 V),
+// échantillonné par l'ISR ADC avec les pots. Sous POWER_FAIL_V: arrêt
+// moteurs et enregistrement immédiat de la position dans le journal.
+// Tenue nécessaire du 5 V après détection: ~50 ms (≤ 12 octets EEPROM
+// × 3.3 ms) → condensateur de réserve derrière une diode en entrée
+// du régulateur.
+// Activer seulement avec le pont câblé sur POWER_SENSE_PIN (docs/PINOUT.md):
+// A9 en l'air lit le reste de charge du canal pot El (A15) échantillonné
+// juste avant, assez pour armer puis déclencher la coupure (loop() bloquée).
+
+#define ENABLE_POWER_MONITOR   0     // 1=détection coupure + sauvegarde d'urgence (pont A9 requis)
+#define POWER_SENSE_PIN        A9    // Entrée pont diviseur
+#define POWER_SENSE_RATIO      4.0   // Tension alimentation / tension broche (ex. 30k + 10k)
+#define POWER_FAIL_V           9.0   // Seuil coupure (alimentation 12 V)
+#define POWER_RESTORE_V        10.5  // Seuil retour / armement (hystérésis)
+#define POWER_RESTORE_MS       500   // Tension stable avant reprise
+
 // ════════════════════════════════════════════════════════════════
 // TABLE DE CORRECTION AZIMUTH (Compensation non-linéarité pot)
 // ════════════════════════════════════════════════════════════════
@@ -321,6 +483,19 @@
 #define EEPROM_EL_TABLE      250   // Adresse début table (13 × 4 bytes = 52 bytes)
                                    // Occupe adresses 250-301
 
+// ─────────────────────────────────────────────────────────────────
+// BALAYAGE AUTOMATIQUE DES TABLES (table_sweep.h, Nano binaire)
+// ─────────────────────────────────────────────────────────────────
+// "CSWEEP<deg>" / "ESWEEP<deg>": antenne arrêtée à <deg> réels (position
+// approchée dans le sens croissant, jeu rattrapé). L'axe tourne à
+// vitesse constante jusqu'au dernier point; référence = pas commandés
+// au Nano, chaque point ajusté par régression sur ±STEP/2 autour de lui.
+
+#define ENABLE_TABLE_SWEEP   1     // 1=commandes CSWEEP / ESWEEP
+#define SWEEP_RATE_DPS       0.5   // Vitesse de balayage (°/s antenne), Az complet ~12 min
+#define SWEEP_SETTLE_MS      2000  // Début ignoré (rampe Nano)
+#define SWEEP_MIN_SAMPLES    20    // Lectures mini pour ajuster un point
+
 // ════════════════════════════════════════════════════════════════
 // OFFSET AFFICHAGE ÉLÉVATION (Parabole offset)
 // ════════════════════════════════════════════════════════════════
@@ -416,6 +591,15 @@
 // Intervalle affichage debug (millisecondes) - utilisé si debug actif
 #define DEBUG_INTERVAL      500  // Affiche position toutes les 500ms
 
+// ════════════════════════════════════════════════════════════════
+// PROFILEUR BOUCLE PRINCIPALE (profiler.h)
+// ════════════════════════════════════════════════════════════════
+// Mesure la durée de chaque étape de loop() (histogrammes log2 en RAM)
+// Consultation: commande Easycom "PROF", remise à zéro: "PROFCLR"
+// Coût: ~530 octets RAM + un micros() par étape
+
+#define ENABLE_PROFILER     1  // Activer profileur (1=ON, 0=OFF)
+
 // ════════════════════════════════════════════════════════════════
 // TIMINGS SYSTÈME (Millisecondes)
 // ════════════════════════════════════════════════════════════════
@@ -427,21 +611,35 @@
 #define BUTTON_DEBOUNCE_DELAY    50    // Debounce boutons 50ms
 
 // ════════════════════════════════════════════════════════════════
-// PARAMÈTRES PID (Futur moteurs DC brushed MC33926)
+// PARAMÈTRES PID (Moteurs DC brushed MC33926, motor_dc.h)
 // ════════════════════════════════════════════════════════════════
 // Non utilisés pour moteurs stepper, réservés pour SVH3
+// Boucle de position cadencée par Timer5 (PID_PERIOD_MS):
+//   PWM = KP × erreur + ∫ KI × erreur − KD × d(mesure)/dt + KFF × vitesse cible
+// Erreur en degrés, PWM signé ±PWM_MAX. Dérivée sur la mesure (pas de
+// coup de dérivée à chaque nouvelle consigne), terme intégral borné à
+// ±PID_I_LIMIT et figé quand la sortie sature, rampe PWM_SLEW.
+
+#define PID_PERIOD_MS  20    // Période de la boucle (Timer5, max 32 ms)
+
+#define PID_KP_AZ    300.0 // Proportional gain azimuth (PWM par degré)
+#define PID_KI_AZ    150.0 // Integral gain azimuth (PWM par degré·s)
+#define PID_KD_AZ    10.0  // Derivative gain azimuth (PWM par °/s, sur la mesure)
+#define PID_KFF_AZ   127.0 // Feed-forward azimuth (PWM par °/s de vitesse cible)
 
-#define PID_KP_AZ    1.0   // Proportional gain azimuth
-#define PID_KI_AZ    0.0   // Integral gain azimuth
-#define PID_KD_AZ    0.0   // Derivative gain azimuth
+#define PID_KP_EL    300.0 // Proportional gain élévation
+#define PID_KI_EL    150.0 // Integral gain élévation
+#define PID_KD_EL    10.0  // Derivative gain élévation
+#define PID_KFF_EL   127.0 // Feed-forward élévation
 
-#define PID_KP_EL    1.0   // Proportional gain élévation
-#define PID_KI_EL    0.0   // Integral gain élévation
-#define PID_KD_EL    0.0   // Derivative gain élévation
+#define PID_I_LIMIT  80.0  // Borne du terme intégral (PWM): frottement sec
+#define PID_DEADBAND 0.05  // Arrêt sous cette erreur (consigne fixe)
+#define PID_RESTART  0.15  // Reprise au-delà de cette erreur (consigne fixe)
 
 // Limites PWM (0-255)
 #define PWM_MIN      0     // PWM minimum (arrêt)
 #define PWM_MAX      255   // PWM maximum (pleine vitesse)
+#define PWM_SLEW     16    // Variation max de PWM par période (0 → 255 en ~320 ms)
 
 // ════════════════════════════════════════════════════════════════
 // CONFIGURATION NEXTION DISPLAY (Affichage tactile optionnel)
@@ -13,6 +13,7 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "angle.h"
 
 // ════════════════════════════════════════════════════════════════
 // PROTOCOLE EASYCOM - RÉFÉRENCE
@@ -40,6 +41,24 @@ COMMANDES CALIBRATION (Extensions custom):
   "E45.0\r"       → Calibre élévation position courante à 45.0°
   (Note: 'Z' et 'E' seuls = calibration, pas 'AZ'/'EL')
 
+COMMANDES DIAGNOSTIC (ENABLE_PROFILER):
+  "PROF\r"        → Durées des étapes de loop() (min/max/p99, histogramme µs)
+  "PROFCLR\r"     → Remise à zéro des statistiques du profileur
+
+COMMANDES POURSUITE (ENABLE_TRAJECTORY):
+  "TRK\r"         → Vitesse estimée et erreur de poursuite (RMS / max) par axe
+  "TRKCLR\r"      → Remise à zéro des statistiques de poursuite
+
+COMMANDES TABLES DE CORRECTION (POT_MT):
+  "C10\r" / "E-10\r" → Point de table Az / El à la position courante
+  "CTABLE\r" / "ETABLE\r", "CRESET\r" / "ERESET\r" → Affichage / table linéaire
+  "CSWEEP12.5\r"  → Balayage automatique Az, antenne actuellement à 12.5°
+  "ESWEEP-5\r"    → Balayage automatique El (table_sweep.h, "S" annule)
+
+COMMANDES ENCODEURS (SSI_ABSOLUTE / SSI_INC):
+  "SSI\r"         → Trames lues, erreurs parité/état, relectures et rejets par axe
+  "SSICLR\r"      → Remise à zéro des compteurs SSI
+
 RÉPONSE STANDARD:
   "AZ123.5 EL45.0\r\n"  → Position courante (1 décimale)
 
@@ -49,16 +68,63 @@ COMPORTEMENT ANTI-VIBRATION:
 */
 // ════════════════════════════════════════════════════════════════
 
+// ════════════════════════════════════════════════════════════════
+// COMMANDE DÉCODÉE (résultat de decodeEasycomCommand)
+// ════════════════════════════════════════════════════════════════
+
+#define EASYCOM_NONE       0   // Commande vide
+#define EASYCOM_GOTO       1   // AZxxx / ELxxx, query si hasAz = hasEl = false
+#define EASYCOM_STOP       2   // S, SA, SE, SA SE, STOP, ;
+#define EASYCOM_RESET      3   // RESET_EEPROM, RESET
+#define EASYCOM_PROF       4   // PROF
+#define EASYCOM_PROFCLR    5   // PROFCLR
+#define EASYCOM_CTABLE     6   // CTABLE
+#define EASYCOM_CRESET     7   // CRESET
+#define EASYCOM_CPOINT     8   // C<n>: point table azimuth (value)
+#define EASYCOM_ETABLE     9   // ETABLE
+#define EASYCOM_ERESET    10   // ERESET
+#define EASYCOM_EPOINT    11   // E<n>: point table élévation (value)
+#define EASYCOM_CAL_AZ    12   // Z<n>: calibration azimuth (value)
+#define EASYCOM_CAL_EL    13   // S<n>: calibration élévation (value)
+#define EASYCOM_TRK       14   // TRK
+#define EASYCOM_TRKCLR    15   // TRKCLR
+#define EASYCOM_SSI       16   // SSI
+#define EASYCOM_SSICLR    17   // SSICLR
+#define EASYCOM_CSWEEP    18   // CSWEEP<n>: balayage table azimuth depuis n° (value)
+#define EASYCOM_ESWEEP    19   // ESWEEP<n>: balayage table élévation depuis n° (value)
+
+struct EasycomCommand {
+    uint8_t type;       // EASYCOM_xxx
+    bool hasAz;         // GOTO: valeur azimuth présente
+    bool hasEl;         // GOTO: valeur élévation présente
+    float az;           // GOTO: cible azimuth
+    float el;           // GOTO: cible élévation
+    float value;        // CPOINT / EPOINT / CAL_AZ / CAL_EL / CSWEEP / ESWEEP
+};
+
 // ════════════════════════════════════════════════════════════════
 // FONCTIONS PUBLIQUES
 // ════════════════════════════════════════════════════════════════
 
+/**
+ * Décodage commande Easycom sans allocation (aucune String)
+ *
+ * @param command Buffer commande terminé par '\0' (ex: rxBuffer),
+ *                MODIFIÉ: mis en majuscules et sans espaces début/fin
+ * @param cmd     Commande décodée (type + valeurs)
+ * @return false si commande vide
+ *
+ * Une seule passe sur le buffer repère AZ, EL, SA/SE; les nombres
+ * sont lus sur place (atof). Aucune action n'est exécutée.
+ */
+bool decodeEasycomCommand(char *command, EasycomCommand &cmd);
+
 /**
  * Parsing commande Easycom reçue
  *
- * @param command Chaîne commande (sans \r\n final)
+ * @param command Buffer commande (sans \r\n final), modifié sur place
  *
- * Analyse commande et exécute action appropriée:
+ * Décode (decodeEasycomCommand) puis exécute action appropriée:
  * - Parse "AZxxx" → Met à jour targetAz (motor_stepper.cpp)
  * - Parse "ELxxx" → Met à jour targetEl
  * - Parse "S" / "STOP" → Arrêt moteurs
@@ -67,7 +133,7 @@ COMPORTEMENT ANTI-VIBRATION:
  *
  * IMPORTANT: Filtre micro-mouvements (seuil MICRO_MOVEMENT_FILTER)
  */
-void parseEasycomCommand(String command);
+void parseEasycomCommand(char *command);
 
 /**
  * Envoi réponse position via Serial/Ethernet
@@ -78,12 +144,48 @@ void parseEasycomCommand(String command);
 void sendPositionResponse();
 
 /**
- * Génération réponse position Easycom
+ * Réponse position Easycom (buffer statique, sans allocation)
+ *
+ * @return "AZ123.5 EL45.0\r\n" terminé par '\0'
  *
- * @return String format "AZ123.5 EL45.0\r\n"
+ * Utilise currentAzMdeg, currentElMdeg (encoder_ssi.cpp), 1 décimale
+ * (norme Easycom), arrondi au 0.1° le plus proche comme dtostrf().
+ * Formatage en entiers (dixièmes de degré). Si les deux positions
+ * arrondies n'ont pas changé, le buffer précédent est renvoyé tel quel.
+ * Le pointeur reste valide jusqu'au prochain appel.
+ */
+const char *getPositionResponse();
+
+/**
+ * Conversion angle → dixièmes de degré entiers (format des réponses)
+ *
+ * @param value Angle en degrés
+ * @return Dixièmes arrondis (demi vers le haut, comme dtostrf).
+ *         Négatif (signbit, y compris -0.0) codé ~dixièmes pour
+ *         conserver le "-". ANGLE_TENTHS_INVALID si NaN / hors plage.
+ */
+#define ANGLE_TENTHS_INVALID ((int32_t)0x80000000)
+int32_t angleToTenths(float value);
+
+/**
+ * Conversion millidegrés → dixièmes (même clé que angleToTenths)
+ * Chemin position: aucun flottant
+ */
+int32_t mdegToTenths(angle_t mdeg);
+
+/**
+ * Écriture "[-]entier.dixième" (ou "ovf") sans '\0' final
+ *
+ * @param out    Buffer destination (12 caractères au pire)
+ * @param tenths Valeur issue de angleToTenths()
+ * @return Pointeur après le dernier caractère écrit
+ */
+char *formatTenths(char *out, int32_t tenths);
+
+/**
+ * Génération réponse position Easycom (alias pour compatibilité)
  *
- * Utilise currentAz, currentEl (encoder_ssi.cpp)
- * Format: 1 décimale (norme Easycom)
+ * @return String copie de getPositionResponse()
  */
 String generatePositionResponse();
 
@@ -99,7 +201,7 @@ String generatePositionResponse();
  *   parseNumericValue("AZ123.5 EL45", "AZ", found) → 123.5
  *   parseNumericValue("AZ123.5 EL45", "EL", found) → 45.0
  */
-float parseNumericValue(String command, String keyword, bool &valueFound);
+float parseNumericValue(const char *command, const char *keyword, bool &valueFound);
 
 /**
  * Vérification commande = query position
@@ -111,7 +213,7 @@ float parseNumericValue(String command, String keyword, bool &valueFound);
  *   "AZ" → true (query)
  *   "AZ123" → false (commande goto)
  */
-bool isPositionQuery(String command);
+bool isPositionQuery(const char *command);
 
 /**
  * Vérification commande = arrêt
@@ -119,14 +221,14 @@ bool isPositionQuery(String command);
  * @param command Chaîne commande
  * @return true si commande stop ("S", "SA", "SE", "STOP")
  */
-bool isStopCommand(String command);
+bool isStopCommand(const char *command);
 
 /**
  * Affichage debug commande reçue
  *
  * @param command Commande parsée
  */
-void printEasycomDebug(String command);
+void printEasycomDebug(const char *command);
 
 /**
  * Affichage debug valeurs brutes encodeurs
@@ -13,15 +13,56 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "angle.h"
+
+// Axes lus par SSI (rafale CLK commune, voir readSSIFrames)
+#define SSI_AZ_USED ((ENCODER_AZ_TYPE == ENCODER_SSI_ABSOLUTE) || (ENCODER_AZ_TYPE == ENCODER_SSI_INC))
+#define SSI_EL_USED ((ENCODER_EL_TYPE == ENCODER_SSI_ABSOLUTE) || (ENCODER_EL_TYPE == ENCODER_SSI_INC))
+
+// ════════════════════════════════════════════════════════════════
+// ÉTAT TRAME SSI (bits 5..0 après la position)
+// ════════════════════════════════════════════════════════════════
+// Bit 5 OCF    : compensation offset terminée (doit valoir 1)
+// Bit 4 COF    : débordement CORDIC, position invalide
+// Bit 3 LIN    : alarme linéarité (champ magnétique inadapté)
+// Bit 2 MagINC : champ en augmentation  } les deux à 1 =
+// Bit 1 MagDEC : champ en diminution    } aimant hors plage
+// Bit 0 PAR    : parité paire sur les 17 bits précédents
+//
+// Une trame invalide est relue jusqu'à SSI_MAX_RETRIES fois; au-delà
+// la lecture est rejetée et la position précédente conservée (un
+// bit corrompu ne doit pas devenir un faux passage de tour).
+
+#define SSI_FRAME_OK       0   // Trame valide
+#define SSI_FRAME_OCF      1   // OCF = 0 (démarrage encodeur, ligne DATA à 0)
+#define SSI_FRAME_PARITY   2   // Parité fausse (bit corrompu sur la ligne)
+#define SSI_FRAME_COF      3   // COF = 1
+#define SSI_FRAME_LIN      4   // LIN = 1
+#define SSI_FRAME_MAGNET   5   // MagINC = MagDEC = 1
+#define SSI_FRAME_CODES    6
+
+#define SSI_AXIS_AZ  0
+#define SSI_AXIS_EL  1
 
 // ════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES POSITION
 // ════════════════════════════════════════════════════════════════
 
-// Position courante en degrés
+// Position courante en millidegrés (angle.h): référence pour
+// l'asservissement et le formatage Easycom / Nextion / télémétrie
+extern angle_t currentAzMdeg;
+extern angle_t currentElMdeg;
+
+// Miroir en degrés (float), mis à jour avec currentAzMdeg/ElMdeg
+// Lecture seule hors chemin critique (motor_stepper, debug, menus)
 extern float currentAz;  // Position azimuth (-∞ à +∞, peut faire plusieurs tours)
 extern float currentEl;  // Position élévation (typiquement 0-90°)
 
+// Vitesse estimée (mdeg/ms = °/s, Q16), pots multi-tours seulement
+// (position_estimator.h), 0 pour les autres encodeurs
+extern long currentAzRateQ16;
+extern long currentElRateQ16;
+
 // Position brute encodeurs (0-4095 counts)
 extern int rawCountsAz;
 extern int rawCountsEl;
@@ -33,6 +74,11 @@ extern long turnsEl;     // Nombre de tours élévation (optionnel)
 // Accumulation ADC pour méthode cumulative (POT_MT)
 extern long accumulatedAdcAz;  // ADC cumulé azimuth (sauvegardé EEPROM)
 extern long accumulatedAdcEl;  // ADC cumulé élévation (optionnel)
+extern long accumulatedFineAz; // Même valeur en unités fines (LSB << POT_FINE_BITS)
+extern long accumulatedFineEl;
+
+// Instant de la dernière lecture encodeurs (millis)
+extern unsigned long lastEncoderReadTime;
 
 // Offsets calibration (en steps absolus, sauvegardés EEPROM)
 extern long offsetStepsAz;
@@ -60,10 +106,64 @@ void setupEncoders();
  */
 void updateEncoders();
 
+/**
+ * Position extrapolée à l'instant now avec la vitesse estimée
+ * La dernière lecture date de 0 à ENCODER_READ_INTERVAL ms
+ *
+ * @param now millis() de la commande moteur
+ * @return Position en millidegrés
+ */
+angle_t currentAzAt(unsigned long now);
+angle_t currentElAt(unsigned long now);
+
+/**
+ * Lecture simultanée des trames SSI Az et El
+ *
+ * @param readAz  Activer CS azimuth
+ * @param readEl  Activer CS élévation
+ * @param frameAz Trame brute 18 bits azimuth (MSB = bit 17)
+ * @param frameEl Trame brute 18 bits élévation
+ *
+ * Une seule rafale de SSI_FRAME_BITS impulsions sur la CLK commune,
+ * SSI_DATA_AZ et SSI_DATA_EL échantillonnées au même front: positions
+ * Az/El du même instant, temps bus divisé par deux.
+ * Accès direct PORT/PIN sur AVR (masques résolus dans setupEncoders),
+ * interruptions coupées pendant la trame (~40 µs).
+ */
+void readSSIFrames(bool readAz, bool readEl, unsigned long &frameAz, unsigned long &frameEl);
+
+/**
+ * Extraction position d'une trame SSI (bits 17..6)
+ *
+ * @param frame   Trame brute readSSIFrames
+ * @param reverse Inverser sens lecture (true/false)
+ * @return Valeur brute 0-4095
+ */
+int ssiFrameCounts(unsigned long frame, bool reverse);
+
+/**
+ * Décodage des bits d'état d'une trame SSI
+ *
+ * @param frame Trame brute readSSIFrames
+ * @return SSI_FRAME_OK ou code d'erreur SSI_FRAME_xxx
+ */
+uint8_t ssiFrameStatus(unsigned long frame);
+
+/**
+ * Rapport via sendToClient (commande "SSI")
+ * Par axe: trames lues, erreurs par type, relectures, rejets
+ */
+void printSSIReport();
+
+/**
+ * Remise à zéro des compteurs SSI (commande "SSICLR")
+ */
+void ssiClearStats();
+
 /**
  * Lecture encodeur SSI absolu (HH-12 SSI)
  *
- * @param csPin   Pin Chip Select de l'encodeur
+ * @param csPin   Pin Chip Select de l'encodeur (SSI_CS_AZ ou SSI_CS_EL)
  * @param dataPin Pin Data de l'encodeur
  * @param reverse Inverser sens lecture (true/false)
  * @return Valeur brute 0-4095
@@ -72,6 +172,10 @@ void updateEncoders();
  * - 18 pulses CLK total (12 bits data + 6 bits status/parity)
  * - Data valide pendant CLK LOW
  * - CS LOW pour activer transmission
+ *
+ * Lecture d'un seul axe via readSSIFrames (updateEncoders lit les
+ * deux axes en une rafale). Trame validée avec relectures; si
+ * rejetée, retourne la dernière valeur valide de l'axe.
  */
 int readSSI_Absolute(int csPin, int dataPin, bool reverse);
 
@@ -138,10 +242,12 @@ void calibrateEl(float realDegrees);
 void loadCalibrationFromEEPROM();
 
 /**
- * Sauvegarde calibration dans EEPROM
- * - turnsAz
+ * Sauvegarde immédiate dans EEPROM (bloquante, ~40 ms max sur AVR)
+ * - turnsAz/El ou accumulatedAdcAz/El (journal, position_journal.h)
  * - offsetStepsAz
  * - offsetStepsEl
+ *
+ * Appelée sur coupure d'alimentation (power_monitor.h)
  */
 void saveCalibrationToEEPROM();
 
@@ -153,7 +259,8 @@ void printEncoderDebug();
 
 /**
  * Réinitialisation buffer filtrage potentiomètre azimuth
- * @param adcValue Valeur ADC pour remplir le buffer
+ * @param adcValue Valeur ADC pour remplir le buffer (unités fines,
+ *                 0-POT_FINE_MAX, voir adc_sampler.h)
  *
  * CRITIQUE: Appelé lors de la calibration pour assurer
  * la cohérence entre l'offset calculé et le buffer de filtrage.
@@ -165,7 +272,7 @@ void resetPotBufferAz(int adcValue);
 
 /**
  * Réinitialisation buffer filtrage potentiomètre élévation
- * @param adcValue Valeur ADC pour remplir le buffer
+ * @param adcValue Valeur ADC pour remplir le buffer (unités fines)
  *
  * CRITIQUE: Même logique que resetPotBufferAz() pour l'élévation.
  */
@@ -191,11 +298,22 @@ void loadAzCorrectionTable();
 void calibrateAzTablePoint(float realDegrees);
 
 /**
- * Conversion ADC cumulé → degrés avec interpolation table
- * @param accumulatedAdc Valeur ADC cumulée depuis calibration
- * @return Angle en degrés (interpolé entre points de la table)
+ * Remplacement de toute la table (balayage automatique, table_sweep.h)
+ * @param points AZ_TABLE_POINTS valeurs ADC cumulé (LSB 10 bits)
+ *
+ * Sauvegarde EEPROM, pentes recalculées, position relue aussitôt
  */
-float adcToDegrees(long accumulatedAdc);
+void setAzCorrectionTable(const long *points);
+
+/**
+ * Conversion ADC cumulé → angle avec interpolation table
+ * @param accumulatedFine ADC cumulé depuis calibration, en unités fines
+ *                        (LSB << POT_FINE_BITS, suréchantillonnage)
+ * @return Angle en millidegrés (interpolé entre points de la table)
+ *
+ * Segment mémorisé + dichotomie, pentes précalculées (table_lookup.h)
+ */
+angle_t adcToAngle(long accumulatedFine);
 
 /**
  * Affichage table correction complète (debug)
@@ -224,9 +342,17 @@ void loadElCorrectionTable();
 void calibrateElTablePoint(float realDegrees);
 
 /**
- * Conversion ADC cumulé → degrés élévation avec interpolation table
+ * Remplacement de toute la table élévation, voir setAzCorrectionTable()
+ * @param points EL_TABLE_POINTS valeurs ADC cumulé (LSB 10 bits)
+ */
+void setElCorrectionTable(const long *points);
+
+/**
+ * Conversion ADC cumulé → angle élévation avec interpolation table
+ * @param accumulatedFine ADC cumulé en unités fines, voir adcToAngle()
+ * @return Angle en millidegrés
  */
-float adcToDegreesEl(long accumulatedAdc);
+angle_t adcToAngleEl(long accumulatedFine);
 
 /**
  * Affichage table correction élévation complète
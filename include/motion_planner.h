@@ -0,0 +1,54 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Mouvement coordonné Az/El
+// ════════════════════════════════════════════════════════════════
+// Fichier: motion_planner.h
+// Description: Facteurs de vitesse des deux axes pour un ralliement
+//              en ligne droite (arrivée simultanée)
+// ════════════════════════════════════════════════════════════════
+// Axes indépendants: chacun part à sa vitesse max, un ralliement en
+// diagonale trace un "L" dans le ciel (l'axe court arrive d'abord,
+// l'autre termine seul).
+//
+// Durée de chaque axe à sa vitesse max: |erreur| / vitesse max.
+// L'axe le plus long (meneur) garde son profil, l'autre (suiveur)
+// reçoit le facteur
+//   k = durée suiveur / durée meneur   (0 à 1)
+// appliqué à son palier, son accélération et sa vitesse de départ:
+// profil homothétique de celui du meneur, arrivée simultanée.
+//
+// Comme un DDA (Bresenham), k est recalculé à chaque mise à jour sur
+// les erreurs restantes: un axe en retard (jeu, démarrage, retard
+// encodeur) ralentit l'autre, la position revient sur la droite.
+//
+// Ralliement sur consigne fixe uniquement: poursuite (vitesse
+// d'anticipation) et boutons manuels gardent des axes indépendants.
+//
+// Coût: une division float par mise à jour moteur (~35 µs AVR).
+// ════════════════════════════════════════════════════════════════
+
+#ifndef MOTION_PLANNER_H
+#define MOTION_PLANNER_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "angle.h"
+
+#define MOTION_SCALE_ONE  65536L    // Facteur 1.0 (Q16)
+
+/**
+ * Facteurs de vitesse pour une arrivée simultanée des deux axes
+ *
+ * Erreur nulle sur un axe: l'autre garde son profil complet.
+ * ENABLE_COORDINATED_MOVE = 0: MOTION_SCALE_ONE sur les deux axes.
+ *
+ * @param errAz     Erreur restante Az (signe ignoré)
+ * @param errEl     Erreur restante El (signe ignoré)
+ * @param maxRateAz Vitesse max Az (unité quelconque, commune aux deux axes)
+ * @param maxRateEl Vitesse max El
+ * @param scaleAz   [out] Facteur Az (Q16, MOTION_SCALE_ONE pour le meneur)
+ * @param scaleEl   [out] Facteur El (Q16)
+ */
+void coordinatedScale(angle_t errAz, angle_t errEl, long maxRateAz, long maxRateEl,
+                      long &scaleAz, long &scaleEl);
+
+#endif // MOTION_PLANNER_H
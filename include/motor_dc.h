@@ -8,6 +8,19 @@
 // ════════════════════════════════════════════════════════════════
 // ÉTAPE 7 : Intégration moteurs DC (OPTIONNEL - Futur SVH3)
 // ════════════════════════════════════════════════════════════════
+// Asservissement de position à cadence fixe: Timer5 en CTC lève un
+// drapeau toutes les PID_PERIOD_MS, updateMotorControlDC() calcule
+// alors un pas de PID par axe DC (dt constant, calcul hors ISR).
+//
+// Consigne: cible fixe, ou cible interpolée du prédicteur en
+// poursuite (trajectory.h) dont la vitesse sert d'anticipation
+// (KFF). Consigne fixe: arrêt sous PID_DEADBAND (PWM ramené à 0 par
+// la rampe, pont en frein), reprise au-delà de PID_RESTART.
+//
+// Sign-magnitude: IN2 donne le sens; IN2 = HIGH inverse le rapport
+// cyclique vu par le moteur, IN1 reçoit alors 255 - PWM.
+// Courant (FB, 525 mV/A) lu par l'acquisition ADC (adc_sampler.h).
+// ════════════════════════════════════════════════════════════════
 
 #ifndef MOTOR_DC_H
 #define MOTOR_DC_H
@@ -19,16 +32,17 @@
 // STRUCTURES PID
 // ════════════════════════════════════════════════════════════════
 
-// Contrôleur PID pour asservissement vitesse
+// Contrôleur PID pour asservissement position (sortie PWM signée)
 struct PIDController {
     float kp;           // Gain proportionnel
     float ki;           // Gain intégral
-    float kd;           // Gain dérivé
-
-    float integral;     // Accumulation erreur intégrale
-    float lastError;    // Erreur précédente (calcul dérivée)
+    float kd;           // Gain dérivé (sur la mesure)
+    float kff;          // Anticipation vitesse cible
 
-    unsigned long lastTime;  // Timestamp dernier calcul
+    float integral;     // Terme intégral (PWM, borné à ±PID_I_LIMIT)
+    float lastMeasurement;  // Mesure précédente (calcul dérivée)
+    float output;       // Dernière sortie appliquée (rampe PWM_SLEW)
+    bool primed;        // false: pas encore de mesure précédente
 };
 
 // ════════════════════════════════════════════════════════════════
@@ -58,10 +72,10 @@ void setupMotorsDC();
 
 /**
  * Mise à jour contrôle moteurs DC (appelé dans loop)
- * - Calcul erreur position (similaire stepper)
- * - Calcul vitesse cible via PID
- * - Application PWM + direction
- * - Monitoring courant et status flags
+ * Sans période Timer5 écoulée: retour immédiat. Sinon, par axe DC:
+ * - Cible fixe ou interpolée (trajectory.h), erreur position
+ * - PID → PWM signé, application PWM + direction
+ * - Monitoring status flags
  */
 void updateMotorControlDC();
 
@@ -94,21 +108,25 @@ void stopMotorDC(int motor);
 void stopAllMotorsDC();
 
 /**
- * Calcul sortie PID
+ * Calcul sortie PID (un pas de la boucle à cadence fixe)
  *
  * @param pid          Référence contrôleur PID
- * @param setpoint     Consigne (position ou vitesse cible)
- * @param measurement  Mesure actuelle
- * @return Sortie PID (PWM 0-255)
+ * @param setpoint     Consigne (degrés)
+ * @param measurement  Mesure actuelle (degrés)
+ * @param feedForward  Vitesse cible (°/s), 0 sur consigne fixe
+ * @param dt           Période (secondes)
+ * @return Sortie PID (PWM signé, ±PWM_MAX)
  *
- * Formule PID classique:
- * output = Kp*error + Ki*∫error + Kd*(d/dt error)
+ * output = Kp*error + ∫Ki*error - Kd*(d/dt mesure) + Kff*vitesse
+ * - intégrale bornée à ±PID_I_LIMIT, figée quand la sortie est
+ *   limitée (saturation ou rampe) dans le sens de l'erreur
+ * - variation de sortie limitée à ±PWM_SLEW par appel
  */
-float calculatePID(PIDController &pid, float setpoint, float measurement);
+float calculatePID(PIDController &pid, float setpoint, float measurement, float feedForward, float dt);
 
 /**
  * Reset contrôleur PID
- * Remet à zéro intégrale et erreur précédente
+ * Remet à zéro intégrale et sortie, dérivée réamorcée
  *
  * @param pid Référence contrôleur PID
  */
@@ -118,10 +136,10 @@ void resetPID(PIDController &pid);
  * Lecture courant moteur (feedback MC33926)
  *
  * @param motor 1=Azimuth, 2=Élévation
- * @return Courant en mA (lecture analogique FB pin)
+ * @return Courant en mA (canal ADC_CH_CURRENT_xx, broche FB)
  *
  * MC33926: 525 mV/A
- * Formule: current_mA = (analogRead(FB_pin) * 5000.0 / 1023.0) / 0.525
+ * Formule: current_mA = (lecture FB en mV) / 0.525
  */
 float readMotorCurrent(int motor);
 
@@ -22,6 +22,31 @@
 //   "LIMIT:AZ:CCW\n" - Fin de course Az CCW atteinte
 //   "LIMIT:EL:UP\n"  - Fin de course El UP atteinte
 //   "LIMIT:EL:DOWN\n"- Fin de course El DOWN atteinte
+//   "CLEAR:AZ:CW\n"  - Fin de course dégagée (idem CCW, EL:UP, EL:DOWN)
+//
+// Protocole binaire (NANO_BINARY_PROTOCOL=1):
+//   Négociation: le Mega envoie "BIN?\n" au démarrage et après chaque
+//   "READY". Un Nano compatible répond "BIN:OK\n" puis les deux côtés
+//   passent en trames binaires; sinon le protocole texte est conservé.
+//
+//   Trame (5 octets): SYNC | TYPE | SEQ | ARG | CRC
+//     SYNC = 0xA5 (jamais présent dans le texte ASCII)
+//     SEQ  = compteur 8 bits propre à chaque sens
+//     CRC  = CRC-8 (polynôme 0x07) sur TYPE, SEQ, ARG
+//
+//   Mega → Nano: MOVE (ARG = dirAz+1 | (dirEl+1)<<2 | speed<<4)
+//                VEL, 8 octets: SYNC | TYPE | SEQ | AZ_L AZ_H | EL_L EL_H | CRC
+//                     vitesses signées int16 en 1/16 step/s (±2047 steps/s),
+//                     El inversée comme pour MOVE (NANO_VELOCITY_CONTROL)
+//   Nano → Mega: ACK  (ARG = SEQ de la commande reçue)
+//                NACK (ARG = SEQ rejetée, CRC faux → renvoi immédiat)
+//                LIMIT (ARG = masque complet des fins de course)
+//
+//   "M:-1:1:1\r\n" (10 octets) devient 5 octets. Un trou dans SEQ
+//   révèle une trame Nano perdue; un ACK absent après
+//   NANO_ACK_TIMEOUT_MS provoque un renvoi, et NANO_MAX_MISSED_ACKS
+//   ACK perdus signalent la perte de communication sans attendre
+//   NANO_TIMEOUT_MS.
 // ════════════════════════════════════════════════════════════════
 
 #ifndef MOTOR_NANO_H
@@ -30,6 +55,34 @@
 #include <Arduino.h>
 #include "config.h"
 
+// ════════════════════════════════════════════════════════════════
+// TRAMES BINAIRES
+// ════════════════════════════════════════════════════════════════
+
+#define NANO_FRAME_SYNC     0xA5
+#define NANO_FRAME_SIZE     5
+
+// Types Mega → Nano
+#define NANO_FRAME_MOVE     0x01
+#define NANO_FRAME_VEL      0x02
+#define NANO_VEL_FRAME_SIZE 8
+
+// Conversion vitesse antenne (°/s) → unités VEL (1/16 step/s)
+#define NANO_VEL_SCALE      16
+#define NANO_STEPS_PER_DEG_AZ (STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_AZ / 360.0)
+#define NANO_STEPS_PER_DEG_EL (STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_EL / 360.0)
+
+// Types Nano → Mega
+#define NANO_FRAME_ACK      0x81
+#define NANO_FRAME_NACK     0x82
+#define NANO_FRAME_LIMIT    0x83
+
+// Bits ARG de NANO_FRAME_LIMIT
+#define NANO_LIMIT_BIT_CW   0x01
+#define NANO_LIMIT_BIT_CCW  0x02
+#define NANO_LIMIT_BIT_UP   0x04
+#define NANO_LIMIT_BIT_DOWN 0x08
+
 // ════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES COMMANDE
 // ════════════════════════════════════════════════════════════════
@@ -45,12 +98,19 @@ extern bool nanoLimitCCW;       // true si fin de course Az CCW active
 extern bool nanoLimitUp;        // true si fin de course El UP active
 extern bool nanoLimitDown;      // true si fin de course El DOWN active
 
+extern long targetRateAz;       // Vitesse cible Az (mdeg/s) estimée par trajectory.h
+extern long targetRateEl;       // Vitesse cible El (mdeg/s), 0 = consigne fixe
+extern long commandRateAz;      // Dernière vitesse commandée Az (mdeg/s)
+extern long commandRateEl;      // Dernière vitesse commandée El (mdeg/s)
+
 extern int8_t currentDirAz;     // Direction actuelle: 0=STOP, 1=CW, -1=CCW
 extern int8_t currentDirEl;     // Direction actuelle: 0=STOP, 1=UP, -1=DOWN
-extern uint8_t currentSpeedMode; // Mode vitesse: 0=LENT, 1=RAPIDE, 2=MANUEL
+extern uint8_t currentSpeedMode; // Mode vitesse: 0=LENT, 1=RAPIDE, 2=MANUEL, 3=BALAYAGE
+#define NANO_SPEED_SWEEP 3      // currentSpeedMode pendant un balayage (sendNanoSweep, table_sweep.h)
 
 // Statut communication Nano
 extern bool nanoConnected;      // true si communication OK (réponse < NANO_TIMEOUT_MS)
+extern bool nanoBinaryMode;     // true si trames binaires négociées avec le Nano
 
 // ════════════════════════════════════════════════════════════════
 // FONCTIONS PUBLIQUES
@@ -64,8 +124,11 @@ void setupMotorNano();
 
 /**
  * Mise à jour - calcule direction et envoie commande combinée au Nano
- * Compare targetAz/El avec currentAz/El (des encodeurs)
- * Envoie "M:dirAz:dirEl" pour mouvement simultané des deux axes
+ * Compare targetAz/El avec currentAzMdeg/ElMdeg (des encodeurs),
+ * erreurs et vitesses en virgule fixe (angle.h)
+ * Envoie "M:dirAz:dirEl" pour mouvement simultané des deux axes,
+ * ou une trame VEL (vitesses continues) si NANO_VELOCITY_CONTROL et
+ * protocole binaire négocié
  * Appelé dans loop() toutes les 20ms
  */
 void updateMotorNano();
@@ -78,12 +141,13 @@ void stopAllMotorsNano();
 
 /**
  * Lecture réponses du Nano (non-bloquant)
- * Parse OK, READY, LIMIT:AZ, LIMIT:EL
+ * Lignes texte (OK, READY, BIN:OK, LIMIT:xx, CLEAR:xx) et trames
+ * binaires (ACK, NACK, LIMIT) sur le même flux
  */
 void readNanoResponse();
 
 /**
- * Affichage debug état moteurs
+ * Affichage debug état moteurs (+ statistiques liaison en binaire)
  */
 void printMotorNanoDebug();
 
@@ -95,4 +159,17 @@ void printMotorNanoDebug();
  */
 void sendManualMove(int8_t dirAz, int8_t dirEl);
 
+/**
+ * Balayage à vitesse constante (calibration automatique, table_sweep.h)
+ * Trame VEL directe hors asservissement: cibles annulées, mode 3
+ * (BALAYAGE) jusqu'à sendNanoSweep(0, 0) ou stopAllMotorsNano().
+ * Envoi sur changement, keepalive NANO_KEEPALIVE_INTERVAL sinon.
+ *
+ * @param velAz Vitesse Az en 1/16 step/s (NANO_VEL_SCALE)
+ * @param velEl Vitesse El en 1/16 step/s, sens antenne (inversion
+ *              câblage appliquée ici)
+ * @return false si le protocole binaire n'est pas négocié (pas de VEL)
+ */
+bool sendNanoSweep(int16_t velAz, int16_t velEl);
+
 #endif // MOTOR_NANO_H
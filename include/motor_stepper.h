@@ -49,6 +49,14 @@ void setupMotors();
  * - Erreur > SPEED_SWITCH_THRESHOLD (3°) → vitesse rapide (SPEED_MAX)
  * - Erreur < SPEED_SWITCH_THRESHOLD → vitesse lente (SPEED_SLOW)
  * - Erreur < POSITION_TOLERANCE (0.08°) → arrêt, target = -1
+ *
+ * ENABLE_STEP_TIMER: vitesse et sens transmis au générateur
+ * (step_generator.h), retour immédiat. Sinon rafale de 10 pas
+ * bloquante par axe.
+ *
+ * ENABLE_STEPPER_RAMP: les vitesses ci-dessus sont des paliers,
+ * atteints à STEPPER_ACCEL_DPS2, freinage v²/2a avant la cible;
+ * fin de course ou STOP: arrêt sans rampe.
  */
 void updateMotorControl();
 
@@ -92,6 +100,8 @@ void stopAllMotors();
  * Mouvements manuels:
  * - MANUAL_STEP_SIZE steps par appui (défaut: 20)
  * - Vitesse lente (SPEED_SLOW) pour précision
+ * - ENABLE_STEP_TIMER: vitesse lente continue tant que le bouton
+ *   est maintenu (appliquée par updateMotorControl)
  * - Débouncing logiciel (BUTTON_DEBOUNCE_DELAY)
  */
 void checkManualButtons();
@@ -24,6 +24,9 @@
 // VARIABLES GLOBALES
 // ════════════════════════════════════════════════════════════════
 
+// Buffer réception Serial/Ethernet (une commande Easycom, '\0' inclus)
+#define RX_BUFFER_SIZE 64
+
 // État communication
 extern bool networkInitialized;
 
@@ -34,12 +37,8 @@ extern bool networkInitialized;
     extern IPAddress gateway;
     extern IPAddress subnet;
 
-    // Serveur Easycom
+    // Serveur Easycom (sessions clients internes à network.cpp)
     extern EthernetServer server;
-
-    // Client courant
-    extern EthernetClient currentClient;
-    extern bool clientConnected;
 #endif
 
 // ════════════════════════════════════════════════════════════════
@@ -70,20 +69,22 @@ bool setupNetwork();
  * - Parse commandes Easycom
  *
  * Mode Ethernet:
- * - Écoute nouvelles connexions
- * - Lit commandes clients
- * - Gère déconnexions
+ * - Accepte jusqu'à EASYCOM_MAX_CLIENTS sessions simultanées
+ * - Sert chaque session en tourniquet (au plus une commande par
+ *   session et par passage), départ décalé à chaque appel
+ * - Ferme les sessions déconnectées
  *
  * Polling toutes les NETWORK_POLL_INTERVAL ms
  */
 void handleNetwork();
 
 /**
- * Traitement caractère reçu
+ * Traitement caractère reçu (mode Serial)
  *
- * @param c Caractère reçu (Serial ou Ethernet)
+ * @param c Caractère reçu
  *
  * Accumule caractères jusqu'à \r ou \n, puis parse la commande
+ * (les sessions Ethernet ont chacune leur propre buffer ligne)
  */
 void processReceivedChar(char c);
 
@@ -92,6 +93,9 @@ void processReceivedChar(char c);
  *
  * @param message Chaîne à envoyer (format Easycom: terminé par \r\n)
  *
+ * Ethernet: pendant le traitement d'une commande, seule la session
+ * émettrice reçoit la réponse; hors commande, toutes les sessions.
+ *
  * Exemple: sendToClient("AZ123.5 EL45.0\r\n");
  */
 void sendToClient(const char* message);
@@ -106,15 +110,22 @@ void sendToClient(String message);
 /**
  * Vérification connexion active
  *
- * Mode Serial: toujours true
- * Mode Ethernet: true si client TCP connecté
+ * Mode Serial: true si commande reçue dans les 5 dernières secondes
+ * Mode Ethernet: true si au moins une session TCP connectée
  *
  * @return true si connecté
  */
 bool isClientConnected();
 
 /**
- * Déconnexion client (Ethernet uniquement)
+ * Nombre de sessions Easycom connectées
+ *
+ * @return 0..EASYCOM_MAX_CLIENTS (Serial: 0 ou 1)
+ */
+uint8_t getClientCount();
+
+/**
+ * Déconnexion de toutes les sessions (Ethernet uniquement)
  */
 void disconnectClient();
 
@@ -0,0 +1,77 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Estimateur position / vitesse
+// ════════════════════════════════════════════════════════════════
+// Fichier: position_estimator.h
+// Description: Filtre alpha-beta par axe (pots multi-tours), gains
+//              selon l'état du moteur, en virgule fixe
+// ════════════════════════════════════════════════════════════════
+// L'ancienne EMA (0.10 × mesure + 0.90 × filtré, toutes les 20 ms)
+// retardait la position d'environ 9 lectures (~180 ms) pendant un
+// mouvement: l'asservissement poursuivait une position ancienne et
+// dépassait la cible.
+//
+// Le filtre alpha-beta suit position ET vitesse. À chaque lecture:
+//
+//   prédiction  x = x + v × dt
+//   résidu      r = mesure - x
+//   correction  x = x + α × r
+//               v = v + β × r / dt
+//
+// Pour une vitesse constante le retard tend vers zéro. Gains:
+// - moteur commandé: α/β ESTIMATOR_*_MOVING (suivi)
+// - moteur arrêté: α ESTIMATOR_ALPHA_HOLD, β = 0 et vitesse amortie
+//   vers zéro (lissage équivalent à l'EMA, sans retard à l'arrêt)
+//
+// Un résidu supérieur à ESTIMATOR_JUMP_DEG (calibration, lecture
+// aberrante après blocage) réinitialise l'estimateur sur la mesure.
+//
+// Unités: position millidegrés Q8, vitesse mdeg/ms Q16 (= °/s Q16,
+// comme trajectory.cpp). β/dt est précalculé pour dt nominal =
+// ENCODER_READ_INTERVAL: aucune division par lecture.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef POSITION_ESTIMATOR_H
+#define POSITION_ESTIMATOR_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "angle.h"
+
+#define ESTIMATOR_POS_SHIFT  8      // Position en Q8
+#define ESTIMATOR_VEL_SHIFT  16     // Vitesse en Q16
+
+struct PositionEstimator {
+    long position;          // Position estimée (mdeg, Q8)
+    long velocity;          // Vitesse estimée (mdeg/ms, Q16)
+    bool initialized;       // false → prochaine mesure recopiée
+};
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Réinitialisation sur une position connue, vitesse nulle
+ * (calibration, reset table)
+ */
+void estimatorReset(PositionEstimator &est, angle_t position);
+
+/**
+ * Nouvelle mesure
+ *
+ * @param est       État de l'axe
+ * @param measured  Position mesurée (millidegrés, non normalisée)
+ * @param dtMs      Temps depuis la mesure précédente (borné en interne)
+ * @param commanded Moteur commandé (gains de suivi)
+ * @return Position estimée (millidegrés)
+ */
+angle_t estimatorUpdate(PositionEstimator &est, angle_t measured, unsigned long dtMs, bool commanded);
+
+/**
+ * Position estimée (millidegrés)
+ */
+inline angle_t estimatorPosition(const PositionEstimator &est) {
+    return (angle_t)(est.position >> ESTIMATOR_POS_SHIFT);
+}
+
+#endif // POSITION_ESTIMATOR_H
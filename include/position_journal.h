@@ -0,0 +1,113 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Journal EEPROM position accumulée
+// ════════════════════════════════════════════════════════════════
+// Fichier: position_journal.h
+// Description: Journal circulaire (répartition d'usure) des valeurs
+//              accumulées Az/El, numéro de séquence et CRC-16
+// ════════════════════════════════════════════════════════════════
+// Auparavant updateEncoders() réécrivait EEPROM_TURNS_AZ/EL toutes
+// les 5 s, mouvement ou non: les mêmes 4 cellules encaissaient tout
+// (100 000 cycles garantis → quelques semaines en continu).
+//
+// Ici chaque enregistrement va dans la case suivante d'une zone
+// réservée (EEPROM_JOURNAL_SLOTS cases de 12 octets):
+//
+//   [séquence u16][az i32][el i32][crc16 u16]
+//
+// - écriture uniquement si az ou el a changé depuis le dernier
+//   enregistrement (au-delà d'une zone morte pour l'ADC cumulé, qui
+//   oscille d'un LSB au repos): antenne arrêtée → aucune écriture
+// - chaque cellule n'est réécrite qu'une fois par tour du journal
+// - CRC-16/CCITT sur séquence + valeurs: un enregistrement coupé
+//   (coupure secteur pendant l'écriture) est rejeté, le précédent,
+//   intact dans sa propre case, est repris
+//
+// Écriture non bloquante: une écriture EEPROM AVR dure ~3.3 ms par
+// octet (~40 ms pour 12 octets). journalService() écrit au plus un
+// octet par appel, quand l'EEPROM est libre; la boucle n'attend jamais.
+//
+// Reprise au démarrage: lecture des seules séquences (2 octets par
+// case), la plus récente au sens modulo 2^16 est vérifiée par CRC;
+// invalide → case précédente, etc. La séquence 0xFFFF (EEPROM
+// vierge) n'est jamais écrite.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef POSITION_JOURNAL_H
+#define POSITION_JOURNAL_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#define JOURNAL_RECORD_SIZE  12     // Octets par case
+#define JOURNAL_SEQ_ERASED   0xFFFF // Case jamais écrite
+
+struct JournalStats {
+    unsigned long writes;       // Enregistrements écrits
+    unsigned long skipped;      // Demandes ignorées (valeurs inchangées)
+    uint16_t slot;              // Case du dernier enregistrement
+    uint16_t sequence;          // Séquence du dernier enregistrement
+    uint16_t rejected;          // Cases invalides écartées au démarrage
+    bool busy;                  // Enregistrement en cours d'écriture
+};
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Reprise du dernier enregistrement valide (démarrage)
+ *
+ * @param az Valeur azimuth (inchangée si aucun enregistrement)
+ * @param el Valeur élévation (inchangée si aucun enregistrement)
+ * @return true si un enregistrement valide a été trouvé
+ */
+bool journalRecover(long &az, long &el);
+
+/**
+ * Demande d'enregistrement
+ * Ignorée si les valeurs sont celles du dernier enregistrement.
+ * Pendant une écriture en cours, seule la dernière demande est gardée.
+ */
+void journalWrite(long az, long el);
+
+/**
+ * Demande d'enregistrement périodique (suivi de position)
+ * Ignorée si chaque valeur reste à ± zone morte du dernier enregistrement.
+ *
+ * @param deadbandAz Écart ignoré azimuth (0 = tout changement)
+ * @param deadbandEl Écart ignoré élévation
+ */
+void journalWriteIfMoved(long az, long el, long deadbandAz, long deadbandEl);
+
+/**
+ * Enregistrement immédiat (bloquant, ≤ 12 octets × 3.3 ms sur AVR)
+ * Une écriture en cours est reprise dans la même case avec ces
+ * valeurs: jamais deux cases incomplètes. Sauvegarde d'urgence
+ * (power_monitor.h).
+ */
+void journalWriteNow(long az, long el);
+
+/**
+ * Avancement de l'écriture (au plus un octet, à appeler à chaque loop)
+ */
+void journalService();
+
+/**
+ * Termine l'écriture en cours et la demande en attente (bloquant)
+ */
+void journalFlush();
+
+/**
+ * Dernier enregistrement valide en EEPROM, sans modifier l'état
+ * d'écriture (diagnostic, simulateur)
+ *
+ * @return false si aucun enregistrement valide
+ */
+bool journalReadLatest(long &az, long &el);
+
+/**
+ * Compteurs du journal
+ */
+const JournalStats &journalGetStats();
+
+#endif // POSITION_JOURNAL_H
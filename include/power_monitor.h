@@ -0,0 +1,76 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Surveillance alimentation
+// ════════════════════════════════════════════════════════════════
+// Fichier: power_monitor.h
+// Description: Détection de coupure sur l'alimentation principale,
+//              arrêt moteurs et sauvegarde d'urgence de la position
+// ════════════════════════════════════════════════════════════════
+// La position accumulée (pots multi-tours, tours SSI) vit en RAM et
+// n'est journalisée que toutes les EEPROM_JOURNAL_PERIOD_MS: une
+// coupure pendant un ralliement perdait jusqu'à 5 s de mouvement.
+//
+// Le pont diviseur POWER_SENSE_PIN est lu par l'ISR ADC (canal
+// ADC_CH_SUPPLY, ~5 ms par tour de canaux). À chaque loop():
+//
+//   ARMÉ    tension < POWER_FAIL_V
+//           → arrêt moteurs (le courant moteur ne vide plus la réserve)
+//           → saveCalibrationToEEPROM(): enregistrement journal immédiat
+//           → COUPÉ
+//   COUPÉ   loop() ne fait plus que surveiller la tension; retour
+//           au-dessus de POWER_RESTORE_V pendant POWER_RESTORE_MS
+//           (micro-coupure, le Mega a tenu) → ARMÉ
+//
+// Au démarrage la surveillance n'est armée qu'une fois la tension
+// au-dessus de POWER_RESTORE_V: un Mega alimenté par l'USB seul (banc,
+// programmation) ne déclenche pas de sauvegarde.
+//
+// Tenue nécessaire après détection: latence (~5 ms + une loop) +
+// écriture journal (≤ 40 ms). Voir config.h.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef POWER_MONITOR_H
+#define POWER_MONITOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Surveillance active: tension échantillonnée et position à sauver
+#define POWER_MONITOR_ACTIVE  (ENABLE_POWER_MONITOR && TEST_ENCODERS)
+
+#define POWER_STATE_DISARMED  0   // Tension jamais vue correcte
+#define POWER_STATE_ARMED     1   // Surveillance
+#define POWER_STATE_FAILED    2   // Coupure détectée, position sauvée
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Initialisation (après setupEncoders: ADC en conversion continue)
+ */
+void setupPowerMonitor();
+
+/**
+ * Surveillance, à appeler en tête de loop()
+ *
+ * @return true si l'alimentation est coupée: le reste de loop()
+ *         doit être sauté (moteurs arrêtés, position sauvée)
+ */
+bool updatePowerMonitor();
+
+/**
+ * Tension d'alimentation mesurée (V)
+ */
+float powerSupplyVolts();
+
+/**
+ * État courant (POWER_STATE_xxx)
+ */
+uint8_t powerMonitorState();
+
+/**
+ * Nombre de coupures détectées depuis le démarrage
+ */
+unsigned int powerFailCount();
+
+#endif // POWER_MONITOR_H
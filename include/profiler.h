@@ -0,0 +1,103 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Profileur boucle principale
+// ════════════════════════════════════════════════════════════════
+// Fichier: profiler.h
+// Description: Mesure micros() de chaque étape de loop()
+//              Histogrammes log2 en RAM, min / max / p99 par étape
+//              Consultation via commande Easycom "PROF"
+// ════════════════════════════════════════════════════════════════
+// Principe:
+//   PROF_START() en tête de loop(), PROF_MARK(étape) après chaque
+//   étape, PROF_END() en fin de boucle. Chaque durée est rangée
+//   dans le bucket log2 correspondant (bucket k = [2^(k-1), 2^k) µs).
+//   PROF_SECTION_START/END mesurent une portion de code isolée
+//   (une fonction appelée depuis une étape).
+//
+// AVR 16 MHz: 1 µs = 16 cycles, résolution micros() = 4 µs.
+//
+// Coût: un micros() + quelques opérations entières par étape.
+// RAM : PROF_STAGE_COUNT × (16 × 2 + 12) = 528 octets
+//
+// ENABLE_PROFILER = 0 → macros vides, aucun code ni RAM utilisés
+// ════════════════════════════════════════════════════════════════
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ════════════════════════════════════════════════════════════════
+// ÉTAPES MESURÉES (ordre d'exécution dans loop())
+// ════════════════════════════════════════════════════════════════
+
+#define PROF_ENCODERS         0   // updateEncoders()
+#define PROF_BUTTONS          1   // checkManualButtons()
+#define PROF_LIMITS           2   // checkLimits()
+#define PROF_MOTORS           3   // updateMotorNano() / updateMotorControl()
+#define PROF_NETWORK          4   // handleNetwork() (parsing Easycom inclus)
+#define PROF_NEXTION_TOUCH    5   // readNextionTouch()
+#define PROF_NEXTION_CALIB    6   // handleCalibrationTouch()
+#define PROF_NEXTION_BUTTONS  7   // handleNextionButtons()
+#define PROF_NEXTION_UPDATE   8   // updateNextion()
+#define PROF_NEXTION_INDIC    9   // updateNextionIndicators()
+#define PROF_LOOP            10   // Boucle complète (PROF_START → PROF_END)
+
+// Sections internes (mesurées hors de l'enchaînement des étapes)
+#define PROF_RESPONSE        11   // getPositionResponse() (easycom.cpp)
+
+#define PROF_STAGE_COUNT     12
+#define PROF_BUCKETS         16   // Bucket 15 = 16384 µs et plus
+
+// ════════════════════════════════════════════════════════════════
+// MACROS D'INSTRUMENTATION
+// ════════════════════════════════════════════════════════════════
+
+#if ENABLE_PROFILER
+  #define PROF_START()       unsigned long profLoopStart = micros(); \
+                             unsigned long profStageStart = profLoopStart
+  #define PROF_MARK(stage)   profStageStart = profilerRecord((stage), profStageStart)
+  #define PROF_END()         (void)profStageStart; profilerRecord(PROF_LOOP, profLoopStart)
+
+  #define PROF_SECTION_START(var)        unsigned long var = micros()
+  #define PROF_SECTION_END(stage, var)   profilerRecord((stage), var)
+#else
+  #define PROF_START()
+  #define PROF_MARK(stage)
+  #define PROF_END()
+
+  #define PROF_SECTION_START(var)
+  #define PROF_SECTION_END(stage, var)
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Enregistrement durée d'une étape
+ *
+ * @param stage   Étape PROF_xxx
+ * @param startUs micros() au début de l'étape
+ * @return micros() courant (début de l'étape suivante)
+ *
+ * Si un bucket sature (65535), tous les buckets de l'étape sont
+ * divisés par 2: la forme de la distribution est conservée.
+ */
+unsigned long profilerRecord(uint8_t stage, unsigned long startUs);
+
+/**
+ * Remise à zéro de toutes les statistiques (commande "PROFCLR")
+ */
+void profilerReset();
+
+/**
+ * Envoi rapport complet via sendToClient (commande "PROF")
+ *
+ * Une ligne par étape exécutée au moins une fois:
+ *   nom, nombre d'échantillons, min, max, p99 (borne haute du bucket)
+ * puis l'histogramme (buckets non vides uniquement).
+ */
+void printProfilerReport();
+
+#endif // PROFILER_H
@@ -0,0 +1,91 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Moyenne glissante à somme courante
+// ════════════════════════════════════════════════════════════════
+// Fichier: running_average.h
+// Description: Filtre moyenne glissante O(1), capacité fixe
+//              puissance de 2 (POT_SAMPLES_AZ / POT_SAMPLES_EL)
+// ════════════════════════════════════════════════════════════════
+// L'ancienne moyenne re-sommait tout le buffer à chaque lecture et
+// avançait l'index avec '%' (division logicielle sur AVR). Ici la
+// somme est tenue à jour: on retire l'échantillon le plus ancien et
+// on ajoute le nouveau. Capacité 2^n: index masqué, moyenne par
+// décalage. Tant que le buffer n'est pas plein (fill() non appelé),
+// la moyenne porte sur les échantillons reçus, comme avant.
+//
+// Échantillons positifs uniquement (ADC): le décalage arrondit vers
+// le bas, comme la division entière d'origine.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef RUNNING_AVERAGE_H
+#define RUNNING_AVERAGE_H
+
+#include <Arduino.h>
+
+// log2 d'une puissance de 2 (évalué à la compilation)
+constexpr uint8_t runningAverageShift(uint8_t n) {
+    return (n <= 1) ? 0 : 1 + runningAverageShift(n >> 1);
+}
+
+/**
+ * Moyenne glissante sur N échantillons
+ *
+ * @tparam T   Type échantillon (int pour l'ADC)
+ * @tparam N   Capacité, puissance de 2 (≤ 128)
+ * @tparam Sum Type de la somme (doit contenir N × max(T))
+ */
+template <typename T, uint8_t N, typename Sum = long>
+class RunningAverage {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RunningAverage: N doit être une puissance de 2");
+    static_assert(N <= 128, "RunningAverage: N > 128");
+
+public:
+    RunningAverage() : sum(0), index(0), count(0) {}
+
+    /**
+     * Remplit tout le buffer avec une valeur (démarrage, calibration)
+     */
+    void fill(T value) {
+        for (uint8_t i = 0; i < N; i++) {
+            samples[i] = value;
+        }
+        sum = (Sum)value * N;
+        index = 0;
+        count = N;
+    }
+
+    /**
+     * Ajoute un échantillon et retourne la nouvelle moyenne
+     */
+    T add(T value) {
+        if (count < N) {
+            count++;
+        } else {
+            sum -= samples[index];      // Échantillon le plus ancien
+        }
+        samples[index] = value;
+        sum += value;
+        index = (index + 1) & (N - 1);
+        return average();
+    }
+
+    /**
+     * Moyenne courante (0 si vide)
+     */
+    T average() const {
+        if (count == N) return (T)(sum >> SHIFT);
+        if (count == 0) return 0;
+        return (T)(sum / count);        // Remplissage initial seulement
+    }
+
+    bool full() const { return count == N; }
+
+private:
+    static constexpr uint8_t SHIFT = runningAverageShift(N);
+
+    T samples[N];
+    Sum sum;
+    uint8_t index;      // Prochaine case écrite
+    uint8_t count;      // Échantillons valides (≤ N)
+};
+
+#endif // RUNNING_AVERAGE_H
@@ -0,0 +1,95 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Fusion pas commandés / encodeur
+// ════════════════════════════════════════════════════════════════
+// Fichier: step_fusion.h
+// Description: Position = pas moteur commandés + décalage recalé
+//              lentement sur l'encodeur, en virgule fixe
+// ════════════════════════════════════════════════════════════════
+// Le bruit des pots (±1 LSB ≈ 0.08° sur la table) impose une bande
+// morte de 0.15° / 0.50° (POSITION_TOLERANCE / POSITION_RESTART), et
+// le retard du filtrage (~0.3 s) fait dépasser la cible au freinage.
+// Les pas commandés, eux, sont exacts à court terme (1 micro-pas =
+// 0.002° antenne) mais ignorent jeu, pas perdus et glissements.
+//
+//   position = pas × degrés/pas + décalage
+//
+// - vitesse commandée variable (rampe, approche): décalage figé, la
+//   position suit les pas (pas de retard, pas de bruit)
+// - arrêté depuis FUSION_SETTLE_MS (filtre pot rattrapé): résidu
+//   encodeur - position moyenné sur FUSION_AVERAGE_MS puis ajouté au
+//   décalage d'un bloc (jeu, calibration): une seule retouche
+// - palier à vitesse constante depuis FUSION_SETTLE_MS: le décalage
+//   tend vers encodeur - pas avec la constante de temps FUSION_TAU_MS
+// - écart > FUSION_RESYNC_DEG à l'arrêt (pas perdus, blocage): recalage
+//   immédiat sur l'encodeur
+// - pas non comptés (commande manuelle Nano, liaison texte): la
+//   position reste celle de l'encodeur
+//
+// Source des pas (commandedSteps): compteur du générateur STEP en
+// mode direct (step_generator.h); le Nano ne renvoie pas ses pas, les
+// vitesses VEL envoyées sont intégrées (motor_nano.cpp).
+//
+// Position verrouillée sur les pas (fusionLocked): les moteurs
+// s'arrêtent à FUSION_TOLERANCE et repartent au-delà de FUSION_RESTART.
+//
+// RAM: 2 axes × 21 octets
+// ════════════════════════════════════════════════════════════════
+
+#ifndef STEP_FUSION_H
+#define STEP_FUSION_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "angle.h"
+
+#define FUSION_AZ  0
+#define FUSION_EL  1
+
+struct StepFusion {
+    long offset;                // Encodeur - pas (mdeg, Q8)
+    long rate;                  // Vitesse commandée à la lecture précédente
+    unsigned long steadyMs;     // Durée à vitesse commandée constante
+    long residualSum;           // Arrêt: Σ résidu × dt (mdeg × ms)
+    unsigned long windowMs;     // Arrêt: durée cumulée dans residualSum
+    bool initialized;           // false → décalage recalculé
+};
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Réinitialisation (calibration, reset table): prochaine position =
+ * encodeur, décalage recalculé
+ */
+void fusionReset(StepFusion &f);
+
+/**
+ * Nouvelle lecture encodeur
+ *
+ * @param f         État de l'axe
+ * @param axis      FUSION_AZ ou FUSION_EL
+ * @param encoder   Position encodeur filtrée (millidegrés, non normalisée)
+ * @param dtMs      Temps depuis la lecture précédente
+ * @return Position fusionnée (millidegrés)
+ */
+angle_t fusionUpdate(StepFusion &f, uint8_t axis, angle_t encoder, unsigned long dtMs);
+
+/**
+ * Position de l'axe issue des pas (seuils FUSION_TOLERANCE / RESTART)
+ */
+bool fusionLocked(uint8_t axis);
+
+/**
+ * Pas moteur commandés depuis le démarrage (signés, sens antenne),
+ * fournis par le module moteur actif (motor_stepper.cpp, motor_nano.cpp)
+ *
+ * @param axis  FUSION_AZ ou FUSION_EL
+ * @param steps [out] Compteur de pas
+ * @param rate  [out] Vitesse commandée (unité du module, comparée
+ *              d'une lecture à l'autre: régime établi)
+ * @return false si le mouvement en cours n'est pas compté
+ */
+bool commandedSteps(uint8_t axis, long &steps, long &rate);
+
+#endif // STEP_FUSION_H
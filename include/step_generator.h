@@ -0,0 +1,97 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Générateur d'impulsions STEP sous interruption
+// ════════════════════════════════════════════════════════════════
+// Fichier: step_generator.h
+// Description: Impulsions STEP des TB6600 en arrière-plan (Timer1 Az,
+//              Timer3 El), loop() ne fixe que la vitesse et le sens
+// ════════════════════════════════════════════════════════════════
+// Timer 16 bits en mode CTC, prescaler 8 (tick 0.5 µs). L'ISR de
+// comparaison bascule la broche STEP: une demi-période haut, une
+// demi-période bas (rapport cyclique 50 % comme les anciennes rafales
+// SPEED_FAST / SPEED_SLOW). Chaque front montant compte un pas.
+//
+//   front montant   STEP haut, position += sens
+//   front descendant STEP bas, puis application des changements
+//                   demandés par setStepRate(): arrêt, sens (DIR
+//                   stable une demi-période avant le pas suivant),
+//                   nouvelle période (OCRnA relu par le timer)
+//
+// Un arrêt demandé STEP bas est immédiat: jamais d'impulsion tronquée.
+// Le compteur de pas (getStepPosition) suit les fronts émis, pas les
+// pas réellement faits par le moteur (décrochage non détecté).
+//
+// Vitesses: STEP_RATE_MIN (période max 65536 ticks par phase) à
+// STEP_RATE_MAX (ISR ~2 µs, deux par pas et par axe: 8 % du CPU à
+// 10 000 pas/s sur les deux axes).
+//
+// Timers: Timer1 et Timer3 ne pilotent plus de PWM (broches 11, 12,
+// 2, 3, 5). M1_IN1 (11) / M2_IN1 (3) sont les PWM DC du même axe: un
+// axe est soit pas-à-pas soit DC, jamais les deux.
+//
+// Hors AVR (HAL native): timers émulés par la HAL (halTimerStart),
+// ISR appelées aux instants exacts de l'horloge virtuelle. Toujours
+// compilé sur l'hôte pour le banc --bench-steps.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef STEP_GENERATOR_H
+#define STEP_GENERATOR_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Générateur utilisé: pas-à-pas pilotés directement par le Mega
+#define STEP_GENERATOR_ACTIVE  (ENABLE_STEP_TIMER && !USE_NANO_STEPPER && \
+                                (MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER))
+
+#define STEP_AXIS_AZ  0     // Timer1
+#define STEP_AXIS_EL  1     // Timer3
+
+#define STEP_TIMER_HZ   2000000L                        // 16 MHz / 8
+#define STEP_RATE_MIN   (STEP_TIMER_HZ / 2 / 65536 + 1) // 16 pas/s (période max)
+#define STEP_RATE_MAX   20000L                          // Charge ISR (voir en-tête)
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Initialisation (appelé par setupMotors)
+ * - Broches STEP/DIR en sortie, niveau bas
+ * - Timers configurés, arrêtés
+ */
+void setupStepGenerator();
+
+/**
+ * Vitesse et sens d'un axe (non bloquant, appelé à chaque loop)
+ *
+ * @param axis          STEP_AXIS_AZ ou STEP_AXIS_EL
+ * @param stepsPerSec   Vitesse signée (pas/s): > 0 DIR HIGH (CW/UP),
+ *                      < 0 DIR LOW. |vitesse| < STEP_RATE_MIN → arrêt,
+ *                      bornée à STEP_RATE_MAX
+ *
+ * Axe arrêté: DIR écrit immédiatement, premier pas une demi-période
+ * plus tard. Axe en marche: appliqué au prochain front descendant.
+ */
+void setStepRate(uint8_t axis, long stepsPerSec);
+
+/**
+ * Arrêt des deux axes (STOP, fin de course, coupure)
+ */
+void stopStepGenerators();
+
+/**
+ * Vitesse commandée (pas/s signés, 0 = arrêt demandé)
+ */
+long getStepRate(uint8_t axis);
+
+/**
+ * @return true tant que le timer de l'axe émet des impulsions
+ */
+bool stepGeneratorRunning(uint8_t axis);
+
+/**
+ * Pas émis depuis le démarrage (signé, +1 par front montant DIR HIGH)
+ */
+long getStepPosition(uint8_t axis);
+
+#endif // STEP_GENERATOR_H
@@ -0,0 +1,67 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Recherche dans les tables de correction
+// ════════════════════════════════════════════════════════════════
+// Fichier: table_lookup.h
+// Description: Conversion ADC cumulé → angle par table de points,
+//              segment mémorisé, recherche dichotomique et pentes
+//              précalculées en virgule fixe
+// ════════════════════════════════════════════════════════════════
+// Les tables azCorrectionTable (35 points) et elCorrectionTable
+// (13 points) donnent l'ADC cumulé (LSB 10 bits) de chaque angle,
+// croissant avec l'angle. À chaque lecture encodeur:
+//
+// 1. Segment: la position varie peu entre deux lectures, le segment
+//    précédent (ou un voisin) contient presque toujours la valeur.
+//    Sinon recherche dichotomique (log2(35) ≈ 6 comparaisons).
+// 2. Interpolation: une multiplication et un décalage
+//      angle = début segment + (adc - adc début) × pente >> 16
+//    La pente (millidegrés par unité fine, Q16) est calculée une
+//    fois par segment dans tableLookupRebuild(), plus de division
+//    flottante par lecture.
+//
+// Avant le premier point / après le dernier: extrapolation avec le
+// premier / dernier segment. Segment de largeur nulle: angle du
+// point de début.
+//
+// tableLookupRebuild() doit être appelé après toute modification de
+// la table (chargement EEPROM, reset, calibration Z/S, points C/E).
+// ════════════════════════════════════════════════════════════════
+
+#ifndef TABLE_LOOKUP_H
+#define TABLE_LOOKUP_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "angle.h"
+
+#define TABLE_SLOPE_SHIFT  16   // Pentes en Q16
+
+struct TableLookup {
+    const long *adc;        // Points ADC cumulé (LSB 10 bits)
+    long *slope;            // points - 1 pentes (mdeg par unité fine, Q16)
+    uint8_t points;         // Nombre de points
+    angle_t startMdeg;      // Angle du point 0 (millidegrés)
+    angle_t stepMdeg;       // Pas entre points (millidegrés)
+    uint8_t hint;           // Dernier segment utilisé
+};
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Recalcul des pentes de tous les segments
+ * Appelé après chaque modification de la table
+ */
+void tableLookupRebuild(TableLookup &table);
+
+/**
+ * Conversion ADC cumulé → angle
+ *
+ * @param table Table et pentes (segment mémorisé mis à jour)
+ * @param fine  ADC cumulé en unités fines (LSB << POT_FINE_BITS)
+ * @return Angle en millidegrés
+ */
+angle_t tableLookupMdeg(TableLookup &table, long fine);
+
+#endif // TABLE_LOOKUP_H
@@ -0,0 +1,83 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Balayage automatique des tables
+// ════════════════════════════════════════════════════════════════
+// Fichier: table_sweep.h
+// Description: Remplissage des tables de correction pot (35 points Az,
+//              13 points El) en un seul passage à vitesse constante
+// ════════════════════════════════════════════════════════════════
+// Remplace la saisie manuelle C0, C10 … C340 / E-40 … E80.
+//
+// Départ: antenne arrêtée à un angle réel connu, position approchée
+// dans le sens croissant (jeu réducteur déjà rattrapé). "CSWEEP<deg>"
+// (Az) ou "ESWEEP<deg>" (El) lance l'axe à SWEEP_RATE_DPS par trames
+// VEL (sendNanoSweep): le Nano génère exactement les pas commandés,
+// la référence d'angle est donc
+//   angle(t) = départ + pas commandés(t) / pas par degré
+// Écart résiduel constant: retard de rampe du Nano v²/2a (0.04° à
+// 0.5 °/s et 3 °/s²), équivalent à une erreur sur l'angle de départ.
+//
+// Chaque lecture encodeur (après SWEEP_SETTLE_MS) donne un couple
+// (angle de référence, ADC cumulé fin). Les lectures à ±STEP/2 d'un
+// point de table alimentent une régression linéaire locale (sommes
+// courantes, une seule fenêtre ouverte à la fois); la valeur du point
+// est l'ordonnée de la droite à l'angle exact du point. Le bruit ADC
+// et la quantification se moyennent sur ~400 lectures par point.
+//
+// Fin: dernier point + STEP/2 atteint ou fin de course. Les points
+// hors de la course balayée (El sous la butée basse, départ après 0°)
+// sont extrapolés depuis les deux points ajustés voisins. La table
+// n'est remplacée (EEPROM + pentes) qu'à la fin d'un balayage complet;
+// "S" / "STOP", une commande manuelle ou une perte du Nano l'annulent.
+//
+// Désactiver le suivi PstRotator pendant le balayage: les consignes
+// reçues sont ignorées jusqu'à la fin.
+//
+// RAM: ~200 octets (table en cours + fenêtre de régression)
+// ════════════════════════════════════════════════════════════════
+
+#ifndef TABLE_SWEEP_H
+#define TABLE_SWEEP_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Balayage disponible: trames VEL vers le Nano et pots multi-tours
+#define TABLE_SWEEP_ACTIVE  (ENABLE_TABLE_SWEEP && TEST_MOTORS && TEST_ENCODERS && \
+                             USE_NANO_STEPPER && NANO_VELOCITY_CONTROL && NANO_BINARY_PROTOCOL)
+#define TABLE_SWEEP_AZ      (TABLE_SWEEP_ACTIVE && (ENCODER_AZ_TYPE == ENCODER_POT_MT))
+#define TABLE_SWEEP_EL      (TABLE_SWEEP_ACTIVE && (ENCODER_EL_TYPE == ENCODER_POT_MT))
+
+#define SWEEP_AXIS_AZ  0
+#define SWEEP_AXIS_EL  1
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Démarrage d'un balayage (commandes CSWEEP / ESWEEP)
+ *
+ * @param axis      SWEEP_AXIS_AZ ou SWEEP_AXIS_EL
+ * @param startDeg  Angle réel actuel de l'antenne (référence)
+ * @return false si refusé: balayage en cours, Nano sans trames
+ *         binaires, fin de course active ou départ après le dernier point
+ */
+bool startTableSweep(uint8_t axis, float startDeg);
+
+/**
+ * Échantillonnage et fin de balayage, à appeler dans loop() avant
+ * updateMotorNano()
+ */
+void updateTableSweep();
+
+/**
+ * Annulation (STOP): arrêt de l'axe, table inchangée
+ */
+void abortTableSweep();
+
+/**
+ * @return true pendant un balayage
+ */
+bool tableSweepRunning();
+
+#endif // TABLE_SWEEP_H
@@ -0,0 +1,55 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Télémétrie push (port 5000)
+// ════════════════════════════════════════════════════════════════
+// Fichier: telemetry.h
+// Description: Flux position / cible / état poussé vers les
+//              moniteurs abonnés, sans requête Easycom
+// ════════════════════════════════════════════════════════════════
+// Un client qui se connecte sur TELEMETRY_PORT est abonné: il reçoit
+// une trame à la connexion, puis à chaque changement de position ou
+// de cible d'au moins TELEMETRY_THRESHOLD, au plus toutes les
+// TELEMETRY_PERIOD_MS. Sans changement, une trame est renvoyée toutes
+// les TELEMETRY_HEARTBEAT_MS (preuve de vie). Les octets reçus des
+// abonnés sont ignorés.
+//
+// Trame (une ligne JSON, terminée par \r\n):
+//   {"t":123456,"az":180.5,"el":45.0,"target_az":182.0,"target_el":46.5,"state":"moving"}
+//   t        : millis() à l'émission
+//   target_xx: null si aucune cible
+//   state    : "idle", "moving" ou "limit"
+//
+// Une trame est formatée une seule fois puis écrite en un bloc vers
+// chaque abonné (une rafale SPI par abonné). Un abonné dont le buffer
+// TX W5500 est plein saute la trame au lieu de bloquer la boucle.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Démarrage serveur télémétrie (après Ethernet.begin)
+ */
+void setupTelemetry();
+
+/**
+ * Gestion abonnés et émission des trames (appelé par handleNetwork)
+ *
+ * - Accepte les nouveaux abonnés (TELEMETRY_MAX_CLIENTS max)
+ * - Ferme les abonnés déconnectés
+ * - Émet une trame si changement ≥ seuil, état modifié ou heartbeat
+ */
+void handleTelemetry();
+
+/**
+ * Nombre d'abonnés connectés
+ */
+uint8_t getTelemetryClientCount();
+
+#endif // TELEMETRY_H
@@ -0,0 +1,85 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Prédicteur de trajectoire
+// ════════════════════════════════════════════════════════════════
+// Fichier: trajectory.h
+// Description: Horodatage des consignes PstRotator, estimation de
+//              la vitesse angulaire, cible interpolée dans le temps
+//              et statistiques d'erreur de poursuite
+// ════════════════════════════════════════════════════════════════
+// PstRotator envoie une consigne AZ/EL toutes les quelques secondes
+// (résolution 0.1°). Sans prédiction, l'asservissement rattrape
+// chaque consigne comme un échelon: l'antenne est toujours en retard.
+//
+// Chaque consigne est horodatée (millis()) et mémorisée par axe. Dès
+// TRAJ_MIN_SAMPLES consignes cohérentes, une droite des moindres
+// carrés donne position et vitesse: la cible devient
+//   position ajustée + vitesse × (maintenant - dernière consigne)
+// et la vitesse sert d'anticipation à la commande en vitesse
+// (targetRateAz/El, motor_nano.cpp).
+//
+// Nouvelle consigne à plus de TRAJ_JUMP_DEG de la prédiction
+// (ralliement) ou silence de TRAJ_TIMEOUT_MS → historique effacé,
+// retour à la consigne fixe.
+//
+// Régression float à la réception d'une consigne uniquement; la
+// cible interpolée (appelée à chaque mise à jour moteur) est calculée
+// en virgule fixe (angle.h).
+//
+// RAM: 2 axes × (TRAJ_HISTORY × 8 + 30) octets
+// ════════════════════════════════════════════════════════════════
+
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "angle.h"
+
+#define TRAJ_AZ  0
+#define TRAJ_EL  1
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Nouvelle consigne reçue (commande Easycom GOTO)
+ *
+ * @param axis  TRAJ_AZ ou TRAJ_EL
+ * @param value Consigne (degrés)
+ */
+void trajectorySetpoint(uint8_t axis, float value);
+
+/**
+ * Effacement des historiques (STOP, mode manuel)
+ */
+void trajectoryReset();
+
+/**
+ * Cible interpolée à l'instant courant
+ *
+ * @param axis     TRAJ_AZ ou TRAJ_EL
+ * @param position Consigne fixe en entrée, cible interpolée en sortie
+ * @param rate     Vitesse estimée (mdeg/s), 0 hors poursuite
+ * @return true si poursuite active (vitesse estimée)
+ */
+bool trajectoryTarget(uint8_t axis, angle_t &position, long &rate);
+
+/**
+ * Enregistrement de l'erreur de poursuite (cible interpolée - position, mdeg)
+ * Appelé par l'asservissement à chaque mise à jour en poursuite
+ */
+void trajectoryRecordError(uint8_t axis, angle_t error);
+
+/**
+ * Rapport via sendToClient (commande "TRK")
+ * Par axe: vitesse estimée, consignes en mémoire, erreur RMS / max
+ */
+void printTrajectoryReport();
+
+/**
+ * Remise à zéro des statistiques d'erreur (commande "TRKCLR")
+ */
+void trajectoryClearStats();
+
+#endif // TRAJECTORY_H
@@ -0,0 +1,220 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (API Arduino sur Linux)
+// ════════════════════════════════════════════════════════════════
+// Fichier: Arduino.h
+// Description: Remplace le core Arduino AVR pour l'environnement
+//              [env:native]. Les modules du firmware (src/*.cpp)
+//              compilent SANS modification et setup()/loop() de
+//              main.cpp tournent comme un processus Linux.
+// ════════════════════════════════════════════════════════════════
+// Couches émulées (voir hal_native.h pour le pilotage côté hôte):
+//   - Horloge : millis(), micros(), delay(), delayMicroseconds()
+//   - GPIO    : pinMode(), digitalWrite(), digitalRead()
+//   - ADC     : analogRead() (valeurs injectées par les modèles)
+//   - PWM     : analogWrite() (rapport cyclique mémorisé)
+//   - Timers  : Timer1/3/4/5 en mode CTC réduits à leur ISR COMPA
+//   - UART    : Serial, Serial1, Serial2, Serial3 (HardwareSerial.h)
+//   - EEPROM  : 4096 octets persistés dans un fichier (EEPROM.h)
+//   - TCP     : EthernetServer/EthernetClient sur sockets POSIX (Ethernet.h)
+// ════════════════════════════════════════════════════════════════
+
+#ifndef ARDUINO_H_NATIVE
+#define ARDUINO_H_NATIVE
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <ctype.h>
+#include <type_traits>
+
+// Identification plateforme (le firmware peut tester NATIVE_HAL)
+#ifndef NATIVE_HAL
+    #define NATIVE_HAL 1
+#endif
+#ifndef ARDUINO
+    #define ARDUINO 10819
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// TYPES ET CONSTANTES ARDUINO
+// ════════════════════════════════════════════════════════════════
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH          0x1
+#define LOW           0x0
+
+#define INPUT         0x0
+#define OUTPUT        0x1
+#define INPUT_PULLUP  0x2
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define PI          3.1415926535897932384626433832795
+#define HALF_PI     1.5707963267948966192313216916398
+#define TWO_PI      6.283185307179586476925286766559
+#define DEG_TO_RAD  0.017453292519943295769236907684886
+#define RAD_TO_DEG  57.295779513082320876798154814105
+
+// ─────────────────────────────────────────────────────────────────
+// BROCHAGE ARDUINO MEGA 2560 (70 pins, A0 = pin 54)
+// ─────────────────────────────────────────────────────────────────
+#define NUM_DIGITAL_PINS  70
+#define NUM_ANALOG_INPUTS 16
+
+static const uint8_t A0  = 54;
+static const uint8_t A1  = 55;
+static const uint8_t A2  = 56;
+static const uint8_t A3  = 57;
+static const uint8_t A4  = 58;
+static const uint8_t A5  = 59;
+static const uint8_t A6  = 60;
+static const uint8_t A7  = 61;
+static const uint8_t A8  = 62;
+static const uint8_t A9  = 63;
+static const uint8_t A10 = 64;
+static const uint8_t A11 = 65;
+static const uint8_t A12 = 66;
+static const uint8_t A13 = 67;
+static const uint8_t A14 = 68;
+static const uint8_t A15 = 69;
+
+// ─────────────────────────────────────────────────────────────────
+// PROGMEM / F() : pas de mémoire flash séparée sur l'hôte
+// ─────────────────────────────────────────────────────────────────
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+#define PSTR(s)              (s)
+#define PROGMEM
+#define pgm_read_byte(addr)  (*(const uint8_t *)(addr))
+#define pgm_read_word(addr)  (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define strcpy_P             strcpy
+#define strcmp_P             strcmp
+#define strlen_P             strlen
+
+// ════════════════════════════════════════════════════════════════
+// UTILITAIRES MATHÉMATIQUES (équivalents des macros Arduino)
+// ════════════════════════════════════════════════════════════════
+// Templates au lieu de macros: les macros min/max/abs d'Arduino
+// casseraient les en-têtes de la bibliothèque standard C++.
+
+template <typename T, typename U>
+inline typename std::common_type<T, U>::type min(T a, U b) { return (a < b) ? a : b; }
+
+template <typename T, typename U>
+inline typename std::common_type<T, U>::type max(T a, U b) { return (a > b) ? a : b; }
+
+template <typename T, typename L, typename H>
+inline T constrain(T amt, L low, H high) {
+    return (amt < low) ? (T)low : ((amt > high) ? (T)high : amt);
+}
+
+template <typename T>
+inline T sq(T x) { return x * x; }
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+#define radians(deg) ((deg) * DEG_TO_RAD)
+#define degrees(rad) ((rad) * RAD_TO_DEG)
+
+#define lowByte(w)   ((uint8_t)((w) & 0xff))
+#define highByte(w)  ((uint8_t)((w) >> 8))
+#define bit(b)       (1UL << (b))
+#define bitRead(value, b)  (((value) >> (b)) & 0x01)
+#define bitSet(value, b)   ((value) |= (1UL << (b)))
+#define bitClear(value, b) ((value) &= ~(1UL << (b)))
+#define bitWrite(value, b, bitvalue) ((bitvalue) ? bitSet(value, b) : bitClear(value, b))
+
+// ─────────────────────────────────────────────────────────────────
+// CARACTÈRES (WCharacter.h)
+// ─────────────────────────────────────────────────────────────────
+inline bool isDigit(int c)        { return isdigit(c) != 0; }
+inline bool isAlpha(int c)        { return isalpha(c) != 0; }
+inline bool isAlphaNumeric(int c) { return isalnum(c) != 0; }
+inline bool isSpace(int c)        { return isspace(c) != 0; }
+inline bool isWhitespace(int c)   { return c == ' ' || c == '\t'; }
+inline bool isUpperCase(int c)    { return isupper(c) != 0; }
+inline bool isLowerCase(int c)    { return islower(c) != 0; }
+inline bool isHexadecimalDigit(int c) { return isxdigit(c) != 0; }
+inline bool isPrintable(int c)    { return isprint(c) != 0; }
+
+// ─────────────────────────────────────────────────────────────────
+// CONVERSIONS avr-libc (stdlib.h AVR, absentes de la libc hôte)
+// ─────────────────────────────────────────────────────────────────
+char *dtostrf(double val, signed char width, unsigned char prec, char *s);
+char *ultoa(unsigned long val, char *s, int radix);
+char *ltoa(long val, char *s, int radix);
+
+// ════════════════════════════════════════════════════════════════
+// API TEMPS
+// ════════════════════════════════════════════════════════════════
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// ════════════════════════════════════════════════════════════════
+// API GPIO / ADC / PWM
+// ════════════════════════════════════════════════════════════════
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int val);
+void analogReference(uint8_t mode);
+
+// Interruptions: sections critiques sans effet (un seul thread hôte)
+inline void interrupts() {}
+inline void noInterrupts() {}
+
+// ════════════════════════════════════════════════════════════════
+// TIMERS 16 BITS (remplacent TCCRn / OCRnA / TIMSKn hors AVR)
+// ════════════════════════════════════════════════════════════════
+// Mode CTC, prescaler 8: tick de 0.5 µs, période 1 à 65535 ticks.
+// L'ISR est appelée à chaque comparaison, à l'instant exact en
+// horloge virtuelle (halAdvanceMicros découpe l'avance); une période
+// changée dans l'ISR vaut pour l'intervalle qui commence, comme OCRnA
+// relu après la remise à zéro de TCNTn. Pas d'imbrication: un delay()
+// dans l'ISR n'exécute pas les autres timers.
+
+#define HAL_TIMER_TICKS_PER_US  2
+#define HAL_TIMER_COUNT         6       // Numéros AVR 0..5 (1, 3, 4, 5 utiles)
+
+typedef void (*HalTimerIsr)();
+
+void halTimerStart(uint8_t timer, uint16_t ticks, HalTimerIsr isr);
+void halTimerSetCompare(uint8_t timer, uint16_t ticks);
+void halTimerStop(uint8_t timer);
+
+// ════════════════════════════════════════════════════════════════
+// ALÉATOIRE
+// ════════════════════════════════════════════════════════════════
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// ════════════════════════════════════════════════════════════════
+// POINTS D'ENTRÉE SKETCH (définis dans src/main.cpp)
+// ════════════════════════════════════════════════════════════════
+
+void setup();
+void loop();
+
+#include "WString.h"
+#include "HardwareSerial.h"
+
+#endif // ARDUINO_H_NATIVE
@@ -0,0 +1,72 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (EEPROM)
+// ════════════════════════════════════════════════════════════════
+// Fichier: EEPROM.cpp
+// Description: EEPROM émulée persistée dans un fichier binaire
+// ════════════════════════════════════════════════════════════════
+
+#include "EEPROM.h"
+
+#include <stdio.h>
+
+EEPROMClass EEPROM;
+
+EEPROMClass::EEPROMClass() : totalWrites(0), dirty(false) {
+    // EEPROM vierge AVR: tous les octets à 0xFF
+    memset(data, 0xFF, sizeof(data));
+    memset(writeCounts, 0, sizeof(writeCounts));
+    path[0] = '\0';
+}
+
+// ════════════════════════════════════════════════════════════════
+// API ARDUINO
+// ════════════════════════════════════════════════════════════════
+
+uint8_t EEPROMClass::read(int idx) const {
+    if (idx < 0 || idx > E2END) return 0xFF;
+    return data[idx];
+}
+
+void EEPROMClass::write(int idx, uint8_t val) {
+    if (idx < 0 || idx > E2END) return;
+    data[idx] = val;
+    writeCounts[idx]++;
+    totalWrites++;
+    dirty = true;
+}
+
+void EEPROMClass::update(int idx, uint8_t val) {
+    if (idx < 0 || idx > E2END) return;
+    if (data[idx] != val) write(idx, val);
+}
+
+// ════════════════════════════════════════════════════════════════
+// PERSISTANCE
+// ════════════════════════════════════════════════════════════════
+
+bool EEPROMClass::hostLoad(const char *file) {
+    strncpy(path, file, sizeof(path) - 1);
+    path[sizeof(path) - 1] = '\0';
+
+    FILE *f = fopen(path, "rb");
+    if (f == nullptr) return false;
+    size_t n = fread(data, 1, sizeof(data), f);
+    fclose(f);
+    dirty = false;
+    return n == sizeof(data);
+}
+
+bool EEPROMClass::hostSave() {
+    if (!dirty || path[0] == '\0') return true;
+    FILE *f = fopen(path, "wb");
+    if (f == nullptr) return false;
+    size_t n = fwrite(data, 1, sizeof(data), f);
+    fclose(f);
+    dirty = false;
+    return n == sizeof(data);
+}
+
+uint32_t EEPROMClass::hostWriteCount(int idx) const {
+    if (idx < 0 || idx > E2END) return 0;
+    return writeCounts[idx];
+}
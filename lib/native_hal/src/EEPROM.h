@@ -0,0 +1,96 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (EEPROM)
+// ════════════════════════════════════════════════════════════════
+// Fichier: EEPROM.h
+// Description: EEPROM 4 Ko du Mega émulée en RAM et persistée dans
+//              un fichier binaire entre deux exécutions.
+// ════════════════════════════════════════════════════════════════
+// Largeur des types:
+//   Sur l'hôte 64 bits, sizeof(long) = 8 alors que l'AVR stocke 4
+//   octets. put()/get() convertissent long/unsigned long en 32 bits
+//   et double en float afin que le fichier ait EXACTEMENT la même
+//   image que l'EEPROM réelle (adresses et contenu).
+//
+// Usure:
+//   put()/update() n'écrivent que les octets modifiés (comme l'AVR)
+//   et chaque écriture effective incrémente un compteur par cellule
+//   (hostWriteCount) pour évaluer l'usure (100 000 cycles garantis).
+// ════════════════════════════════════════════════════════════════
+
+#ifndef EEPROM_H_NATIVE
+#define EEPROM_H_NATIVE
+
+#include <stdint.h>
+#include <string.h>
+
+#define E2END 0xFFF
+
+// ─────────────────────────────────────────────────────────────────
+// STOCKAGE AVR DES TYPES HÔTE
+// ─────────────────────────────────────────────────────────────────
+template <typename T> struct EepromAvrType { typedef T type; };
+template <> struct EepromAvrType<long> { typedef int32_t type; };
+template <> struct EepromAvrType<unsigned long> { typedef uint32_t type; };
+template <> struct EepromAvrType<double> { typedef float type; };
+
+class EEPROMClass {
+public:
+    EEPROMClass();
+
+    // ─────────────────────────────────────────────────────────────
+    // API ARDUINO
+    // ─────────────────────────────────────────────────────────────
+    uint8_t read(int idx) const;
+    void write(int idx, uint8_t val);
+    void update(int idx, uint8_t val);
+    uint16_t length() const { return E2END + 1; }
+
+    template <typename T>
+    T &get(int idx, T &t) const {
+        typedef typename EepromAvrType<T>::type Stored;
+        Stored s;
+        uint8_t *p = (uint8_t *)&s;
+        for (unsigned int i = 0; i < sizeof(Stored); i++) p[i] = read(idx + i);
+        t = (T)s;
+        return t;
+    }
+
+    template <typename T>
+    const T &put(int idx, const T &t) {
+        typedef typename EepromAvrType<T>::type Stored;
+        Stored s = (Stored)t;
+        const uint8_t *p = (const uint8_t *)&s;
+        for (unsigned int i = 0; i < sizeof(Stored); i++) update(idx + i, p[i]);
+        return t;
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // PILOTAGE CÔTÉ HÔTE
+    // ─────────────────────────────────────────────────────────────
+    /**
+     * Associe un fichier image et le charge s'il existe (sinon 0xFF)
+     */
+    bool hostLoad(const char *path);
+
+    /**
+     * Réécrit le fichier image si le contenu a changé
+     */
+    bool hostSave();
+
+    /**
+     * Nombre d'écritures effectives de la cellule idx depuis le lancement
+     */
+    uint32_t hostWriteCount(int idx) const;
+    uint32_t hostTotalWrites() const { return totalWrites; }
+
+private:
+    uint8_t data[E2END + 1];
+    uint32_t writeCounts[E2END + 1];
+    uint32_t totalWrites;
+    bool dirty;
+    char path[256];
+};
+
+extern EEPROMClass EEPROM;
+
+#endif // EEPROM_H_NATIVE
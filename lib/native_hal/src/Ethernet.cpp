@@ -0,0 +1,280 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (Ethernet W5500)
+// ════════════════════════════════════════════════════════════════
+// Fichier: Ethernet.cpp
+// Description: Serveur/clients TCP sur sockets POSIX non bloquantes
+// ════════════════════════════════════════════════════════════════
+
+#include "Ethernet.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/sockios.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+
+EthernetClass Ethernet;
+
+// ════════════════════════════════════════════════════════════════
+// TABLE DES SOCKETS (équivalent des 8 sockets matérielles W5500)
+// ════════════════════════════════════════════════════════════════
+
+#define SOCK_RX_SIZE 2048
+#define SOCK_TX_SIZE 2048
+
+struct NativeSocket {
+    int fd;                     // -1 si libre
+    uint16_t localPort;         // Port du serveur propriétaire
+    bool peerClosed;            // FIN reçu (données restantes lisibles)
+    bool announced;             // Déjà renvoyé par accept()
+    uint8_t rx[SOCK_RX_SIZE];
+    uint16_t rxHead;
+    uint16_t rxLen;
+    IPAddress remoteAddr;
+    uint16_t remotePortNum;
+};
+
+static NativeSocket sockets[MAX_SOCK_NUM];
+static bool socketsInitialized = false;
+
+static void initSockets() {
+    if (socketsInitialized) return;
+    for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+        sockets[i].fd = -1;
+        sockets[i].rxHead = 0;
+        sockets[i].rxLen = 0;
+        sockets[i].peerClosed = false;
+    }
+    socketsInitialized = true;
+}
+
+static void setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags >= 0) fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+// Transfert du noyau vers le buffer de la socket (non bloquant)
+static void pollSocket(uint8_t s) {
+    NativeSocket &sock = sockets[s];
+    if (sock.fd < 0 || sock.peerClosed) return;
+
+    // Compactage: données non lues ramenées en tête de buffer
+    if (sock.rxHead > 0 && sock.rxLen > 0) {
+        memmove(sock.rx, sock.rx + sock.rxHead, sock.rxLen);
+    }
+    sock.rxHead = 0;
+
+    size_t room = SOCK_RX_SIZE - sock.rxLen;
+    if (room == 0) return;
+
+    ssize_t n = recv(sock.fd, sock.rx + sock.rxLen, room, 0);
+    if (n > 0) {
+        sock.rxLen += (uint16_t)n;
+    } else if (n == 0) {
+        sock.peerClosed = true;
+    } else if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        sock.peerClosed = true;
+    }
+}
+
+static void closeSocket(uint8_t s) {
+    if (s >= MAX_SOCK_NUM) return;
+    NativeSocket &sock = sockets[s];
+    if (sock.fd >= 0) close(sock.fd);
+    sock.fd = -1;
+    sock.rxHead = 0;
+    sock.rxLen = 0;
+    sock.peerClosed = false;
+}
+
+// ════════════════════════════════════════════════════════════════
+// CONTRÔLEUR
+// ════════════════════════════════════════════════════════════════
+
+void EthernetClass::begin(uint8_t *mac, IPAddress ip, IPAddress dns, IPAddress gateway, IPAddress subnet) {
+    (void)mac; (void)dns; (void)gateway; (void)subnet;
+    initSockets();
+    localAddress = ip;
+}
+
+void EthernetClass::begin(uint8_t *mac, IPAddress ip) {
+    begin(mac, ip, ip, ip, IPAddress(255, 255, 255, 0));
+}
+
+// ════════════════════════════════════════════════════════════════
+// CLIENT
+// ════════════════════════════════════════════════════════════════
+
+uint8_t EthernetClient::connected() {
+    if (sockindex >= MAX_SOCK_NUM) return 0;
+    NativeSocket &sock = sockets[sockindex];
+    if (sock.fd < 0) return 0;
+    pollSocket(sockindex);
+    // Comme le W5500: reste "connecté" tant que des données sont lisibles
+    return (!sock.peerClosed || sock.rxLen > 0) ? 1 : 0;
+}
+
+int EthernetClient::available() {
+    if (sockindex >= MAX_SOCK_NUM || sockets[sockindex].fd < 0) return 0;
+    pollSocket(sockindex);
+    return sockets[sockindex].rxLen;
+}
+
+int EthernetClient::read() {
+    uint8_t b;
+    if (read(&b, 1) == 1) return b;
+    return -1;
+}
+
+int EthernetClient::read(uint8_t *buf, size_t size) {
+    if (sockindex >= MAX_SOCK_NUM) return -1;
+    NativeSocket &sock = sockets[sockindex];
+    if (sock.rxLen == 0) pollSocket(sockindex);
+    if (sock.rxLen == 0) return -1;
+    size_t n = size < sock.rxLen ? size : sock.rxLen;
+    memcpy(buf, sock.rx + sock.rxHead, n);
+    sock.rxHead += (uint16_t)n;
+    sock.rxLen -= (uint16_t)n;
+    return (int)n;
+}
+
+int EthernetClient::peek() {
+    if (sockindex >= MAX_SOCK_NUM) return -1;
+    NativeSocket &sock = sockets[sockindex];
+    if (sock.rxLen == 0) pollSocket(sockindex);
+    if (sock.rxLen == 0) return -1;
+    return sock.rx[sock.rxHead];
+}
+
+size_t EthernetClient::write(uint8_t b) {
+    return write(&b, 1);
+}
+
+size_t EthernetClient::write(const uint8_t *buf, size_t size) {
+    if (sockindex >= MAX_SOCK_NUM || sockets[sockindex].fd < 0) return 0;
+    ssize_t n = send(sockets[sockindex].fd, buf, size, MSG_NOSIGNAL);
+    return n < 0 ? 0 : (size_t)n;
+}
+
+int EthernetClient::availableForWrite() {
+    // Place libre dans un buffer TX de la taille W5500 (2 Ko par socket)
+    if (sockindex >= MAX_SOCK_NUM || sockets[sockindex].fd < 0) return 0;
+    int queued = 0;
+    if (ioctl(sockets[sockindex].fd, SIOCOUTQ, &queued) < 0) queued = 0;
+    return queued >= SOCK_TX_SIZE ? 0 : SOCK_TX_SIZE - queued;
+}
+
+void EthernetClient::stop() {
+    closeSocket(sockindex);
+    sockindex = MAX_SOCK_NUM;
+}
+
+IPAddress EthernetClient::remoteIP() {
+    if (sockindex >= MAX_SOCK_NUM) return IPAddress();
+    return sockets[sockindex].remoteAddr;
+}
+
+uint16_t EthernetClient::remotePort() {
+    if (sockindex >= MAX_SOCK_NUM) return 0;
+    return sockets[sockindex].remotePortNum;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SERVEUR
+// ════════════════════════════════════════════════════════════════
+
+void EthernetServer::begin() {
+    initSockets();
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) return;
+
+    int yes = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+
+    if (bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        listen(listenFd, MAX_SOCK_NUM) < 0) {
+        close(listenFd);
+        listenFd = -1;
+        return;
+    }
+    setNonBlocking(listenFd);
+}
+
+void EthernetServer::acceptPending() {
+    if (listenFd < 0) return;
+
+    for (;;) {
+        // Socket libre? Sinon la connexion reste dans le backlog (comme W5500)
+        uint8_t s = MAX_SOCK_NUM;
+        for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+            if (sockets[i].fd < 0) { s = i; break; }
+        }
+        if (s == MAX_SOCK_NUM) return;
+
+        struct sockaddr_in peer;
+        socklen_t len = sizeof(peer);
+        int fd = ::accept(listenFd, (struct sockaddr *)&peer, &len);
+        if (fd < 0) return;
+
+        setNonBlocking(fd);
+        int yes = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+
+        NativeSocket &sock = sockets[s];
+        sock.fd = fd;
+        sock.localPort = port;
+        sock.peerClosed = false;
+        sock.announced = false;
+        sock.rxHead = 0;
+        sock.rxLen = 0;
+        sock.remoteAddr = IPAddress(peer.sin_addr.s_addr);
+        sock.remotePortNum = ntohs(peer.sin_port);
+    }
+}
+
+EthernetClient EthernetServer::available() {
+    acceptPending();
+    for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+        if (sockets[i].fd < 0 || sockets[i].localPort != port) continue;
+        pollSocket(i);
+        if (sockets[i].rxLen > 0) return EthernetClient(i);
+    }
+    return EthernetClient();
+}
+
+EthernetClient EthernetServer::accept() {
+    // Renvoie chaque nouvelle connexion une seule fois, même sans données
+    acceptPending();
+    for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+        if (sockets[i].fd < 0 || sockets[i].localPort != port) continue;
+        if (sockets[i].announced) continue;
+        sockets[i].announced = true;
+        return EthernetClient(i);
+    }
+    return EthernetClient();
+}
+
+size_t EthernetServer::write(uint8_t b) {
+    return write(&b, 1);
+}
+
+size_t EthernetServer::write(const uint8_t *buf, size_t size) {
+    acceptPending();
+    for (uint8_t i = 0; i < MAX_SOCK_NUM; i++) {
+        if (sockets[i].fd >= 0 && sockets[i].localPort == port) {
+            send(sockets[i].fd, buf, size, MSG_NOSIGNAL);
+        }
+    }
+    return size;
+}
@@ -0,0 +1,115 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (Ethernet W5500)
+// ════════════════════════════════════════════════════════════════
+// Fichier: Ethernet.h
+// Description: Sous-ensemble de la bibliothèque Ethernet 2.0 sur
+//              sockets POSIX. Le serveur écoute sur le port réel de
+//              la machine hôte (PstRotator peut s'y connecter).
+// ════════════════════════════════════════════════════════════════
+// Fidélité W5500:
+//   - MAX_SOCK_NUM = 8 sockets partagées entre tous les serveurs
+//   - server.available() ne renvoie qu'un client AYANT des données
+//   - un client est identifié par son numéro de socket (copiable)
+// ════════════════════════════════════════════════════════════════
+
+#ifndef ETHERNET_H_NATIVE
+#define ETHERNET_H_NATIVE
+
+#include <stdint.h>
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+#define MAX_SOCK_NUM 8
+
+enum EthernetHardwareStatus {
+    EthernetNoHardware,
+    EthernetW5100,
+    EthernetW5200,
+    EthernetW5500
+};
+
+enum EthernetLinkStatus {
+    Unknown,
+    LinkON,
+    LinkOFF
+};
+
+// ════════════════════════════════════════════════════════════════
+// CLIENT
+// ════════════════════════════════════════════════════════════════
+
+class EthernetClient : public Stream {
+public:
+    EthernetClient() : sockindex(MAX_SOCK_NUM) {}
+    explicit EthernetClient(uint8_t s) : sockindex(s) {}
+
+    uint8_t connected();
+    int available() override;
+    int read() override;
+    int read(uint8_t *buf, size_t size);
+    int peek() override;
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+    int availableForWrite() override;
+    void flush() override {}
+    void stop();
+
+    IPAddress remoteIP();
+    uint16_t remotePort();
+    uint8_t getSocketNumber() const { return sockindex; }
+
+    operator bool() { return sockindex < MAX_SOCK_NUM; }
+    bool operator==(const EthernetClient &rhs) const { return sockindex == rhs.sockindex; }
+    bool operator!=(const EthernetClient &rhs) const { return sockindex != rhs.sockindex; }
+
+private:
+    uint8_t sockindex;
+};
+
+// ════════════════════════════════════════════════════════════════
+// SERVEUR
+// ════════════════════════════════════════════════════════════════
+
+class EthernetServer : public Print {
+public:
+    explicit EthernetServer(uint16_t port) : port(port), listenFd(-1) {}
+
+    void begin();
+    EthernetClient available();
+    EthernetClient accept();
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    using Print::write;
+
+    operator bool() { return listenFd >= 0; }
+
+private:
+    uint16_t port;
+    int listenFd;
+
+    void acceptPending();
+};
+
+// ════════════════════════════════════════════════════════════════
+// CONTRÔLEUR
+// ════════════════════════════════════════════════════════════════
+
+class EthernetClass {
+public:
+    void init(uint8_t csPin) { (void)csPin; }
+    void begin(uint8_t *mac, IPAddress ip, IPAddress dns, IPAddress gateway, IPAddress subnet);
+    void begin(uint8_t *mac, IPAddress ip);
+    EthernetHardwareStatus hardwareStatus() { return EthernetW5500; }
+    EthernetLinkStatus linkStatus() { return LinkON; }
+    IPAddress localIP() { return localAddress; }
+    void maintain() {}
+
+private:
+    IPAddress localAddress;
+};
+
+extern EthernetClass Ethernet;
+
+#endif // ETHERNET_H_NATIVE
@@ -0,0 +1,144 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (UART)
+// ════════════════════════════════════════════════════════════════
+// Fichier: HardwareSerial.cpp
+// Description: Implémentation hôte des ports série du Mega
+// ════════════════════════════════════════════════════════════════
+
+#include "Arduino.h"
+#include "hal_native.h"
+
+#include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+HardwareSerial Serial3(3);
+
+HardwareSerial::HardwareSerial(uint8_t index)
+    : index(index), baud(9600), txHook(nullptr), txHookCtx(nullptr),
+      stdinBound(false), stdoutBound(false), txBusyUntilUs(0), txCount(0) {
+}
+
+// ════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ════════════════════════════════════════════════════════════════
+
+void HardwareSerial::begin(unsigned long baudRate) {
+    baud = baudRate ? baudRate : 9600;
+    txBusyUntilUs = 0;
+}
+
+void HardwareSerial::end() {
+    flush();
+    rxQueue.clear();
+}
+
+uint32_t HardwareSerial::byteTimeUs() const {
+    // 8N1 = 10 bits par octet
+    return (uint32_t)((10UL * 1000000UL + baud - 1) / baud);
+}
+
+// ════════════════════════════════════════════════════════════════
+// RÉCEPTION
+// ════════════════════════════════════════════════════════════════
+
+void HardwareSerial::pollStdin() {
+    if (!stdinBound) return;
+    uint8_t buf[64];
+    ssize_t n = ::read(STDIN_FILENO, buf, sizeof(buf));
+    for (ssize_t i = 0; i < n; i++) {
+        rxQueue.push_back(buf[i]);
+    }
+}
+
+int HardwareSerial::available() {
+    pollStdin();
+    return (int)rxQueue.size();
+}
+
+int HardwareSerial::peek() {
+    pollStdin();
+    if (rxQueue.empty()) return -1;
+    return rxQueue.front();
+}
+
+int HardwareSerial::read() {
+    pollStdin();
+    if (rxQueue.empty()) return -1;
+    uint8_t c = rxQueue.front();
+    rxQueue.pop_front();
+    return c;
+}
+
+// ════════════════════════════════════════════════════════════════
+// ÉMISSION
+// ════════════════════════════════════════════════════════════════
+
+int HardwareSerial::availableForWrite() {
+    if (halGetClockMode() != HAL_CLOCK_VIRTUAL) return SERIAL_TX_BUFFER_SIZE - 1;
+    uint64_t now = halNowMicros();
+    if (txBusyUntilUs <= now) return SERIAL_TX_BUFFER_SIZE - 1;
+    uint64_t pending = (txBusyUntilUs - now + byteTimeUs() - 1) / byteTimeUs();
+    if (pending >= SERIAL_TX_BUFFER_SIZE - 1) return 0;
+    return (int)(SERIAL_TX_BUFFER_SIZE - 1 - pending);
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (halGetClockMode() == HAL_CLOCK_VIRTUAL) {
+        // Buffer plein: attente de la place comme le core AVR
+        uint64_t now = halNowMicros();
+        uint64_t capacityUs = (uint64_t)(SERIAL_TX_BUFFER_SIZE - 1) * byteTimeUs();
+        if (txBusyUntilUs > now + capacityUs) {
+            halAdvanceMicros(txBusyUntilUs - now - capacityUs);
+            now = halNowMicros();
+        }
+        txBusyUntilUs = (txBusyUntilUs > now ? txBusyUntilUs : now) + byteTimeUs();
+    }
+
+    txCount++;
+    if (stdoutBound) {
+        fputc(c, stdout);
+        if (c == '\n') fflush(stdout);
+    }
+    if (txHook) txHook(txHookCtx, c);
+    return 1;
+}
+
+void HardwareSerial::flush() {
+    if (halGetClockMode() == HAL_CLOCK_VIRTUAL) {
+        uint64_t now = halNowMicros();
+        if (txBusyUntilUs > now) halAdvanceMicros(txBusyUntilUs - now);
+    }
+    if (stdoutBound) fflush(stdout);
+}
+
+// ════════════════════════════════════════════════════════════════
+// PILOTAGE CÔTÉ HÔTE
+// ════════════════════════════════════════════════════════════════
+
+void HardwareSerial::hostSetTxHook(TxHook hook, void *ctx) {
+    txHook = hook;
+    txHookCtx = ctx;
+}
+
+void HardwareSerial::hostInject(uint8_t c) {
+    rxQueue.push_back(c);
+}
+
+void HardwareSerial::hostInject(const char *str) {
+    while (str && *str) {
+        rxQueue.push_back((uint8_t)*str++);
+    }
+}
+
+void HardwareSerial::hostBindStdio(bool rx, bool tx) {
+    stdinBound = rx;
+    stdoutBound = tx;
+    if (rx) {
+        int flags = fcntl(STDIN_FILENO, F_GETFL, 0);
+        if (flags >= 0) fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
+    }
+}
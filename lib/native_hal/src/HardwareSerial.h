@@ -0,0 +1,96 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (UART)
+// ════════════════════════════════════════════════════════════════
+// Fichier: HardwareSerial.h
+// Description: Serial, Serial1, Serial2, Serial3 du Mega émulés.
+//              Serial peut être relié à stdin/stdout (console,
+//              PstRotator via socat). Les autres ports sont reliés
+//              par l'hôte à des modèles (Nano, Nextion simulés).
+// ════════════════════════════════════════════════════════════════
+// Temps d'émission (mode horloge virtuelle uniquement):
+//   Chaque octet coûte 10 bits / baud. Comme sur AVR, un buffer TX
+//   de 64 octets absorbe les rafales; au-delà write() bloque et
+//   l'horloge avance jusqu'à libération d'une place.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef HARDWARESERIAL_H_NATIVE
+#define HARDWARESERIAL_H_NATIVE
+
+#include <stdint.h>
+#include <deque>
+
+#include "Print.h"
+
+#define SERIAL_TX_BUFFER_SIZE 64
+#define SERIAL_RX_BUFFER_SIZE 64
+
+class HardwareSerial : public Stream {
+public:
+    explicit HardwareSerial(uint8_t index);
+
+    // ─────────────────────────────────────────────────────────────
+    // API ARDUINO
+    // ─────────────────────────────────────────────────────────────
+    void begin(unsigned long baud);
+    void begin(unsigned long baud, uint8_t config) { (void)config; begin(baud); }
+    void end();
+
+    int available() override;
+    int peek() override;
+    int read() override;
+    int availableForWrite() override;
+    void flush() override;
+
+    size_t write(uint8_t c) override;
+    size_t write(unsigned long n) { return write((uint8_t)n); }
+    size_t write(long n) { return write((uint8_t)n); }
+    size_t write(unsigned int n) { return write((uint8_t)n); }
+    size_t write(int n) { return write((uint8_t)n); }
+    using Print::write;
+
+    operator bool() { return true; }
+
+    // ─────────────────────────────────────────────────────────────
+    // PILOTAGE CÔTÉ HÔTE
+    // ─────────────────────────────────────────────────────────────
+    /**
+     * Callback appelé pour chaque octet émis par le firmware
+     */
+    typedef void (*TxHook)(void *ctx, uint8_t c);
+    void hostSetTxHook(TxHook hook, void *ctx);
+
+    /**
+     * Injecte des octets dans le buffer de réception (côté "fil")
+     */
+    void hostInject(uint8_t c);
+    void hostInject(const char *str);
+
+    /**
+     * Relie le port à stdin (réception) et/ou stdout (émission)
+     */
+    void hostBindStdio(bool rx, bool tx);
+
+    unsigned long hostBaud() const { return baud; }
+    unsigned long hostTxCount() const { return txCount; }
+
+private:
+    uint8_t index;
+    unsigned long baud;
+    std::deque<uint8_t> rxQueue;
+    TxHook txHook;
+    void *txHookCtx;
+    bool stdinBound;
+    bool stdoutBound;
+    uint64_t txBusyUntilUs;     // Fin d'émission du dernier octet (horloge virtuelle)
+    unsigned long txCount;
+
+    void pollStdin();
+    uint32_t byteTimeUs() const;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+extern HardwareSerial Serial3;
+
+#endif // HARDWARESERIAL_H_NATIVE
@@ -0,0 +1,47 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (IPAddress)
+// ════════════════════════════════════════════════════════════════
+// Fichier: IPAddress.h
+// Description: Adresse IPv4 imprimable (Serial.println(ip))
+// ════════════════════════════════════════════════════════════════
+
+#ifndef IPADDRESS_H_NATIVE
+#define IPADDRESS_H_NATIVE
+
+#include <stdint.h>
+
+#include "Print.h"
+
+class IPAddress : public Printable {
+public:
+    IPAddress() { bytes[0] = bytes[1] = bytes[2] = bytes[3] = 0; }
+    IPAddress(uint8_t o1, uint8_t o2, uint8_t o3, uint8_t o4) {
+        bytes[0] = o1; bytes[1] = o2; bytes[2] = o3; bytes[3] = o4;
+    }
+    explicit IPAddress(uint32_t address) {
+        for (int i = 0; i < 4; i++) bytes[i] = (uint8_t)(address >> (8 * i));
+    }
+
+    operator uint32_t() const {
+        return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) |
+               ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+    }
+    bool operator==(const IPAddress &addr) const { return (uint32_t)*this == (uint32_t)addr; }
+    uint8_t operator[](int index) const { return bytes[index]; }
+    uint8_t &operator[](int index) { return bytes[index]; }
+
+    size_t printTo(Print &p) const override {
+        size_t n = 0;
+        for (int i = 0; i < 3; i++) {
+            n += p.print(bytes[i], 10);
+            n += p.print('.');
+        }
+        n += p.print(bytes[3], 10);
+        return n;
+    }
+
+private:
+    uint8_t bytes[4];
+};
+
+#endif // IPADDRESS_H_NATIVE
@@ -0,0 +1,149 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (Print)
+// ════════════════════════════════════════════════════════════════
+// Fichier: Print.cpp
+// Description: Formatage identique au core AVR (printNumber/printFloat)
+// ════════════════════════════════════════════════════════════════
+
+#include "Print.h"
+
+#include <math.h>
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (write(*buffer++)) n++;
+        else break;
+    }
+    return n;
+}
+
+// ════════════════════════════════════════════════════════════════
+// PRINT
+// ════════════════════════════════════════════════════════════════
+
+size_t Print::print(const __FlashStringHelper *ifsh) {
+    return write(reinterpret_cast<const char *>(ifsh));
+}
+
+size_t Print::print(const String &s) {
+    return write(s.c_str(), s.length());
+}
+
+size_t Print::print(const char str[]) {
+    return write(str);
+}
+
+size_t Print::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t Print::print(unsigned char b, int base) {
+    return print((unsigned long)b, base);
+}
+
+size_t Print::print(int n, int base) {
+    return print((long)n, base);
+}
+
+size_t Print::print(unsigned int n, int base) {
+    return print((unsigned long)n, base);
+}
+
+size_t Print::print(long n, int base) {
+    if (base == 0) {
+        return write((uint8_t)n);
+    } else if (base == 10) {
+        if (n < 0) {
+            size_t t = print('-');
+            n = -n;
+            return printNumber((unsigned long)n, 10) + t;
+        }
+        return printNumber((unsigned long)n, 10);
+    }
+    return printNumber((unsigned long)n, (uint8_t)base);
+}
+
+size_t Print::print(unsigned long n, int base) {
+    if (base == 0) return write((uint8_t)n);
+    return printNumber(n, (uint8_t)base);
+}
+
+size_t Print::print(double n, int digits) {
+    return printFloat(n, (uint8_t)digits);
+}
+
+size_t Print::print(const Printable &x) {
+    return x.printTo(*this);
+}
+
+// ════════════════════════════════════════════════════════════════
+// PRINTLN
+// ════════════════════════════════════════════════════════════════
+
+size_t Print::println() {
+    return write("\r\n");
+}
+
+size_t Print::println(const __FlashStringHelper *ifsh) { size_t n = print(ifsh); return n + println(); }
+size_t Print::println(const String &s) { size_t n = print(s); return n + println(); }
+size_t Print::println(const char c[]) { size_t n = print(c); return n + println(); }
+size_t Print::println(char c) { size_t n = print(c); return n + println(); }
+size_t Print::println(unsigned char b, int base) { size_t n = print(b, base); return n + println(); }
+size_t Print::println(int num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(unsigned int num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(long num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(unsigned long num, int base) { size_t n = print(num, base); return n + println(); }
+size_t Print::println(double num, int digits) { size_t n = print(num, digits); return n + println(); }
+size_t Print::println(const Printable &x) { size_t n = print(x); return n + println(); }
+
+// ════════════════════════════════════════════════════════════════
+// FORMATAGE INTERNE
+// ════════════════════════════════════════════════════════════════
+
+size_t Print::printNumber(unsigned long n, uint8_t base) {
+    char buf[8 * sizeof(long) + 1];
+    char *str = &buf[sizeof(buf) - 1];
+    *str = '\0';
+    if (base < 2) base = 10;
+    do {
+        char c = (char)(n % base);
+        n /= base;
+        *--str = c < 10 ? c + '0' : c + 'A' - 10;
+    } while (n);
+    return write(str);
+}
+
+size_t Print::printFloat(double number, uint8_t digits) {
+    size_t n = 0;
+
+    if (isnan(number)) return print("nan");
+    if (isinf(number)) return print("inf");
+    if (number > 4294967040.0) return print("ovf");
+    if (number < -4294967040.0) return print("ovf");
+
+    if (number < 0.0) {
+        n += print('-');
+        number = -number;
+    }
+
+    // Arrondi identique au core AVR: +0.5 à la dernière décimale
+    double rounding = 0.5;
+    for (uint8_t i = 0; i < digits; ++i) rounding /= 10.0;
+    number += rounding;
+
+    unsigned long int_part = (unsigned long)number;
+    double remainder = number - (double)int_part;
+    n += print(int_part);
+
+    if (digits > 0) n += print('.');
+
+    while (digits-- > 0) {
+        remainder *= 10.0;
+        unsigned int toPrint = (unsigned int)remainder;
+        n += print(toPrint);
+        remainder -= toPrint;
+    }
+
+    return n;
+}
@@ -0,0 +1,85 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (Print / Printable / Stream)
+// ════════════════════════════════════════════════════════════════
+// Fichier: Print.h
+// Description: Classes de base d'impression Arduino (Serial,
+//              EthernetClient). Même surcharges que le core AVR.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef PRINT_H_NATIVE
+#define PRINT_H_NATIVE
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "WString.h"
+
+class Print;
+
+class Printable {
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print {
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *str) {
+        if (str == nullptr) return 0;
+        return write((const uint8_t *)str, strlen(str));
+    }
+    size_t write(const char *buffer, size_t size) {
+        return write((const uint8_t *)buffer, size);
+    }
+    virtual int availableForWrite() { return 0; }
+    virtual void flush() {}
+
+    size_t print(const __FlashStringHelper *ifsh);
+    size_t print(const String &s);
+    size_t print(const char str[]);
+    size_t print(char c);
+    size_t print(unsigned char b, int base = DEC_BASE);
+    size_t print(int n, int base = DEC_BASE);
+    size_t print(unsigned int n, int base = DEC_BASE);
+    size_t print(long n, int base = DEC_BASE);
+    size_t print(unsigned long n, int base = DEC_BASE);
+    size_t print(double n, int digits = 2);
+    size_t print(const Printable &x);
+
+    size_t println(const __FlashStringHelper *ifsh);
+    size_t println(const String &s);
+    size_t println(const char str[]);
+    size_t println(char c);
+    size_t println(unsigned char b, int base = DEC_BASE);
+    size_t println(int n, int base = DEC_BASE);
+    size_t println(unsigned int n, int base = DEC_BASE);
+    size_t println(long n, int base = DEC_BASE);
+    size_t println(unsigned long n, int base = DEC_BASE);
+    size_t println(double n, int digits = 2);
+    size_t println(const Printable &x);
+    size_t println();
+
+private:
+    static const int DEC_BASE = 10;
+    size_t printNumber(unsigned long n, uint8_t base);
+    size_t printFloat(double number, uint8_t digits);
+};
+
+class Stream : public Print {
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) { timeoutMs = timeout; }
+
+protected:
+    unsigned long timeoutMs = 1000;
+};
+
+#endif // PRINT_H_NATIVE
@@ -0,0 +1,466 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (Classe String)
+// ════════════════════════════════════════════════════════════════
+// Fichier: WString.cpp
+// Description: Implémentation hôte de String (calquée sur le core AVR)
+// ════════════════════════════════════════════════════════════════
+
+#include "WString.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+unsigned long String::hostAllocCount = 0;
+unsigned long String::hostAllocBytes = 0;
+
+// ════════════════════════════════════════════════════════════════
+// CONVERSIONS NUMÉRIQUES (itoa/ltoa/dtostrf du core AVR)
+// ════════════════════════════════════════════════════════════════
+
+static void formatUnsigned(unsigned long value, unsigned char base, char *out) {
+    char tmp[8 * sizeof(long) + 1];
+    char *p = &tmp[sizeof(tmp) - 1];
+    *p = '\0';
+    if (base < 2) base = 10;
+    do {
+        unsigned long digit = value % base;
+        *--p = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        value /= base;
+    } while (value);
+    strcpy(out, p);
+}
+
+static void formatSigned(long value, unsigned char base, char *out) {
+    if (value < 0 && base == 10) {
+        out[0] = '-';
+        formatUnsigned((unsigned long)(-(value + 1)) + 1UL, base, out + 1);
+    } else {
+        formatUnsigned((unsigned long)value, base, out);
+    }
+}
+
+static void formatDouble(double value, unsigned char decimals, char *out, size_t size) {
+    // Équivalent dtostrf(value, decimals + 2, decimals, buf)
+    snprintf(out, size, "%.*f", decimals, value);
+}
+
+char *ultoa(unsigned long val, char *s, int radix) {
+    formatUnsigned(val, (unsigned char)radix, s);
+    return s;
+}
+
+char *ltoa(long val, char *s, int radix) {
+    formatSigned(val, (unsigned char)radix, s);
+    return s;
+}
+
+char *dtostrf(double val, signed char width, unsigned char prec, char *s) {
+    // Largeur négative = alignement à gauche, comme avr-libc
+    sprintf(s, "%*.*f", (int)width, (int)prec, val);
+    return s;
+}
+
+// ════════════════════════════════════════════════════════════════
+// CONSTRUCTEURS
+// ════════════════════════════════════════════════════════════════
+
+String::String(const char *cstr) {
+    init();
+    if (cstr) copy(cstr, strlen(cstr));
+}
+
+String::String(const String &value) {
+    init();
+    *this = value;
+}
+
+String::String(String &&rval) {
+    init();
+    move(rval);
+}
+
+String::String(const __FlashStringHelper *str) {
+    init();
+    *this = str;
+}
+
+String::String(char c) {
+    init();
+    char buf[2] = {c, '\0'};
+    *this = buf;
+}
+
+String::String(unsigned char value, unsigned char base) {
+    init();
+    char buf[1 + 8 * sizeof(unsigned char)];
+    formatUnsigned(value, base, buf);
+    *this = buf;
+}
+
+String::String(int value, unsigned char base) {
+    init();
+    char buf[2 + 8 * sizeof(long)];
+    formatSigned(value, base, buf);
+    *this = buf;
+}
+
+String::String(unsigned int value, unsigned char base) {
+    init();
+    char buf[1 + 8 * sizeof(unsigned long)];
+    formatUnsigned(value, base, buf);
+    *this = buf;
+}
+
+String::String(long value, unsigned char base) {
+    init();
+    char buf[2 + 8 * sizeof(long)];
+    formatSigned(value, base, buf);
+    *this = buf;
+}
+
+String::String(unsigned long value, unsigned char base) {
+    init();
+    char buf[1 + 8 * sizeof(unsigned long)];
+    formatUnsigned(value, base, buf);
+    *this = buf;
+}
+
+String::String(float value, unsigned char decimalPlaces) {
+    init();
+    char buf[64];
+    formatDouble(value, decimalPlaces, buf, sizeof(buf));
+    *this = buf;
+}
+
+String::String(double value, unsigned char decimalPlaces) {
+    init();
+    char buf[64];
+    formatDouble(value, decimalPlaces, buf, sizeof(buf));
+    *this = buf;
+}
+
+String::~String() {
+    free(buffer);
+}
+
+// ════════════════════════════════════════════════════════════════
+// GESTION MÉMOIRE
+// ════════════════════════════════════════════════════════════════
+
+void String::init() {
+    buffer = nullptr;
+    capacity = 0;
+    len = 0;
+}
+
+void String::invalidate() {
+    free(buffer);
+    buffer = nullptr;
+    capacity = len = 0;
+}
+
+bool String::reserve(unsigned int size) {
+    if (buffer && capacity >= size) return true;
+    if (changeBuffer(size)) {
+        if (len == 0) buffer[0] = '\0';
+        return true;
+    }
+    return false;
+}
+
+bool String::changeBuffer(unsigned int maxStrLen) {
+    char *newbuffer = (char *)realloc(buffer, maxStrLen + 1);
+    if (newbuffer) {
+        hostAllocCount++;
+        hostAllocBytes += maxStrLen + 1;
+        buffer = newbuffer;
+        capacity = maxStrLen;
+        return true;
+    }
+    return false;
+}
+
+String &String::copy(const char *cstr, unsigned int length) {
+    if (!reserve(length)) {
+        invalidate();
+        return *this;
+    }
+    len = length;
+    memcpy(buffer, cstr, length);
+    buffer[len] = '\0';
+    return *this;
+}
+
+void String::move(String &rhs) {
+    if (this != &rhs) {
+        free(buffer);
+        buffer = rhs.buffer;
+        capacity = rhs.capacity;
+        len = rhs.len;
+        rhs.buffer = nullptr;
+        rhs.capacity = 0;
+        rhs.len = 0;
+    }
+}
+
+String &String::operator=(const String &rhs) {
+    if (this == &rhs) return *this;
+    if (rhs.buffer) copy(rhs.buffer, rhs.len);
+    else invalidate();
+    return *this;
+}
+
+String &String::operator=(String &&rval) {
+    move(rval);
+    return *this;
+}
+
+String &String::operator=(const char *cstr) {
+    if (cstr) copy(cstr, strlen(cstr));
+    else invalidate();
+    return *this;
+}
+
+String &String::operator=(const __FlashStringHelper *str) {
+    return *this = reinterpret_cast<const char *>(str);
+}
+
+// ════════════════════════════════════════════════════════════════
+// CONCATÉNATION
+// ════════════════════════════════════════════════════════════════
+
+bool String::concat(const char *cstr, unsigned int length) {
+    unsigned int newlen = len + length;
+    if (!cstr) return false;
+    if (length == 0) return true;
+    if (!reserve(newlen)) return false;
+    memmove(buffer + len, cstr, length);
+    len = newlen;
+    buffer[len] = '\0';
+    return true;
+}
+
+bool String::concat(const String &s) {
+    return concat(s.c_str(), s.len);
+}
+
+bool String::concat(const char *cstr) {
+    if (!cstr) return false;
+    return concat(cstr, strlen(cstr));
+}
+
+bool String::concat(char c) {
+    return concat(&c, 1);
+}
+
+bool String::concat(unsigned char num) { return concat(String(num)); }
+bool String::concat(int num) { return concat(String(num)); }
+bool String::concat(unsigned int num) { return concat(String(num)); }
+bool String::concat(long num) { return concat(String(num)); }
+bool String::concat(unsigned long num) { return concat(String(num)); }
+bool String::concat(float num) { return concat(String(num)); }
+bool String::concat(double num) { return concat(String(num)); }
+
+bool String::concat(const __FlashStringHelper *str) {
+    return concat(reinterpret_cast<const char *>(str));
+}
+
+String operator+(const String &lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, const char *rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const char *lhs, const String &rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, char rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, int rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, long rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, unsigned long rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, float rhs) { String s(lhs); s.concat(rhs); return s; }
+String operator+(const String &lhs, double rhs) { String s(lhs); s.concat(rhs); return s; }
+
+// ════════════════════════════════════════════════════════════════
+// COMPARAISON
+// ════════════════════════════════════════════════════════════════
+
+int String::compareTo(const String &s) const {
+    return strcmp(c_str(), s.c_str());
+}
+
+bool String::equals(const String &s2) const {
+    return len == s2.len && compareTo(s2) == 0;
+}
+
+bool String::equals(const char *cstr) const {
+    if (len == 0) return (cstr == nullptr || *cstr == 0);
+    if (cstr == nullptr) return buffer[0] == 0;
+    return strcmp(buffer, cstr) == 0;
+}
+
+bool String::equalsIgnoreCase(const String &s2) const {
+    if (len != s2.len) return false;
+    for (unsigned int i = 0; i < len; i++) {
+        if (tolower((unsigned char)buffer[i]) != tolower((unsigned char)s2.buffer[i])) return false;
+    }
+    return true;
+}
+
+bool String::startsWith(const String &s2) const {
+    if (len < s2.len) return false;
+    return startsWith(s2, 0);
+}
+
+bool String::startsWith(const String &s2, unsigned int offset) const {
+    if (offset > len - s2.len || !buffer || !s2.buffer) return false;
+    return strncmp(&buffer[offset], s2.buffer, s2.len) == 0;
+}
+
+bool String::endsWith(const String &s2) const {
+    if (len < s2.len || !buffer || !s2.buffer) return false;
+    return strcmp(&buffer[len - s2.len], s2.buffer) == 0;
+}
+
+// ════════════════════════════════════════════════════════════════
+// ACCÈS CARACTÈRES
+// ════════════════════════════════════════════════════════════════
+
+char String::charAt(unsigned int loc) const {
+    return operator[](loc);
+}
+
+void String::setCharAt(unsigned int loc, char c) {
+    if (loc < len) buffer[loc] = c;
+}
+
+char &String::operator[](unsigned int index) {
+    static char dummy_writable_char;
+    if (index >= len || !buffer) {
+        dummy_writable_char = 0;
+        return dummy_writable_char;
+    }
+    return buffer[index];
+}
+
+char String::operator[](unsigned int index) const {
+    if (index >= len || !buffer) return 0;
+    return buffer[index];
+}
+
+void String::toCharArray(char *buf, unsigned int bufsize, unsigned int index) const {
+    if (!bufsize || !buf) return;
+    if (index >= len) {
+        buf[0] = 0;
+        return;
+    }
+    unsigned int n = bufsize - 1;
+    if (n > len - index) n = len - index;
+    strncpy(buf, buffer + index, n);
+    buf[n] = 0;
+}
+
+// ════════════════════════════════════════════════════════════════
+// RECHERCHE
+// ════════════════════════════════════════════════════════════════
+
+int String::indexOf(char c) const {
+    return indexOf(c, 0);
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const {
+    if (fromIndex >= len) return -1;
+    const char *temp = strchr(buffer + fromIndex, ch);
+    if (temp == nullptr) return -1;
+    return (int)(temp - buffer);
+}
+
+int String::indexOf(const String &s2) const {
+    return indexOf(s2, 0);
+}
+
+int String::indexOf(const String &s2, unsigned int fromIndex) const {
+    if (fromIndex >= len) return -1;
+    const char *found = strstr(buffer + fromIndex, s2.c_str());
+    if (found == nullptr) return -1;
+    return (int)(found - buffer);
+}
+
+int String::lastIndexOf(char ch) const {
+    if (!buffer) return -1;
+    const char *temp = strrchr(buffer, ch);
+    if (temp == nullptr) return -1;
+    return (int)(temp - buffer);
+}
+
+String String::substring(unsigned int left, unsigned int right) const {
+    if (left > right) {
+        unsigned int temp = right;
+        right = left;
+        left = temp;
+    }
+    String out;
+    if (left >= len) return out;
+    if (right > len) right = len;
+    out.copy(buffer + left, right - left);
+    return out;
+}
+
+// ════════════════════════════════════════════════════════════════
+// MODIFICATION
+// ════════════════════════════════════════════════════════════════
+
+void String::replace(char find, char replace) {
+    if (!buffer) return;
+    for (char *p = buffer; *p; p++) {
+        if (*p == find) *p = replace;
+    }
+}
+
+void String::remove(unsigned int index) {
+    remove(index, (unsigned int)-1);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+    if (index >= len) return;
+    if (count > len - index) count = len - index;
+    char *writeTo = buffer + index;
+    len = len - count;
+    memmove(writeTo, buffer + index + count, len - index);
+    buffer[len] = 0;
+}
+
+void String::toLowerCase() {
+    if (!buffer) return;
+    for (char *p = buffer; *p; p++) *p = (char)tolower((unsigned char)*p);
+}
+
+void String::toUpperCase() {
+    if (!buffer) return;
+    for (char *p = buffer; *p; p++) *p = (char)toupper((unsigned char)*p);
+}
+
+void String::trim() {
+    if (!buffer || len == 0) return;
+    char *begin = buffer;
+    while (isspace((unsigned char)*begin)) begin++;
+    char *end = buffer + len - 1;
+    while (isspace((unsigned char)*end) && end >= begin) end--;
+    len = (unsigned int)(end + 1 - begin);
+    if (begin > buffer) memmove(buffer, begin, len);
+    buffer[len] = 0;
+}
+
+// ════════════════════════════════════════════════════════════════
+// CONVERSION
+// ════════════════════════════════════════════════════════════════
+
+long String::toInt() const {
+    if (buffer) return atol(buffer);
+    return 0;
+}
+
+float String::toFloat() const {
+    return (float)toDouble();
+}
+
+double String::toDouble() const {
+    if (buffer) return atof(buffer);
+    return 0;
+}
@@ -0,0 +1,151 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (Classe String)
+// ════════════════════════════════════════════════════════════════
+// Fichier: WString.h
+// Description: Réimplémentation hôte de la classe String Arduino.
+//              Même stratégie mémoire que le core AVR (buffer
+//              malloc/realloc ajusté à la longueur) afin que le
+//              comportement du tas reste représentatif.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef WSTRING_H_NATIVE
+#define WSTRING_H_NATIVE
+
+#include <stdint.h>
+#include <stddef.h>
+
+class __FlashStringHelper;
+
+class String {
+public:
+    // ─────────────────────────────────────────────────────────────
+    // CONSTRUCTEURS
+    // ─────────────────────────────────────────────────────────────
+    String(const char *cstr = "");
+    String(const String &str);
+    String(String &&rval);
+    explicit String(const __FlashStringHelper *str);
+    explicit String(char c);
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(float value, unsigned char decimalPlaces = 2);
+    explicit String(double value, unsigned char decimalPlaces = 2);
+    ~String();
+
+    // ─────────────────────────────────────────────────────────────
+    // AFFECTATION / CONCATÉNATION
+    // ─────────────────────────────────────────────────────────────
+    String &operator=(const String &rhs);
+    String &operator=(String &&rval);
+    String &operator=(const char *cstr);
+    String &operator=(const __FlashStringHelper *str);
+
+    bool reserve(unsigned int size);
+    bool concat(const String &str);
+    bool concat(const char *cstr);
+    bool concat(const char *cstr, unsigned int length);
+    bool concat(char c);
+    bool concat(unsigned char num);
+    bool concat(int num);
+    bool concat(unsigned int num);
+    bool concat(long num);
+    bool concat(unsigned long num);
+    bool concat(float num);
+    bool concat(double num);
+    bool concat(const __FlashStringHelper *str);
+
+    template <typename T>
+    String &operator+=(const T &rhs) { concat(rhs); return *this; }
+    String &operator+=(const char *cstr) { concat(cstr); return *this; }
+
+    // ─────────────────────────────────────────────────────────────
+    // COMPARAISON
+    // ─────────────────────────────────────────────────────────────
+    int compareTo(const String &s) const;
+    bool equals(const String &s) const;
+    bool equals(const char *cstr) const;
+    bool equalsIgnoreCase(const String &s) const;
+    bool operator==(const String &rhs) const { return equals(rhs); }
+    bool operator==(const char *cstr) const { return equals(cstr); }
+    bool operator!=(const String &rhs) const { return !equals(rhs); }
+    bool operator!=(const char *cstr) const { return !equals(cstr); }
+    bool operator<(const String &rhs) const { return compareTo(rhs) < 0; }
+    bool operator>(const String &rhs) const { return compareTo(rhs) > 0; }
+    bool startsWith(const String &prefix) const;
+    bool startsWith(const String &prefix, unsigned int offset) const;
+    bool endsWith(const String &suffix) const;
+
+    // ─────────────────────────────────────────────────────────────
+    // ACCÈS CARACTÈRES
+    // ─────────────────────────────────────────────────────────────
+    char charAt(unsigned int index) const;
+    void setCharAt(unsigned int index, char c);
+    char operator[](unsigned int index) const;
+    char &operator[](unsigned int index);
+    void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const;
+    const char *c_str() const { return buffer ? buffer : ""; }
+    unsigned int length() const { return len; }
+
+    // ─────────────────────────────────────────────────────────────
+    // RECHERCHE / SOUS-CHAÎNES
+    // ─────────────────────────────────────────────────────────────
+    int indexOf(char ch) const;
+    int indexOf(char ch, unsigned int fromIndex) const;
+    int indexOf(const String &str) const;
+    int indexOf(const String &str, unsigned int fromIndex) const;
+    int lastIndexOf(char ch) const;
+    String substring(unsigned int beginIndex) const { return substring(beginIndex, len); }
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    // ─────────────────────────────────────────────────────────────
+    // MODIFICATION
+    // ─────────────────────────────────────────────────────────────
+    void replace(char find, char replace);
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+
+    // ─────────────────────────────────────────────────────────────
+    // CONVERSION
+    // ─────────────────────────────────────────────────────────────
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+    // ─────────────────────────────────────────────────────────────
+    // STATISTIQUES TAS (hôte uniquement)
+    // ─────────────────────────────────────────────────────────────
+    // Compteurs globaux d'allocations effectuées par toutes les String.
+    // Permettent de mesurer sur PC l'usage du tas qu'aurait le Mega.
+    static unsigned long hostAllocCount;   // Nombre de malloc/realloc
+    static unsigned long hostAllocBytes;   // Octets demandés cumulés
+
+protected:
+    char *buffer;           // Buffer alloué (nullptr si vide)
+    unsigned int capacity;  // Taille utile du buffer (sans '\0')
+    unsigned int len;       // Longueur courante
+
+    void init();
+    void invalidate();
+    bool changeBuffer(unsigned int maxStrLen);
+    String &copy(const char *cstr, unsigned int length);
+    void move(String &rhs);
+};
+
+// Concaténation libre (remplace StringSumHelper du core AVR)
+String operator+(const String &lhs, const String &rhs);
+String operator+(const String &lhs, const char *rhs);
+String operator+(const char *lhs, const String &rhs);
+String operator+(const String &lhs, char rhs);
+String operator+(const String &lhs, int rhs);
+String operator+(const String &lhs, long rhs);
+String operator+(const String &lhs, unsigned long rhs);
+String operator+(const String &lhs, float rhs);
+String operator+(const String &lhs, double rhs);
+
+#endif // WSTRING_H_NATIVE
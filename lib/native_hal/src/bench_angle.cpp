@@ -0,0 +1,403 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure chaîne angle
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_angle.cpp
+// Description: Chaîne position float d'origine vs millidegrés
+// ════════════════════════════════════════════════════════════════
+
+#include "bench_angle.h"
+
+#include "Arduino.h"
+#include "config.h"
+#include "angle.h"
+#include "adc_sampler.h"        // POT_FINE_BITS
+#include "table_lookup.h"
+#include "easycom.h"            // mdegToTenths
+#include "motor_nano.h"         // NANO_STEPS_PER_DEG_AZ, NANO_VEL_SCALE
+#include "bench_clock.h"        // Clock, nsPer(), benchSink
+
+#include <math.h>
+
+// ════════════════════════════════════════════════════════════════
+// TABLE ET SIGNAL DE TEST
+// ════════════════════════════════════════════════════════════════
+
+#define BENCH_POINTS   AZ_TABLE_POINTS
+#define BENCH_DT_MS    20       // Une mise à jour par passage moteur
+
+// Table Az non linéaire (pot multi-tours, ~125 ADC par 10°)
+static long benchTable[BENCH_POINTS];
+static long benchSlopes[BENCH_POINTS];
+
+static void buildTable() {
+    for (int i = 0; i < BENCH_POINTS; i++) {
+        benchTable[i] = 200 + i * 125 + lround(6.0 * sin(i * 0.7));
+    }
+}
+
+// Aller-retour sur la table (hors repli 0/360°) + bruit ±3 unités fines
+static long benchFine(uint32_t &state, unsigned long n) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    long low = (benchTable[0] + 20) << POT_FINE_BITS;
+    long span = ((benchTable[BENCH_POINTS - 1] + 20) << POT_FINE_BITS) - low;
+    long pos = (long)((n / 2) % (2 * span));
+    if (pos >= span) pos = 2 * span - pos;
+    return low + pos + (long)(state % 7) - 3;
+}
+
+// Cible: position idéale + écart lent ±0.4°, poursuite une phase sur deux
+static float benchTarget(unsigned long n, float &rate) {
+    rate = ((n / 20000) % 2) ? 0.004f : 0.0f;
+    return 0.4f * sinf(n * 0.002f);
+}
+
+// ════════════════════════════════════════════════════════════════
+// ANCIENNE CHAÎNE (float, avant angle.h)
+// ════════════════════════════════════════════════════════════════
+
+struct LegacyChain {
+    float filtered = 0;
+    bool initialized = false;
+    float rate = 0;
+    bool moving = false;
+    bool holding = false;           // Bande morte ou anti-inversion active
+    unsigned long scanSteps = 0;    // Comparaisons de balayage (estimation cycles)
+
+    float adcToDegrees(long adc, float fraction) {
+        int lower = -1;
+        for (int i = 0; i < BENCH_POINTS - 1; i++) {
+            scanSteps++;
+            if (adc >= benchTable[i] && adc <= benchTable[i + 1]) {
+                lower = i;
+                break;
+            }
+        }
+        if (lower == -1 && adc < benchTable[0]) lower = 0;
+        if (lower == -1 && adc > benchTable[BENCH_POINTS - 1]) lower = BENCH_POINTS - 2;
+        if (lower == -1) lower = 0;
+
+        long adcLow = benchTable[lower];
+        long adcHigh = benchTable[lower + 1];
+        float angleLow = (float)(lower * AZ_TABLE_STEP);
+        float angleHigh = (float)((lower + 1) * AZ_TABLE_STEP);
+        if (adcHigh == adcLow) return angleLow;
+
+        float ratio = ((float)(adc - adcLow) + fraction) / (float)(adcHigh - adcLow);
+        return angleLow + ratio * (angleHigh - angleLow);
+    }
+
+    float position(long fine) {
+        float raw = adcToDegrees(fine >> POT_FINE_BITS,
+                                 (float)(fine & ((1 << POT_FINE_BITS) - 1)) / (1 << POT_FINE_BITS));
+        if (!initialized) {
+            filtered = raw;
+            initialized = true;
+        } else {
+            filtered = 0.10f * raw + 0.90f * filtered;
+        }
+        float az = filtered;
+        while (az >= 360.0f) az -= 360.0f;
+        while (az < 0.0f) az += 360.0f;
+        if (az > 359.5f) az = 0.0f;
+        return az;
+    }
+
+    float velocity(float target, float current, float targetRate, float dt) {
+        float r = 0.0f;
+        float err = target - current;
+        float hold = moving ? (float)VEL_DEADBAND : (float)VEL_RESTART;
+        holding = true;
+        if (targetRate != 0.0f || fabsf(err) > hold) {
+            r = targetRate + (float)VEL_KP * err;
+            holding = false;
+        }
+        if (targetRate * r < 0.0f && fabsf(err) <= (float)VEL_RESTART) {
+            r = 0.0f;
+            holding = true;
+        }
+        r = constrain(r, -(float)VEL_MAX_DPS, (float)VEL_MAX_DPS);
+        float dv = (float)VEL_ACCEL_DPS2 * dt;
+        r = constrain(r, rate - dv, rate + dv);
+        rate = r;
+        return r;
+    }
+
+    int16_t units(float rateDps) {
+        float u = rateDps * (float)NANO_STEPS_PER_DEG_AZ * NANO_VEL_SCALE;
+        int16_t v = (int16_t)constrain(lround(u), -32767L, 32767L);
+        moving = (v != 0);
+        return v;
+    }
+
+    static int32_t tenths(float value) {
+        double t = fabs((double)value) * 10.0 + 0.5;
+        int32_t key = (int32_t)t;
+        return signbit(value) ? ~key : key;
+    }
+};
+
+// ════════════════════════════════════════════════════════════════
+// NOUVELLE CHAÎNE (millidegrés)
+// ════════════════════════════════════════════════════════════════
+// tableLookupMdeg() et mdegToTenths() du firmware; vitesse recopiée
+// de motor_nano.cpp. EMA Q8 conservée pour comparer à filtre égal
+// (remplacée depuis par position_estimator.h, voir bench_estimator)
+
+#define BENCH_EMA_SHIFT     8
+#define BENCH_EMA_ALPHA_Q8  26
+#define BENCH_KP_Q8         ((long)(VEL_KP * 256.0 + 0.5))
+#define BENCH_ACCEL_Q8      ((long)(VEL_ACCEL_DPS2 * 256.0 + 0.5))
+#define BENCH_UNITS_Q16     ANGLE_SCALE_Q16(NANO_STEPS_PER_DEG_AZ * NANO_VEL_SCALE / 1000.0)
+
+struct FixedChain {
+    TableLookup lookup = {benchTable, benchSlopes, BENCH_POINTS, 0, AZ_TABLE_STEP * 1000L, 0};
+    long filtered = 0;
+    bool initialized = false;
+    long rate = 0;
+    bool moving = false;
+    bool holding = false;
+
+    angle_t position(long fine) {
+        angle_t raw = tableLookupMdeg(lookup, fine);
+        angle_t az;
+        if (!initialized) {
+            filtered = raw * (1L << BENCH_EMA_SHIFT);
+            initialized = true;
+            az = raw;
+        } else {
+            filtered += (raw - (filtered >> BENCH_EMA_SHIFT)) * BENCH_EMA_ALPHA_Q8;
+            az = (angle_t)(filtered >> BENCH_EMA_SHIFT);
+        }
+        while (az >= ANGLE_DEG(360)) az -= ANGLE_DEG(360);
+        while (az < 0) az += ANGLE_DEG(360);
+        if (az > ANGLE_DEG(359.5)) az = 0;
+        return az;
+    }
+
+    long velocity(angle_t target, angle_t current, long targetRate, unsigned long dtMs) {
+        long r = 0;
+        angle_t err = target - current;
+        angle_t hold = moving ? ANGLE_DEG(VEL_DEADBAND) : ANGLE_DEG(VEL_RESTART);
+        holding = true;
+        if (targetRate != 0 || labs(err) > hold) {
+            r = targetRate + ((err * BENCH_KP_Q8) >> 8);
+            holding = false;
+        }
+        if (((targetRate < 0 && r > 0) || (targetRate > 0 && r < 0)) &&
+            labs(err) <= ANGLE_DEG(VEL_RESTART)) {
+            r = 0;
+            holding = true;
+        }
+        r = constrain(r, -ANGLE_DEG(VEL_MAX_DPS), ANGLE_DEG(VEL_MAX_DPS));
+        long dv = ((long)dtMs * BENCH_ACCEL_Q8) >> 8;
+        r = constrain(r, rate - dv, rate + dv);
+        rate = r;
+        return r;
+    }
+
+    int16_t units(long rateMdps) {
+        long u = rateMdps * BENCH_UNITS_Q16;
+        u = (u >= 0) ? (u + 0x8000L) >> 16 : -((-u + 0x8000L) >> 16);
+        int16_t v = (int16_t)constrain(u, -32767L, 32767L);
+        moving = (v != 0);
+        return v;
+    }
+};
+
+// ════════════════════════════════════════════════════════════════
+// ESTIMATION CYCLES AVR
+// ════════════════════════════════════════════════════════════════
+// Ordres de grandeur avr-libc / libgcc à 16 MHz (ATmega2560, sans
+// FPU ni multiplieur 32 bits): à confirmer sur cible avec PROF.
+
+struct AvrOps {
+    const char *name;
+    unsigned cycles;
+};
+
+static const AvrOps avrCosts[] = {
+    {"fadd/fsub",      110},
+    {"fmul",           150},
+    {"fdiv",           480},
+    {"fcmp",            40},
+    {"int<->float",     80},
+    {"add/cmp 32b",      4},
+    {"mul 32b",         30},
+    {"mul 32x32->64",   90},
+};
+
+#define OPS_KINDS  (sizeof(avrCosts) / sizeof(avrCosts[0]))
+
+// Opérations par axe et par mise à jour (lues dans le code ci-dessus)
+// Ancienne chaîne: la boucle de balayage ajoute 2 comparaisons par pas
+static const float legacyOps[OPS_KINDS] = {
+//  fadd  fmul  fdiv  fcmp  conv  add32  mul32  mul64
+    8,    9,    1,    11,   6,    6,     0,     0
+};
+static const float fixedOps[OPS_KINDS] = {
+    0,    0,    0,    0,    0,    42,    5,     1
+};
+
+// Clé de réponse Easycom (une par axe et par interrogation)
+static const float legacyKeyOps[OPS_KINDS] = {
+    1,    1,    0,    1,    1,    2,     0,     0
+};
+static const float fixedKeyOps[OPS_KINDS] = {
+    0,    0,    0,    0,    0,    6,     0,     1
+};
+
+static double avrCycles(const float *ops, double extraAdd32) {
+    double total = extraAdd32 * avrCosts[5].cycles;
+    for (unsigned i = 0; i < OPS_KINDS; i++) {
+        total += ops[i] * avrCosts[i].cycles;
+    }
+    return total;
+}
+
+// ════════════════════════════════════════════════════════════════
+// POINT D'ENTRÉE
+// ════════════════════════════════════════════════════════════════
+
+int runAngleBenchmark(unsigned long iterations, FILE *out) {
+    if (iterations == 0) iterations = 1;
+
+    buildTable();
+
+    fprintf(out, "════ BANC CHAÎNE ANGLE: %lu mises à jour Az (table %d points, signal inclus) ════\n",
+            iterations, BENCH_POINTS);
+
+    // ─────────────────────────────────────────────────────────────
+    // CONCORDANCE
+    // ─────────────────────────────────────────────────────────────
+    LegacyChain legacy;
+    FixedChain fixed;
+    tableLookupRebuild(fixed.lookup);
+
+    uint32_t state = 0x2545F491UL;
+    unsigned long samples = 200000;
+    double maxAngle = 0, maxRate = 0;
+    long maxUnits = 0;
+    unsigned long keyDiffs = 0, keyTies = 0, regimeShifts = 0;
+
+    for (unsigned long n = 0; n < samples; n++) {
+        long fine = benchFine(state, n);
+        float legacyAz = legacy.position(fine);
+        angle_t fixedAz = fixed.position(fine);
+
+        float targetRate;
+        float target = legacyAz + benchTarget(n, targetRate);
+        // Même régime: même état arrêt/marche et même commande précédente
+        bool sameRegime = (legacy.moving == fixed.moving) &&
+                          fabs((double)legacy.rate - fixed.rate / 1000.0) < 0.005;
+        float legacyRate = legacy.velocity(target, legacyAz, targetRate, BENCH_DT_MS / 1000.0f);
+        long fixedRate = fixed.velocity(angleFromDegrees(target), fixedAz,
+                                        lround(targetRate * 1000.0f), BENCH_DT_MS);
+        sameRegime = sameRegime && (legacy.holding == fixed.holding);
+        int16_t legacyUnits = legacy.units(legacyRate);
+        int16_t fixedUnits = fixed.units(fixedRate);
+
+        double dAngle = fabs((double)legacyAz - fixedAz / 1000.0);
+        if (dAngle > 180.0) dAngle = 360.0 - dAngle;     // Repli 0/360
+        double dRate = fabs((double)legacyRate - fixedRate / 1000.0);
+        if (dAngle > maxAngle) maxAngle = dAngle;
+        if (sameRegime) {
+            if (dRate > maxRate) maxRate = dRate;
+            long dUnits = labs((long)legacyUnits - fixedUnits);
+            if (dUnits > maxUnits) maxUnits = dUnits;
+        } else {
+            // Erreur à quelques millidegrés d'un seuil VEL_DEADBAND /
+            // VEL_RESTART: bascule décalée d'une mise à jour
+            regimeShifts++;
+        }
+
+        // Clé Easycom: écarts à 0.002° d'une demi-décimale = arrondi légitime
+        if (LegacyChain::tenths(legacyAz) != mdegToTenths(fixedAz)) {
+            double frac = fabs(legacyAz) * 10.0 - floor(fabs(legacyAz) * 10.0);
+            if (fabs(frac - 0.5) < 0.03 || frac < 0.03 || frac > 0.97) {
+                keyTies++;
+            } else {
+                keyDiffs++;
+            }
+        }
+    }
+
+    double scanPerUpdate = (double)legacy.scanSteps / samples;
+
+    // ─────────────────────────────────────────────────────────────
+    // TEMPS PAR MISE À JOUR
+    // ─────────────────────────────────────────────────────────────
+    LegacyChain legacyBench;
+    state = 0x2545F491UL;
+    Clock::time_point t0 = Clock::now();
+    for (unsigned long n = 0; n < iterations; n++) {
+        float rate;
+        float az = legacyBench.position(benchFine(state, n));
+        float target = az + benchTarget(n, rate);
+        float r = legacyBench.velocity(target, az, rate, BENCH_DT_MS / 1000.0f);
+        benchSink = legacyBench.units(r) + LegacyChain::tenths(az);
+    }
+    Clock::time_point t1 = Clock::now();
+
+    FixedChain fixedBench;
+    tableLookupRebuild(fixedBench.lookup);
+    state = 0x2545F491UL;
+    Clock::time_point t2 = Clock::now();
+    for (unsigned long n = 0; n < iterations; n++) {
+        float rate;
+        angle_t az = fixedBench.position(benchFine(state, n));
+        angle_t target = az + angleFromDegrees(benchTarget(n, rate));
+        long r = fixedBench.velocity(target, az, lround(rate * 1000.0f), BENCH_DT_MS);
+        benchSink = fixedBench.units(r) + mdegToTenths(az);
+    }
+    Clock::time_point t3 = Clock::now();
+
+    double total = (double)iterations;
+    double legacyNs = nsPer(t0, t1, total);
+    double fixedNs = nsPer(t2, t3, total);
+
+    fprintf(out, "%-22s %12s %12s %8s\n", "", "float", "millideg", "gain");
+    fprintf(out, "%-22s %12.1f %12.1f", "PC ns/mise à jour", legacyNs, fixedNs);
+    if (fixedNs > 0.0) {
+        fprintf(out, " %8.1f\n", legacyNs / fixedNs);
+    } else {
+        fprintf(out, " %8s\n", "-");
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // ESTIMATION AVR
+    // ─────────────────────────────────────────────────────────────
+    double legacyCycles = avrCycles(legacyOps, 2.0 * scanPerUpdate);
+    double fixedCycles = avrCycles(fixedOps, 0.0);
+    fprintf(out, "%-22s %12.0f %12.0f %8.1f\n", "AVR cycles/axe (est.)",
+            legacyCycles, fixedCycles, legacyCycles / fixedCycles);
+    fprintf(out, "%-22s %12.0f %12.0f\n", "AVR µs/loop() 2 axes",
+            2.0 * legacyCycles / 16.0, 2.0 * fixedCycles / 16.0);
+    double legacyKey = avrCycles(legacyKeyOps, 0.0);
+    double fixedKey = avrCycles(fixedKeyOps, 0.0);
+    fprintf(out, "%-22s %12.0f %12.0f %8.1f\n", "AVR cycles/clé (est.)",
+            legacyKey, fixedKey, legacyKey / fixedKey);
+    fprintf(out, "  (balayage table: %.1f pas moyens; coûts:", scanPerUpdate);
+    for (unsigned i = 0; i < OPS_KINDS; i++) {
+        fprintf(out, " %s=%u", avrCosts[i].name, avrCosts[i].cycles);
+    }
+    fprintf(out, ")\n");
+    fprintf(out, "  Estimation: mesurer sur le Mega avec PROF (ENCODEURS, MOTEURS; 1 µs = 16 cycles)\n");
+
+    // ─────────────────────────────────────────────────────────────
+    // RÉSULTAT
+    // ─────────────────────────────────────────────────────────────
+    bool ok = (maxAngle < 0.01) && (maxRate < 0.01) && (keyDiffs == 0) &&
+              (regimeShifts * 100 < samples);
+
+    fprintf(out, "Concordance sur %lu mises à jour:\n", samples);
+    fprintf(out, "  angle   écart max %.4f°\n", maxAngle);
+    fprintf(out, "  vitesse écart max %.4f°/s (%ld unités Nano), %lu bascules de seuil décalées\n",
+            maxRate, maxUnits, regimeShifts);
+    fprintf(out, "  clé Easycom: %lu différences, %lu à moins de 0.003° d'un arrondi\n",
+            keyDiffs, keyTies);
+    fprintf(out, "%s\n", ok ? "OK" : "ÉCHEC");
+
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,37 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure chaîne angle
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_angle.h
+// Description: Compare sur PC la chaîne position float d'origine à
+//              la chaîne en millidegrés (angle.h), par axe et par
+//              mise à jour: ADC cumulé → table → EMA → erreur →
+//              vitesse Nano, plus la clé de réponse Easycom
+// ════════════════════════════════════════════════════════════════
+// L'ancienne chaîne (balayage de table + division float, EMA 0.10,
+// axisVelocity float, angleToTenths) est reproduite ici en float
+// simple précision (double = float sur AVR). La nouvelle utilise
+// tableLookupMdeg() et mdegToTenths() du firmware; la vitesse est
+// une copie de motor_nano.cpp, l'EMA Q8 celle d'origine (filtre
+// égal dans les deux chaînes).
+//
+// Le rapport donne aussi une estimation des cycles AVR à partir du
+// nombre d'opérations de chaque chaîne (coûts avr-libc / libgcc).
+// Mesure réelle sur le Mega: commande PROF, lignes ENCODEURS et
+// MOTEURS.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef BENCH_ANGLE_H
+#define BENCH_ANGLE_H
+
+#include <stdio.h>
+
+/**
+ * Exécute le banc et écrit le rapport
+ *
+ * @param iterations Mises à jour par chaîne
+ * @param out        Flux de sortie (stderr)
+ * @return 0 si les deux chaînes concordent, 1 sinon
+ */
+int runAngleBenchmark(unsigned long iterations, FILE *out);
+
+#endif // BENCH_ANGLE_H
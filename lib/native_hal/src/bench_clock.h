@@ -0,0 +1,31 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Mesure de temps des bancs
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_clock.h
+// Description: Horloge, conversion ns/itération et puits volatile
+//              communs aux bancs de mesure (hôte uniquement)
+// ════════════════════════════════════════════════════════════════
+
+#ifndef BENCH_CLOCK_H
+#define BENCH_CLOCK_H
+
+#include <chrono>
+
+typedef std::chrono::steady_clock Clock;
+
+// Empêche l'optimiseur de supprimer le calcul mesuré (un par banc)
+static volatile long benchSink;
+
+/**
+ * Durée moyenne par itération
+ *
+ * @param from  Début de la mesure
+ * @param to    Fin de la mesure
+ * @param count Nombre d'itérations
+ * @return Nanosecondes par itération
+ */
+static inline double nsPer(Clock::time_point from, Clock::time_point to, double count) {
+    return std::chrono::duration<double, std::nano>(to - from).count() / count;
+}
+
+#endif // BENCH_CLOCK_H
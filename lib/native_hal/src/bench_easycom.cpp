@@ -0,0 +1,354 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure parseur Easycom
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_easycom.cpp
+// Description: Ancien parseur String vs decodeEasycomCommand()
+//              Ancienne réponse String vs getPositionResponse()
+// ════════════════════════════════════════════════════════════════
+
+#include "bench_easycom.h"
+
+#include "Arduino.h"
+#include "config.h"
+#include "easycom.h"
+#include "network.h"        // RX_BUFFER_SIZE
+#include "bench_clock.h"    // Clock, nsPer(), benchSink
+
+#include <string.h>
+
+extern float currentAz;     // encoder_ssi.cpp (miroir float, ancienne réponse)
+extern float currentEl;     // encoder_ssi.cpp
+extern angle_t currentAzMdeg;
+extern angle_t currentElMdeg;
+
+// ════════════════════════════════════════════════════════════════
+// CORPUS (trafic PstRotator typique + commandes maintenance)
+// ════════════════════════════════════════════════════════════════
+
+static const char *const benchCorpus[] = {
+    "AZ123.4 EL45.6",
+    "AZ123.5 EL45.7",
+    "az 0.0 el -2.5",
+    "  AZ359.9 EL89.9  ",
+    "AZ EL",
+    "AZ",
+    "EL",
+    "AZ180.0",
+    "EL-5.0",
+    "SA SE",
+    "SA",
+    "SE",
+    "S",
+    "STOP",
+    ";",
+    "Z123.5",
+    "S45.0",
+    "C10",
+    "C340.5",
+    "E-10",
+    "E45",
+    "CTABLE",
+    "ETABLE",
+    "PROF",
+    "PROFCLR",
+    "",
+    "   ",
+};
+
+#define BENCH_CORPUS_SIZE (sizeof(benchCorpus) / sizeof(benchCorpus[0]))
+
+// ════════════════════════════════════════════════════════════════
+// ANCIEN PARSEUR (String), réduit au décodage
+// ════════════════════════════════════════════════════════════════
+
+static float legacyValueAfter(const String &command, int pos) {
+    String valueStr = "";
+    for (int i = pos + 2; i < (int)command.length(); i++) {
+        char c = command.charAt(i);
+        if (isDigit(c) || c == '.' || c == '-') {
+            valueStr += c;
+        } else if (valueStr.length() > 0) {
+            break;
+        }
+    }
+    return (valueStr.length() > 0) ? valueStr.toFloat() : NAN;
+}
+
+static bool legacyDecode(String command, EasycomCommand &cmd) {
+    cmd.type = EASYCOM_NONE;
+    cmd.hasAz = false;
+    cmd.hasEl = false;
+    cmd.az = 0.0f;
+    cmd.el = 0.0f;
+    cmd.value = 0.0f;
+
+    command.toUpperCase();
+    command.trim();
+    if (command.length() == 0) return false;
+
+    bool isStopCmd = false;
+    if (command == "S" || command == "STOP" || command == ";") {
+        isStopCmd = true;
+    } else if (command == "SA" || command.startsWith("SA ")) {
+        isStopCmd = true;
+    } else if (command == "SE" || command.startsWith("SE ")) {
+        isStopCmd = true;
+    } else if (command.indexOf("SA") != -1 || command.indexOf("SE") != -1) {
+        if (!(command.startsWith("S") && command.length() > 1 && isDigit(command.charAt(1)))) {
+            isStopCmd = true;
+        }
+    }
+    if (isStopCmd) { cmd.type = EASYCOM_STOP; return true; }
+
+    if (command == "RESET_EEPROM" || command == "RESET") { cmd.type = EASYCOM_RESET; return true; }
+
+    #if ENABLE_PROFILER
+        if (command == "PROF")    { cmd.type = EASYCOM_PROF;    return true; }
+        if (command == "PROFCLR") { cmd.type = EASYCOM_PROFCLR; return true; }
+    #endif
+
+    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
+        if (command == "CTABLE") { cmd.type = EASYCOM_CTABLE; return true; }
+        if (command == "CRESET") { cmd.type = EASYCOM_CRESET; return true; }
+        if (command.startsWith("C") && command.length() > 1 && isDigit(command.charAt(1))) {
+            cmd.type = EASYCOM_CPOINT;
+            cmd.value = command.substring(1).toFloat();
+            return true;
+        }
+    #endif
+
+    #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
+        if (command == "ETABLE") { cmd.type = EASYCOM_ETABLE; return true; }
+        if (command == "ERESET") { cmd.type = EASYCOM_ERESET; return true; }
+        if (command.startsWith("E") && command.length() > 1 &&
+            (isDigit(command.charAt(1)) || command.charAt(1) == '-')) {
+            cmd.type = EASYCOM_EPOINT;
+            cmd.value = command.substring(1).toFloat();
+            return true;
+        }
+    #endif
+
+    if (command.startsWith("Z") && command.length() > 1) {
+        cmd.type = EASYCOM_CAL_AZ;
+        cmd.value = command.substring(1).toFloat();
+        return true;
+    }
+
+    if (command.startsWith("S") && command.length() > 1 && isDigit(command.charAt(1))) {
+        cmd.type = EASYCOM_CAL_EL;
+        cmd.value = command.substring(1).toFloat();
+        return true;
+    }
+
+    cmd.type = EASYCOM_GOTO;
+    int posAz = command.indexOf("AZ");
+    if (posAz != -1) {
+        float v = legacyValueAfter(command, posAz);
+        if (!isnan(v)) { cmd.hasAz = true; cmd.az = v; }
+    }
+    int posEl = command.indexOf("EL");
+    if (posEl != -1) {
+        float v = legacyValueAfter(command, posEl);
+        if (!isnan(v)) { cmd.hasEl = true; cmd.el = v; }
+    }
+    return true;
+}
+
+// ════════════════════════════════════════════════════════════════
+// MESURE
+// ════════════════════════════════════════════════════════════════
+
+static bool sameCommand(const EasycomCommand &a, const EasycomCommand &b) {
+    return a.type == b.type && a.hasAz == b.hasAz && a.hasEl == b.hasEl &&
+           a.az == b.az && a.el == b.el && a.value == b.value;
+}
+
+static unsigned benchParser(unsigned long iterations, FILE *out) {
+    char rxBuffer[RX_BUFFER_SIZE];
+
+    // ─────────────────────────────────────────────────────────────
+    // CONCORDANCE
+    // ─────────────────────────────────────────────────────────────
+    unsigned mismatches = 0;
+    for (size_t i = 0; i < BENCH_CORPUS_SIZE; i++) {
+        EasycomCommand legacy, inPlace;
+        bool okLegacy = legacyDecode(String(benchCorpus[i]), legacy);
+
+        strncpy(rxBuffer, benchCorpus[i], sizeof(rxBuffer) - 1);
+        rxBuffer[sizeof(rxBuffer) - 1] = '\0';
+        bool okInPlace = decodeEasycomCommand(rxBuffer, inPlace);
+
+        if (okLegacy != okInPlace || (okLegacy && !sameCommand(legacy, inPlace))) {
+            fprintf(out, "DIFFÉRENCE: \"%s\" ancien type %u, nouveau type %u\n",
+                    benchCorpus[i], legacy.type, inPlace.type);
+            mismatches++;
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // ANCIEN: String(rxBuffer) + parsing String
+    // ─────────────────────────────────────────────────────────────
+    unsigned long allocCount0 = String::hostAllocCount;
+    unsigned long allocBytes0 = String::hostAllocBytes;
+    Clock::time_point t0 = Clock::now();
+
+    for (unsigned long n = 0; n < iterations; n++) {
+        for (size_t i = 0; i < BENCH_CORPUS_SIZE; i++) {
+            EasycomCommand cmd;
+            strcpy(rxBuffer, benchCorpus[i]);
+            String command = String(rxBuffer);
+            legacyDecode(command, cmd);
+            benchSink = cmd.type;
+        }
+    }
+
+    Clock::time_point t1 = Clock::now();
+    unsigned long legacyAllocs = String::hostAllocCount - allocCount0;
+    unsigned long legacyBytes = String::hostAllocBytes - allocBytes0;
+
+    // ─────────────────────────────────────────────────────────────
+    // NOUVEAU: décodage en place dans rxBuffer
+    // ─────────────────────────────────────────────────────────────
+    allocCount0 = String::hostAllocCount;
+    allocBytes0 = String::hostAllocBytes;
+    Clock::time_point t2 = Clock::now();
+
+    for (unsigned long n = 0; n < iterations; n++) {
+        for (size_t i = 0; i < BENCH_CORPUS_SIZE; i++) {
+            EasycomCommand cmd;
+            strcpy(rxBuffer, benchCorpus[i]);
+            decodeEasycomCommand(rxBuffer, cmd);
+            benchSink = cmd.type;
+        }
+    }
+
+    Clock::time_point t3 = Clock::now();
+    unsigned long inPlaceAllocs = String::hostAllocCount - allocCount0;
+    unsigned long inPlaceBytes = String::hostAllocBytes - allocBytes0;
+
+    // ─────────────────────────────────────────────────────────────
+    // RAPPORT (par commande)
+    // ─────────────────────────────────────────────────────────────
+    double total = (double)iterations * BENCH_CORPUS_SIZE;
+    double legacyNs = nsPer(t0, t1, total);
+    double inPlaceNs = nsPer(t2, t3, total);
+
+    fprintf(out, "════ BANC EASYCOM: %zu commandes x %lu passes ════\n",
+            BENCH_CORPUS_SIZE, iterations);
+    fprintf(out, "%-10s %10s %12s %12s\n", "Parseur", "ns/cmd", "allocs/cmd", "octets/cmd");
+    fprintf(out, "%-10s %10.1f %12.2f %12.1f\n", "String",
+            legacyNs, legacyAllocs / total, legacyBytes / total);
+    fprintf(out, "%-10s %10.1f %12.2f %12.1f\n", "En place",
+            inPlaceNs, inPlaceAllocs / total, inPlaceBytes / total);
+    if (inPlaceNs > 0.0) {
+        fprintf(out, "Gain: x%.1f\n", legacyNs / inPlaceNs);
+    }
+    fprintf(out, "Concordance: %s (%u différence(s))\n",
+            mismatches == 0 ? "OK" : "ÉCHEC", mismatches);
+
+    return mismatches + (inPlaceAllocs != 0 ? 1 : 0);
+}
+
+// ════════════════════════════════════════════════════════════════
+// RÉPONSE POSITION: ancienne version String vs virgule fixe
+// ════════════════════════════════════════════════════════════════
+
+static String legacyPositionResponse() {
+    String response = "AZ";
+    response += String(currentAz, 1);
+    response += " EL";
+    response += String(currentEl, 1);
+    response += "\r\n";
+    return response;
+}
+
+static bool isExactTie(angle_t mdeg) {
+    // Dixièmes exactement à mi-chemin (ex: 12.25): le millidegré exact
+    // arrondit vers le haut, le float (12.2499...) selon sa représentation
+    // binaire et l'arrondi de dtostrf / printf
+    return labs(mdeg) % 100 == 50;
+}
+
+static unsigned benchResponse(unsigned long iterations, FILE *out) {
+    // ─────────────────────────────────────────────────────────────
+    // IDENTITÉ OCTET PAR OCTET: -50.00° à 400.00° par pas de 0.01°
+    // ─────────────────────────────────────────────────────────────
+    unsigned long checked = 0, ties = 0, mismatches = 0;
+    for (long i = -5000; i <= 40000; i++) {
+        currentAzMdeg = i * 10;
+        currentElMdeg = (i % 9000) * -10;
+        currentAz = (float)i / 100.0f;
+        currentEl = (float)(-(i % 9000)) / 100.0f;     // 0 → +0.0 (pas de -0.0 en entier)
+        String legacy = legacyPositionResponse();
+        const char *fixed = getPositionResponse();
+        checked++;
+        if (strcmp(legacy.c_str(), fixed) != 0) {
+            if (isExactTie(currentAzMdeg) || isExactTie(currentElMdeg)) {
+                ties++;
+            } else {
+                if (mismatches < 5) {
+                    fprintf(out, "DIFFÉRENCE: \"%s\" au lieu de \"%s\"\n",
+                            fixed, legacy.c_str());
+                }
+                mismatches++;
+            }
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // TEMPS ET ALLOCATIONS
+    // ─────────────────────────────────────────────────────────────
+    unsigned long allocCount0 = String::hostAllocCount;
+    unsigned long allocBytes0 = String::hostAllocBytes;
+    Clock::time_point t0 = Clock::now();
+    for (unsigned long n = 0; n < iterations; n++) {
+        currentAz = 100.0f + (float)(n % 1000) * 0.1f;
+        String response = legacyPositionResponse();
+        benchSink = (uint8_t)response.length();
+    }
+    Clock::time_point t1 = Clock::now();
+    unsigned long legacyAllocs = String::hostAllocCount - allocCount0;
+    unsigned long legacyBytes = String::hostAllocBytes - allocBytes0;
+
+    // Position changeant à chaque appel: reformatage systématique
+    allocCount0 = String::hostAllocCount;
+    Clock::time_point t2 = Clock::now();
+    for (unsigned long n = 0; n < iterations; n++) {
+        currentAzMdeg = 100000 + (angle_t)(n % 1000) * 100;
+        benchSink = (uint8_t)getPositionResponse()[2];
+    }
+    Clock::time_point t3 = Clock::now();
+
+    // Position fixe (antenne arrêtée, polling PstRotator): cache
+    currentAzMdeg = 123400;
+    Clock::time_point t4 = Clock::now();
+    for (unsigned long n = 0; n < iterations; n++) {
+        benchSink = (uint8_t)getPositionResponse()[2];
+    }
+    Clock::time_point t5 = Clock::now();
+    unsigned long fixedAllocs = String::hostAllocCount - allocCount0;
+
+    double total = (double)iterations;
+    fprintf(out, "\n════ BANC RÉPONSE POSITION: %lu appels ════\n", iterations);
+    fprintf(out, "%-16s %10s %12s %12s\n", "Formatage", "ns/rép", "allocs/rép", "octets/rép");
+    fprintf(out, "%-16s %10.1f %12.2f %12.1f\n", "String",
+            nsPer(t0, t1, total), legacyAllocs / total, legacyBytes / total);
+    fprintf(out, "%-16s %10.1f %12.2f %12.1f\n", "Fixe (nouveau)",
+            nsPer(t2, t3, total), 0.0, 0.0);
+    fprintf(out, "%-16s %10.1f %12.2f %12.1f\n", "Fixe (cache)",
+            nsPer(t4, t5, total), 0.0, 0.0);
+    fprintf(out, "Identité: %s (%lu positions, %lu égalités exactes .x5, %lu différence(s))\n",
+            mismatches == 0 ? "OK" : "ÉCHEC", checked, ties, mismatches);
+
+    return (unsigned)mismatches + (fixedAllocs != 0 ? 1 : 0);
+}
+
+// ════════════════════════════════════════════════════════════════
+// POINT D'ENTRÉE
+// ════════════════════════════════════════════════════════════════
+
+int runEasycomBenchmark(unsigned long iterations, FILE *out) {
+    unsigned failures = benchParser(iterations, out);
+    failures += benchResponse(iterations * 10, out);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,37 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure parseur Easycom
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_easycom.h
+// Description: Compare sur PC le décodeur en place
+//              (decodeEasycomCommand) à l'ancien parseur String,
+//              et getPositionResponse() à l'ancienne réponse String:
+//              temps et allocations tas par commande / réponse.
+// ════════════════════════════════════════════════════════════════
+// Le parseur String d'origine est reproduit ici (hôte uniquement),
+// réduit au décodage: mêmes toUpperCase()/trim()/indexOf()/
+// substring() et même construction caractère par caractère de
+// valueStr, plus la String créée par processReceivedChar().
+// Les deux décodeurs doivent produire la même EasycomCommand sur
+// le corpus (hors RESET/CRESET/ERESET, voir easycom.cpp).
+//
+// Réponse position: identité octet par octet vérifiée sur une
+// plage de positions, sauf égalités exactes (x.x5 représentable):
+// la HAL arrondit au pair (printf), dtostrf AVR et le formatage
+// fixe arrondissent vers le haut.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef BENCH_EASYCOM_H
+#define BENCH_EASYCOM_H
+
+#include <stdio.h>
+
+/**
+ * Exécute le banc et écrit le rapport
+ *
+ * @param iterations Passes sur le corpus de commandes
+ * @param out        Flux de sortie (stderr)
+ * @return 0 si les deux versions concordent sans allocation, 1 sinon
+ */
+int runEasycomBenchmark(unsigned long iterations, FILE *out);
+
+#endif // BENCH_EASYCOM_H
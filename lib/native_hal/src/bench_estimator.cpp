@@ -0,0 +1,211 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure estimateur position
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_estimator.cpp
+// Description: Ancienne EMA 0.10 vs alpha-beta sur traces simulées
+// ════════════════════════════════════════════════════════════════
+
+#include "bench_estimator.h"
+
+#include "Arduino.h"
+#include "config.h"
+#include "angle.h"
+#include "adc_sampler.h"        // POT_FINE_BITS
+#include "position_estimator.h"
+
+#include <math.h>
+#include <string.h>
+
+// ════════════════════════════════════════════════════════════════
+// ANCIENNE EMA (updateEncoders avant position_estimator.h)
+// ════════════════════════════════════════════════════════════════
+
+struct LegacyEma {
+    long state = 0;             // Millidegrés Q8, alpha 26/256
+    bool initialized = false;
+
+    angle_t update(angle_t raw) {
+        if (!initialized) {
+            state = raw * 256L;
+            initialized = true;
+            return raw;
+        }
+        state += (raw - (state >> 8)) * 26;
+        return (angle_t)(state >> 8);
+    }
+};
+
+// ════════════════════════════════════════════════════════════════
+// TRACES SIMULÉES
+// ════════════════════════════════════════════════════════════════
+
+#define BENCH_DT_MS   ENCODER_READ_INTERVAL
+#define BENCH_START   123.4567              // Position initiale (°)
+
+struct Acquisition {
+    const char *name;
+    uint8_t fineBits;           // Bits ajoutés au 10 bits ADC
+    float noiseLsb;             // Bruit uniforme ± (LSB 10 bits)
+};
+
+static const Acquisition acquisitions[] = {
+    {"ISR 12 bits", POT_FINE_BITS, 0.5f},
+    {"10 bits +-1", 0, 1.0f},
+};
+
+#define SCEN_REST   0
+#define SCEN_SLEW   1
+#define SCEN_MOON   2
+
+static const char *scenarioNames[] = {"repos", "ralliement 1.5/s", "lune 0.004/s"};
+
+// Position vraie (°) et moteur commandé à l'instant t (s)
+static double truth(uint8_t scenario, double t, double length, bool &commanded, bool &cruise) {
+    commanded = false;
+    cruise = false;
+
+    if (scenario == SCEN_MOON) {
+        commanded = true;
+        cruise = (t > 2.0);
+        return BENCH_START + 0.004 * t;
+    }
+    if (scenario == SCEN_REST) {
+        return BENCH_START;
+    }
+
+    // Ralliement: repos 1 s, accélération 3°/s² jusqu'à 1.5°/s,
+    // croisière jusqu'à mi-durée, décélération, repos
+    const double v = 1.5, a = 3.0, ramp = v / a;
+    double start = 1.0, stop = length / 2.0;
+    if (t < start) return BENCH_START;
+
+    commanded = (t < stop + ramp);
+    double dt = t - start;
+    double cruiseEnd = stop - start;
+    if (dt < ramp) return BENCH_START + 0.5 * a * dt * dt;
+
+    double p = BENCH_START + 0.5 * a * ramp * ramp;
+    if (dt < cruiseEnd) {
+        cruise = (dt > ramp + 1.0);     // Régime établi
+        return p + v * (dt - ramp);
+    }
+    p += v * (cruiseEnd - ramp);
+    double d = min(dt - cruiseEnd, ramp);
+    return p + v * d - 0.5 * a * d * d;
+}
+
+// Angle mesuré (mdeg) après acquisition et conversion linéaire
+static angle_t measure(const Acquisition &acq, double deg, uint32_t &state) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    double u = (double)(state & 0xFFFF) / 65535.0 * 2.0 - 1.0;
+    double lsb = deg * GEAR_RATIO_AZ * 1024.0 / 360.0 + u * acq.noiseLsb;
+    long fine = (long)floor(lsb * (1L << acq.fineBits));
+    return (angle_t)lround(fine * 360000.0 / (1024.0 * GEAR_RATIO_AZ) / (1L << acq.fineBits));
+}
+
+// ════════════════════════════════════════════════════════════════
+// MESURE D'UN SCÉNARIO
+// ════════════════════════════════════════════════════════════════
+
+struct FilterStats {
+    double sum, sumSq;          // Erreur (estimée - vraie) en régime établi
+    unsigned long n;
+    double overshoot;           // Excursion max au-delà de la position finale
+    double settled;             // Erreur max 1 s après l'arrêt
+};
+
+static void addSample(FilterStats &s, double err) {
+    s.sum += err;
+    s.sumSq += err * err;
+    s.n++;
+}
+
+static double mean(const FilterStats &s) { return s.n ? s.sum / s.n : 0.0; }
+
+static double stddev(const FilterStats &s) {
+    if (s.n < 2) return 0.0;
+    double m = mean(s);
+    return sqrt(max(s.sumSq / s.n - m * m, 0.0));
+}
+
+static void runScenario(const Acquisition &acq, uint8_t scenario, double length,
+                        FilterStats &ema, FilterStats &est) {
+    memset(&ema, 0, sizeof(ema));
+    memset(&est, 0, sizeof(est));
+
+    LegacyEma legacy;
+    PositionEstimator estimator = {0, 0, false};
+    uint32_t state = 0x2545F491UL;
+
+    bool dummy1, dummy2;
+    double finalPos = truth(scenario, length, length, dummy1, dummy2);
+    double stopTime = -1.0;
+
+    for (unsigned long k = 0; k * BENCH_DT_MS < length * 1000.0; k++) {
+        double t = k * BENCH_DT_MS / 1000.0;
+        bool commanded, cruise;
+        double deg = truth(scenario, t, length, commanded, cruise);
+        angle_t raw = measure(acq, deg, state);
+
+        double e1 = legacy.update(raw) / 1000.0 - deg;
+        double e2 = estimatorUpdate(estimator, raw, BENCH_DT_MS, commanded) / 1000.0 - deg;
+
+        if (scenario == SCEN_REST || cruise) {
+            addSample(ema, e1);
+            addSample(est, e2);
+        }
+
+        if (scenario == SCEN_SLEW && !commanded && t > 1.0) {
+            if (stopTime < 0) stopTime = t;
+            // Sens du mouvement positif: dépassement = au-delà de la fin
+            ema.overshoot = max(ema.overshoot, e1 + deg - finalPos);
+            est.overshoot = max(est.overshoot, e2 + deg - finalPos);
+            if (t > stopTime + 1.0) {
+                ema.settled = max(ema.settled, fabs(e1));
+                est.settled = max(est.settled, fabs(e2));
+            }
+        }
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// POINT D'ENTRÉE
+// ════════════════════════════════════════════════════════════════
+
+int runEstimatorBenchmark(unsigned long seconds, FILE *out) {
+    if (seconds < 10) seconds = 10;
+
+    fprintf(out, "════ BANC ESTIMATEUR: %lu s par scénario, lecture toutes les %d ms ════\n",
+            seconds, BENCH_DT_MS);
+    fprintf(out, "alpha-beta: commandé α=%.2f β=%.3f, arrêté α=%.2f | EMA: α=26/256\n",
+            ESTIMATOR_ALPHA_MOVING, ESTIMATOR_BETA_MOVING, ESTIMATOR_ALPHA_HOLD);
+    fprintf(out, "%-12s %-17s | %9s %9s %9s | %9s %9s %9s\n", "acquisition", "scénario",
+            "EMA ret.", "bruit", "dépass.", "a-b ret.", "bruit", "dépass.");
+
+    unsigned failures = 0;
+
+    for (const Acquisition &acq : acquisitions) {
+        for (uint8_t sc = SCEN_REST; sc <= SCEN_MOON; sc++) {
+            FilterStats ema, est;
+            runScenario(acq, sc, (double)seconds, ema, est);
+
+            fprintf(out, "%-12s %-17s | %9.4f %9.4f ", acq.name, scenarioNames[sc],
+                    -mean(ema), stddev(ema));
+            if (sc == SCEN_SLEW) fprintf(out, "%9.4f", ema.overshoot); else fprintf(out, "%9s", "-");
+            fprintf(out, " | %9.4f %9.4f ", -mean(est), stddev(est));
+            if (sc == SCEN_SLEW) fprintf(out, "%9.4f", est.overshoot); else fprintf(out, "%9s", "-");
+            fprintf(out, "\n");
+
+            // Repos: pas plus de bruit que l'EMA; mouvement: retard réduit
+            if (sc == SCEN_REST && stddev(est) > stddev(ema) * 1.1 + 0.0005) failures++;
+            if (sc == SCEN_SLEW && fabs(mean(est)) > fabs(mean(ema)) / 4.0) failures++;
+            if (sc == SCEN_SLEW && est.settled > ema.settled + 0.01) failures++;
+        }
+    }
+
+    fprintf(out, "(degrés; retard = vraie - estimée en régime établi, bruit = écart type)\n");
+    fprintf(out, "%s\n", failures == 0 ? "OK" : "ÉCHEC");
+    return failures == 0 ? 0 : 1;
+}
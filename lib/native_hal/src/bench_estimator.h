@@ -0,0 +1,33 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure estimateur position
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_estimator.h
+// Description: Ancienne EMA 0.10 vs filtre alpha-beta
+//              (position_estimator.h) sur des traces ADC simulées
+// ════════════════════════════════════════════════════════════════
+// Traces à 20 ms (ENCODER_READ_INTERVAL), pot multi-tours Az
+// (GEAR_RATIO_AZ), deux chaînes d'acquisition:
+// - ISR ADC suréchantillonnée (12 bits, bruit ±0.5 LSB 10 bits)
+// - analogRead() 10 bits, bruit ±1 LSB (comme le simulateur)
+//
+// Scénarios: repos, ralliement 1.5°/s avec accélération puis arrêt,
+// poursuite lune 0.004°/s. Pour chaque filtre: retard moyen pendant
+// le mouvement, bruit (écart type autour du retard), dépassement
+// après l'arrêt.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef BENCH_ESTIMATOR_H
+#define BENCH_ESTIMATOR_H
+
+#include <stdio.h>
+
+/**
+ * Exécute le banc et écrit le rapport
+ *
+ * @param seconds Durée simulée de chaque scénario (s)
+ * @param out     Flux de sortie (stderr)
+ * @return 0 si l'estimateur réduit le retard sans dégrader le repos, 1 sinon
+ */
+int runEstimatorBenchmark(unsigned long seconds, FILE *out);
+
+#endif // BENCH_ESTIMATOR_H
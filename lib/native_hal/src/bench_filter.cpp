@@ -0,0 +1,142 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure filtre potentiomètre
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_filter.cpp
+// Description: Ancienne moyenne glissante vs RunningAverage
+// ════════════════════════════════════════════════════════════════
+
+#include "bench_filter.h"
+
+#include "Arduino.h"
+#include "config.h"
+#include "adc_sampler.h"        // POT_FINE_MAX
+#include "running_average.h"
+#include "bench_clock.h"        // Clock, nsPer(), benchSink
+
+// ════════════════════════════════════════════════════════════════
+// ANCIENNE MOYENNE (updateEncoders avant RunningAverage)
+// ════════════════════════════════════════════════════════════════
+
+template <int N>
+struct LegacyAverage {
+    int buffer[N] = {0};
+    int index = 0;
+    bool full = false;
+
+    int add(int value) {
+        buffer[index] = value;
+        index = (index + 1) % N;
+        if (index == 0) full = true;
+
+        long sum = 0;
+        int count = full ? N : index;
+        for (int i = 0; i < count; i++) {
+            sum += buffer[i];
+        }
+        return (int)(sum / count);
+    }
+
+    void fill(int value) {
+        for (int i = 0; i < N; i++) {
+            buffer[i] = value;
+        }
+        index = 0;
+        full = true;
+    }
+};
+
+// ════════════════════════════════════════════════════════════════
+// SIGNAL DE TEST
+// ════════════════════════════════════════════════════════════════
+
+// Rampe lente + bruit ±8 unités fines, pleine échelle POT_FINE_MAX
+static int benchSample(uint32_t &state, unsigned long n) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    long value = (long)((n / 4) % (POT_FINE_MAX + 1)) + (long)(state % 17) - 8;
+    return (int)constrain(value, 0L, (long)POT_FINE_MAX);
+}
+
+// ════════════════════════════════════════════════════════════════
+// MESURE PAR TAILLE
+// ════════════════════════════════════════════════════════════════
+
+template <int N>
+static unsigned benchSize(unsigned long iterations, FILE *out) {
+    // ─────────────────────────────────────────────────────────────
+    // CONCORDANCE: remplissage initial, régime établi, reset
+    // ─────────────────────────────────────────────────────────────
+    LegacyAverage<N> legacy;
+    RunningAverage<int, N> running;
+    uint32_t state = 0x2545F491UL;
+    unsigned long mismatches = 0;
+
+    for (unsigned long n = 0; n < 20000; n++) {
+        int sample = benchSample(state, n);
+        if (n % 5000 == 4999) {
+            // resetPotBufferAz/El() pendant une calibration
+            legacy.fill(sample);
+            running.fill(sample);
+        }
+        int a = legacy.add(sample);
+        int b = running.add(sample);
+        if (a != b) {
+            if (mismatches < 5) {
+                fprintf(out, "DIFFÉRENCE N=%d échantillon %lu: %d au lieu de %d\n", N, n, b, a);
+            }
+            mismatches++;
+        }
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // TEMPS PAR ÉCHANTILLON
+    // ─────────────────────────────────────────────────────────────
+    LegacyAverage<N> legacyBench;
+    state = 0x2545F491UL;
+    Clock::time_point t0 = Clock::now();
+    for (unsigned long n = 0; n < iterations; n++) {
+        benchSink = legacyBench.add(benchSample(state, n));
+    }
+    Clock::time_point t1 = Clock::now();
+
+    RunningAverage<int, N> runningBench;
+    state = 0x2545F491UL;
+    Clock::time_point t2 = Clock::now();
+    for (unsigned long n = 0; n < iterations; n++) {
+        benchSink = runningBench.add(benchSample(state, n));
+    }
+    Clock::time_point t3 = Clock::now();
+
+    double total = (double)iterations;
+    double legacyNs = nsPer(t0, t1, total);
+    double runningNs = nsPer(t2, t3, total);
+
+    fprintf(out, "%-6d %12.1f %12.1f", N, legacyNs, runningNs);
+    if (runningNs > 0.0) {
+        fprintf(out, " %8.1f", legacyNs / runningNs);
+    } else {
+        fprintf(out, " %8s", "-");
+    }
+    fprintf(out, "   %s\n", mismatches == 0 ? "OK" : "ÉCHEC");
+
+    return mismatches == 0 ? 0 : 1;
+}
+
+// ════════════════════════════════════════════════════════════════
+// POINT D'ENTRÉE
+// ════════════════════════════════════════════════════════════════
+
+int runFilterBenchmark(unsigned long iterations, FILE *out) {
+    if (iterations == 0) iterations = 1;
+
+    fprintf(out, "════ BANC FILTRE POT: %lu échantillons (signal de test inclus) ════\n", iterations);
+    fprintf(out, "%-6s %12s %12s %8s   %s\n", "N", "ancien ns", "somme ns", "gain", "concordance");
+
+    unsigned failures = 0;
+    failures += benchSize<POT_SAMPLES_AZ>(iterations, out);
+    failures += benchSize<POT_SAMPLES_EL>(iterations, out);
+    failures += benchSize<64>(iterations, out);
+
+    return failures == 0 ? 0 : 1;
+}
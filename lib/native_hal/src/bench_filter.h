@@ -0,0 +1,30 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc de mesure filtre potentiomètre
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_filter.h
+// Description: Compare sur PC la moyenne glissante RunningAverage
+//              (somme courante, running_average.h) à l'ancienne
+//              boucle de updateEncoders() (re-somme complète et '%')
+// ════════════════════════════════════════════════════════════════
+// L'ancienne boucle est reproduite ici (hôte uniquement), avec le
+// même remplissage initial (moyenne sur les échantillons reçus) et
+// le même pré-remplissage que resetPotBufferAz/El().
+// Les deux filtres doivent donner la même moyenne à chaque
+// échantillon, pour POT_SAMPLES_AZ et POT_SAMPLES_EL.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef BENCH_FILTER_H
+#define BENCH_FILTER_H
+
+#include <stdio.h>
+
+/**
+ * Exécute le banc et écrit le rapport
+ *
+ * @param iterations Échantillons filtrés par version et par taille
+ * @param out        Flux de sortie (stderr)
+ * @return 0 si les deux versions concordent, 1 sinon
+ */
+int runFilterBenchmark(unsigned long iterations, FILE *out);
+
+#endif // BENCH_FILTER_H
@@ -0,0 +1,199 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc journal EEPROM position
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_journal.cpp
+// Description: Tests de reprise et durée de vie des cellules
+// ════════════════════════════════════════════════════════════════
+
+#include "bench_journal.h"
+
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "config.h"
+#include "position_journal.h"
+
+#define CELL_CYCLES     100000UL    // Endurance garantie ATmega2560
+#define JOURNAL_BYTES   (EEPROM_JOURNAL_SLOTS * JOURNAL_RECORD_SIZE)
+
+// ════════════════════════════════════════════════════════════════
+// REPRISE
+// ════════════════════════════════════════════════════════════════
+
+static unsigned failures = 0;
+
+// Colonne alignée sur les caractères affichés (UTF-8), pas les octets
+static void printPadded(FILE *out, const char *text, int width) {
+    int shown = 0;
+    for (const char *c = text; *c; c++) {
+        if (((uint8_t)*c & 0xC0) != 0x80) shown++;
+    }
+    fprintf(out, "%s%*s", text, max(width - shown, 0), "");
+}
+
+static void check(FILE *out, const char *name, bool ok) {
+    fprintf(out, "  ");
+    printPadded(out, name, 44);
+    fprintf(out, " %s\n", ok ? "OK" : "ÉCHEC");
+    if (!ok) failures++;
+}
+
+static bool recoverEquals(long az, long el) {
+    long a = 0, e = 0;
+    return journalRecover(a, e) && a == az && e == el;
+}
+
+static void writeRecord(long az, long el) {
+    journalWrite(az, el);
+    journalFlush();
+}
+
+static void runRecoveryTests(FILE *out) {
+    fprintf(out, "Reprise:\n");
+
+    long a = 0, e = 0;
+    check(out, "journal vierge: aucun enregistrement", !journalRecover(a, e));
+
+    for (long i = 0; i < 70000; i++) writeRecord(i, -i);
+    check(out, "70000 enregistrements: dernier repris", recoverEquals(69999, -69999));
+
+    // Coupure pendant l'écriture: k passages de journalService()
+    // (un octet modifié par passage), puis redémarrage
+    bool tornOk = true;
+    long value = 100000;
+    for (int k = 1; k < JOURNAL_RECORD_SIZE; k++) {
+        long a0 = 0, e0 = 0;
+        journalRecover(a0, e0);
+        journalWrite(value, -value);
+        for (int i = 0; i < k; i++) journalService();
+        bool complete = !journalGetStats().busy;
+        if (!recoverEquals(complete ? value : a0, complete ? -value : e0)) tornOk = false;
+
+        // Écriture suivante dans la case coupée, reprise normale
+        writeRecord(value + 1, -value - 1);
+        if (!recoverEquals(value + 1, -value - 1)) tornOk = false;
+        value += 2;
+    }
+    check(out, "coupure après 1..11 octets: précédent", tornOk);
+
+    writeRecord(7, 8);
+    writeRecord(9, 10);
+    int addr = EEPROM_JOURNAL_START + journalGetStats().slot * JOURNAL_RECORD_SIZE;
+    EEPROM.write(addr + 2, EEPROM.read(addr + 2) ^ 0x10);
+    check(out, "bit faux dans le dernier: précédent (CRC)", recoverEquals(7, 8));
+    check(out, "cases rejetées signalées", journalGetStats().rejected == 1);
+
+    writeRecord(11, 12);
+    check(out, "écriture après reprise: case réécrite", recoverEquals(11, 12));
+}
+
+// ════════════════════════════════════════════════════════════════
+// USURE
+// ════════════════════════════════════════════════════════════════
+
+struct WearProfile {
+    const char *name;
+    double azLsbPerS;           // Variation valeur Az (LSB ADC cumulés / s)
+    double elLsbPerS;
+};
+
+// Pots multi-tours: 1° = GEAR_RATIO × 1024 / 360 LSB
+static const WearProfile profiles[] = {
+    {"mouvement permanent", 1000.0 / EEPROM_JOURNAL_PERIOD_MS, 0.0},
+    {"poursuite lune", 0.004 * GEAR_RATIO_AZ * 1024.0 / 360.0, 0.003 * GEAR_RATIO_EL * 1024.0 / 360.0},
+    {"repos", 0.0, 0.0},
+};
+
+static uint32_t wearSnapshot[E2END + 1];
+
+static void snapshotWear() {
+    for (int i = 0; i <= E2END; i++) wearSnapshot[i] = EEPROM.hostWriteCount(i);
+}
+
+static uint32_t maxWear(int start, int length) {
+    uint32_t worst = 0;
+    for (int i = start; i < start + length; i++) {
+        worst = max(worst, EEPROM.hostWriteCount(i) - wearSnapshot[i]);
+    }
+    return worst;
+}
+
+static void printLifetime(FILE *out, uint32_t writes, double hours) {
+    if (writes == 0) {
+        fprintf(out, "    illimitée");
+        return;
+    }
+    double years = (double)CELL_CYCLES / (writes / hours) / (24.0 * 365.25);
+    if (years < 1.0) fprintf(out, " %8.1f j. ", years * 365.25);
+    else fprintf(out, " %8.1f ans", years);
+}
+
+static void runWearProfile(FILE *out, const WearProfile &p, unsigned long hours) {
+    // Journal repris, ancien emplacement fixe à la même valeur
+    long az = 50000, el = 700;
+    writeRecord(az, el);
+    EEPROM.put(EEPROM_TURNS_AZ, az);
+    EEPROM.put(EEPROM_TURNS_EL, el);
+
+    snapshotWear();
+    unsigned long requests = (unsigned long)(hours * 3600000.0 / EEPROM_JOURNAL_PERIOD_MS);
+    unsigned long writesBefore = journalGetStats().writes;
+    unsigned long maxPasses = 0;
+
+    for (unsigned long k = 1; k <= requests; k++) {
+        double t = k * (EEPROM_JOURNAL_PERIOD_MS / 1000.0);
+        az = 50000 + (long)(p.azLsbPerS * t);
+        el = 700 + (long)(p.elLsbPerS * t);
+
+        // Ancien code: put de chaque axe toutes les 5 s
+        EEPROM.put(EEPROM_TURNS_AZ, az);
+        EEPROM.put(EEPROM_TURNS_EL, el);
+
+        journalWrite(az, el);
+        unsigned long passes = 0;
+        while (journalGetStats().busy || passes == 0) {
+            journalService();
+            passes++;
+        }
+        maxPasses = max(maxPasses, passes);
+    }
+
+    uint32_t oldWear = maxWear(EEPROM_TURNS_AZ, 8);
+    uint32_t newWear = maxWear(EEPROM_JOURNAL_START, JOURNAL_BYTES);
+
+    fprintf(out, "  %-20s %9lu | %9u", p.name, journalGetStats().writes - writesBefore, oldWear);
+    printLifetime(out, oldWear, (double)hours);
+    fprintf(out, " | %9u", newWear);
+    printLifetime(out, newWear, (double)hours);
+    fprintf(out, " | %3lu\n", maxPasses);
+
+    // Répartition: cellule la plus usée au plus ~1/SLOTS de l'ancienne
+    if (newWear > oldWear / (EEPROM_JOURNAL_SLOTS / 2) + 1) failures++;
+}
+
+// ════════════════════════════════════════════════════════════════
+// POINT D'ENTRÉE
+// ════════════════════════════════════════════════════════════════
+
+int runJournalBenchmark(unsigned long hours, FILE *out) {
+    if (hours < 1) hours = 1;
+    failures = 0;
+
+    fprintf(out, "════ BANC JOURNAL EEPROM: %d cases de %d octets (adresses %d-%d) ════\n",
+            EEPROM_JOURNAL_SLOTS, JOURNAL_RECORD_SIZE, EEPROM_JOURNAL_START,
+            EEPROM_JOURNAL_START + JOURNAL_BYTES - 1);
+
+    runRecoveryTests(out);
+    fprintf(out, "  lecture au démarrage: %d octets (séquences) + %d par case vérifiée\n",
+            2 * EEPROM_JOURNAL_SLOTS, JOURNAL_RECORD_SIZE);
+
+    fprintf(out, "Usure sur %lu h, une demande toutes les %d ms:\n", hours, EEPROM_JOURNAL_PERIOD_MS);
+    fprintf(out, "  profil                  enreg. |   put max    durée vie |   journal    durée vie | pas\n");
+    for (const WearProfile &p : profiles) {
+        runWearProfile(out, p, hours);
+    }
+
+    fprintf(out, "(max = écritures de la cellule la plus sollicitée, %lu cycles garantis;\n"
+                 " pas = passages journalService() pour un enregistrement)\n", CELL_CYCLES);
+    fprintf(out, "%s\n", failures == 0 ? "OK" : "ÉCHEC");
+    return failures == 0 ? 0 : 1;
+}
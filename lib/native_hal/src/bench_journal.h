@@ -0,0 +1,37 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc journal EEPROM position
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_journal.h
+// Description: Reprise après coupure et usure des cellules:
+//              ancien EEPROM.put toutes les 5 s vs journal circulaire
+//              (position_journal.h)
+// ════════════════════════════════════════════════════════════════
+// Reprise (EEPROM émulée vierge):
+// - journal vierge → aucun enregistrement
+// - 70 000 enregistrements (plusieurs tours d'anneau, séquence
+//   repassant par 0) → dernier enregistrement repris
+// - coupure après 1 à 11 octets écrits → enregistrement précédent
+// - bit faux dans le dernier enregistrement → CRC, précédent
+// - écriture après reprise → la case invalide est réécrite
+//
+// Usure: profils de <h> heures, une demande toutes les
+// EEPROM_JOURNAL_PERIOD_MS. Écritures par cellule comptées par la
+// HAL (EEPROM.hostWriteCount), durée de vie extrapolée à 100 000
+// cycles pour la cellule la plus sollicitée.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef BENCH_JOURNAL_H
+#define BENCH_JOURNAL_H
+
+#include <stdio.h>
+
+/**
+ * Exécute le banc et écrit le rapport
+ *
+ * @param hours Durée simulée de chaque profil d'usure (heures)
+ * @param out   Flux de sortie (stderr)
+ * @return 0 si toutes les reprises sont correctes et l'usure répartie, 1 sinon
+ */
+int runJournalBenchmark(unsigned long hours, FILE *out);
+
+#endif // BENCH_JOURNAL_H
@@ -0,0 +1,303 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc générateur d'impulsions STEP
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_steps.cpp
+// Description: Relevé des fronts et vérification du timing
+// ════════════════════════════════════════════════════════════════
+
+#include "bench_steps.h"
+
+#include "Arduino.h"
+#include "hal_native.h"
+#include "config.h"
+#include "step_generator.h"
+
+#define BENCH_LOOP_US  200          // Coût d'une loop() (comme --loop-us)
+#define RATE_FAST      (500000L / SPEED_FAST)
+#define RATE_SLOW      (500000L / SPEED_SLOW)
+
+// ════════════════════════════════════════════════════════════════
+// RELEVÉ DES FRONTS
+// ════════════════════════════════════════════════════════════════
+
+struct EdgeStats {
+    unsigned long steps;        // Fronts montants
+    long signedSteps;           // Signés selon DIR au front montant
+    uint64_t lastRise, lastFall, lastDir, lastEdge;
+    uint64_t periodMin, periodMax, periodSum;
+    unsigned long periods;
+    uint64_t highMin, highMax;
+    uint64_t dirSetupMin;       // DIR changé → front montant suivant
+    bool dirPending;
+};
+
+static EdgeStats stats[2];
+static FILE *edgesFile = nullptr;
+
+static void resetStats() {
+    for (EdgeStats &s : stats) {
+        memset(&s, 0, sizeof(s));
+        s.periodMin = s.highMin = s.dirSetupMin = UINT64_MAX;
+    }
+}
+
+static void onPinWrite(uint8_t pin, uint8_t level, uint64_t nowUs) {
+    int axis = -1;
+    bool isStep = false;
+    if (pin == AZ_STEP || pin == AZ_DIR) axis = STEP_AXIS_AZ;
+    if (pin == EL_STEP || pin == EL_DIR) axis = STEP_AXIS_EL;
+    if (axis < 0) return;
+    isStep = (pin == AZ_STEP || pin == EL_STEP);
+
+    if (edgesFile) fprintf(edgesFile, "%llu,%u,%u\n", (unsigned long long)nowUs, pin, level);
+
+    EdgeStats &s = stats[axis];
+    s.lastEdge = nowUs;
+    if (!isStep) {
+        s.lastDir = nowUs;
+        s.dirPending = true;
+        return;
+    }
+
+    if (level == HIGH) {
+        if (s.steps > 0) {
+            uint64_t period = nowUs - s.lastRise;
+            s.periodMin = min(s.periodMin, period);
+            s.periodMax = max(s.periodMax, period);
+            s.periodSum += period;
+            s.periods++;
+        }
+        if (s.dirPending) {
+            s.dirSetupMin = min(s.dirSetupMin, nowUs - s.lastDir);
+            s.dirPending = false;
+        }
+        uint8_t dirPin = (axis == STEP_AXIS_AZ) ? AZ_DIR : EL_DIR;
+        s.signedSteps += (halGetPinOutput(dirPin) == HIGH) ? 1 : -1;
+        s.steps++;
+        s.lastRise = nowUs;
+    } else {
+        uint64_t high = nowUs - s.lastRise;
+        s.highMin = min(s.highMin, high);
+        s.highMax = max(s.highMax, high);
+        s.lastFall = nowUs;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// VÉRIFICATIONS ET AFFICHAGE
+// ════════════════════════════════════════════════════════════════
+
+static unsigned failures = 0;
+
+// Période attendue (µs) pour une vitesse: deux demi-périodes arrondies
+// au tick de 0.5 µs
+static uint64_t expectedPeriodUs(long rate) {
+    long speed = labs(rate);
+    long ticks = (STEP_TIMER_HZ / 2 + speed / 2) / speed;
+    return (uint64_t)ticks;
+}
+
+static void printUs(FILE *out, uint64_t v) {
+    if (v == UINT64_MAX) fprintf(out, "      -");
+    else fprintf(out, " %6llu", (unsigned long long)v);
+}
+
+static void printAxis(FILE *out, const char *scenario, uint8_t axis, const char *rates,
+                      long position, bool checkPosition) {
+    const EdgeStats &s = stats[axis];
+    fprintf(out, "  %-13s %s %-13s %7lu", scenario, axis == STEP_AXIS_AZ ? "Az" : "El", rates, s.steps);
+    printUs(out, s.periodMin);
+    if (s.periods > 0) fprintf(out, " %8.1f", (double)s.periodSum / s.periods);
+    else fprintf(out, "        -");
+    printUs(out, s.periods > 0 ? s.periodMax : UINT64_MAX);
+    fprintf(out, " |");
+    printUs(out, s.highMin);
+    printUs(out, s.steps > 0 ? s.highMax : UINT64_MAX);
+    fprintf(out, " |");
+    printUs(out, s.dirSetupMin);
+    if (checkPosition) {
+        bool ok = (position == s.signedSteps);
+        fprintf(out, " | %7ld %s\n", position, ok ? "OK" : "ÉCHEC");
+        if (!ok) failures++;
+    } else {
+        fprintf(out, " |       -\n");
+    }
+}
+
+static void check(bool ok) {
+    if (!ok) failures++;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SCÉNARIOS GÉNÉRATEUR
+// ════════════════════════════════════════════════════════════════
+
+struct Phase {
+    long rateAz1, rateEl1;      // Première moitié
+    long rateAz2, rateEl2;      // Seconde moitié
+};
+
+// Boucle type updateMotorControl(): consigne redonnée à chaque passage
+static void runGenerator(const Phase &p, unsigned long phaseMs, uint64_t &stopUs) {
+    setupStepGenerator();
+    resetStats();
+
+    uint64_t t0 = halNowMicros();
+    uint64_t half = t0 + phaseMs * 500ULL;
+    uint64_t end = t0 + phaseMs * 1000ULL;
+    while (halNowMicros() < end) {
+        bool first = halNowMicros() < half;
+        setStepRate(STEP_AXIS_AZ, first ? p.rateAz1 : p.rateAz2);
+        setStepRate(STEP_AXIS_EL, first ? p.rateEl1 : p.rateEl2);
+        halAdvanceMicros(BENCH_LOOP_US);
+    }
+
+    // Arrêt puis vidange: plus aucun front après la demi-période en cours
+    stopUs = halNowMicros();
+    stopStepGenerators();
+    halAdvanceMicros(100000);
+}
+
+static void runGeneratorScenarios(unsigned long phaseMs, FILE *out) {
+    char rates[2][24];
+    uint64_t stopUs = 0;
+
+    // ─────────────────────────────────────────────────────────────
+    // Vitesses constantes: période et durée haute exactes
+    // ─────────────────────────────────────────────────────────────
+    runGenerator({RATE_FAST, -RATE_SLOW, RATE_FAST, -RATE_SLOW}, phaseMs, stopUs);
+    snprintf(rates[0], sizeof(rates[0]), "%+ld", RATE_FAST);
+    snprintf(rates[1], sizeof(rates[1]), "%+ld", -RATE_SLOW);
+    printAxis(out, "constante", STEP_AXIS_AZ, rates[0], getStepPosition(STEP_AXIS_AZ), true);
+    printAxis(out, "", STEP_AXIS_EL, rates[1], getStepPosition(STEP_AXIS_EL), true);
+    check(stats[0].periodMin == expectedPeriodUs(RATE_FAST) && stats[0].periodMax == expectedPeriodUs(RATE_FAST));
+    check(stats[1].periodMin == expectedPeriodUs(RATE_SLOW) && stats[1].periodMax == expectedPeriodUs(RATE_SLOW));
+    check(stats[0].highMin == SPEED_FAST && stats[0].highMax == SPEED_FAST);
+    check(stats[1].highMin == SPEED_SLOW && stats[1].highMax == SPEED_SLOW);
+    unsigned long expectedAz = phaseMs * RATE_FAST / 1000;
+    check(stats[0].steps + 1 >= expectedAz && stats[0].steps <= expectedAz + 1);
+
+    // Arrêt: dernier front au plus une demi-période après la demande,
+    // STEP laissé bas
+    for (uint8_t axis = 0; axis < 2; axis++) {
+        long rate = (axis == STEP_AXIS_AZ) ? RATE_FAST : RATE_SLOW;
+        uint64_t halfUs = expectedPeriodUs(rate) / 2;
+        check(stats[axis].lastEdge <= stopUs + halfUs);
+        check(!stepGeneratorRunning(axis));
+        check(halGetPinOutput(axis == STEP_AXIS_AZ ? AZ_STEP : EL_STEP) == LOW);
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // Changement de vitesse: aucune période hors [rapide, lente]
+    // ─────────────────────────────────────────────────────────────
+    runGenerator({RATE_FAST, RATE_SLOW, RATE_SLOW, RATE_FAST}, phaseMs, stopUs);
+    snprintf(rates[0], sizeof(rates[0]), "%+ld>%+ld", RATE_FAST, RATE_SLOW);
+    snprintf(rates[1], sizeof(rates[1]), "%+ld>%+ld", RATE_SLOW, RATE_FAST);
+    printAxis(out, "changement", STEP_AXIS_AZ, rates[0], getStepPosition(STEP_AXIS_AZ), true);
+    printAxis(out, "", STEP_AXIS_EL, rates[1], getStepPosition(STEP_AXIS_EL), true);
+    for (uint8_t axis = 0; axis < 2; axis++) {
+        check(stats[axis].periodMin >= expectedPeriodUs(RATE_FAST));
+        check(stats[axis].periodMax <= expectedPeriodUs(RATE_SLOW));
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // Inversion: DIR stable une demi-période avant le pas suivant
+    // ─────────────────────────────────────────────────────────────
+    runGenerator({RATE_SLOW, -RATE_FAST, -RATE_SLOW, RATE_FAST}, phaseMs, stopUs);
+    snprintf(rates[0], sizeof(rates[0]), "%+ld>%+ld", RATE_SLOW, -RATE_SLOW);
+    snprintf(rates[1], sizeof(rates[1]), "%+ld>%+ld", -RATE_FAST, RATE_FAST);
+    printAxis(out, "inversion", STEP_AXIS_AZ, rates[0], getStepPosition(STEP_AXIS_AZ), true);
+    printAxis(out, "", STEP_AXIS_EL, rates[1], getStepPosition(STEP_AXIS_EL), true);
+    check(stats[0].dirSetupMin >= (uint64_t)SPEED_SLOW);
+    check(stats[1].dirSetupMin >= (uint64_t)SPEED_FAST);
+    // Aller-retour: inversion vue au passage de loop() suivant (±1 loop)
+    // et phase des fronts (±1 pas de part et d'autre)
+    check(labs(getStepPosition(STEP_AXIS_AZ)) <= 2 + 2 * RATE_SLOW * BENCH_LOOP_US / 1000000L);
+    check(labs(getStepPosition(STEP_AXIS_EL)) <= 2 + 2 * RATE_FAST * BENCH_LOOP_US / 1000000L);
+
+    // ─────────────────────────────────────────────────────────────
+    // Vitesse minimale (période OCR max) et sous le minimum (arrêt)
+    // ─────────────────────────────────────────────────────────────
+    runGenerator({STEP_RATE_MIN, STEP_RATE_MIN - 1, STEP_RATE_MIN, STEP_RATE_MIN - 1}, phaseMs, stopUs);
+    snprintf(rates[0], sizeof(rates[0]), "%+ld", STEP_RATE_MIN);
+    snprintf(rates[1], sizeof(rates[1]), "%+ld", STEP_RATE_MIN - 1);
+    printAxis(out, "minimum", STEP_AXIS_AZ, rates[0], getStepPosition(STEP_AXIS_AZ), true);
+    printAxis(out, "", STEP_AXIS_EL, rates[1], getStepPosition(STEP_AXIS_EL), true);
+    if (stats[0].periods > 0) {
+        check(stats[0].periodMin == expectedPeriodUs(STEP_RATE_MIN) &&
+              stats[0].periodMax == expectedPeriodUs(STEP_RATE_MIN));
+    }
+    check(stats[1].steps == 0);
+}
+
+// ════════════════════════════════════════════════════════════════
+// ANCIENNES RAFALES (updateMotorControl avant step_generator.h)
+// ════════════════════════════════════════════════════════════════
+
+static void legacyBurst(uint8_t stepPin, uint8_t dirPin, int stepDelay) {
+    digitalWrite(dirPin, HIGH);
+    for (int i = 0; i < 10; i++) {
+        digitalWrite(stepPin, HIGH);
+        delayMicroseconds(stepDelay);
+        digitalWrite(stepPin, LOW);
+        delayMicroseconds(stepDelay);
+    }
+}
+
+static void runLegacy(unsigned long phaseMs, FILE *out) {
+    setupStepGenerator();
+    resetStats();
+
+    uint64_t t0 = halNowMicros();
+    uint64_t end = t0 + phaseMs * 1000ULL;
+    unsigned long loops = 0;
+    while (halNowMicros() < end) {
+        legacyBurst(AZ_STEP, AZ_DIR, SPEED_FAST);
+        legacyBurst(EL_STEP, EL_DIR, SPEED_SLOW);
+        halAdvanceMicros(BENCH_LOOP_US);
+        loops++;
+    }
+    double loopMs = (double)(halNowMicros() - t0) / loops / 1000.0;
+
+    char rates[2][24];
+    snprintf(rates[0], sizeof(rates[0]), "%+ld", RATE_FAST);
+    snprintf(rates[1], sizeof(rates[1]), "%+ld", RATE_SLOW);
+    printAxis(out, "anciennes", STEP_AXIS_AZ, rates[0], 0, false);
+    printAxis(out, "rafales", STEP_AXIS_EL, rates[1], 0, false);
+
+    double seconds = (halNowMicros() - t0) / 1e6;
+    fprintf(out, "Rafales: loop() %.2f ms par passage (%.2f rapide + %.2f lente + %.2f),"
+                 " %.0f / %.0f pas/s effectifs au lieu de %ld / %ld\n",
+            loopMs, 20.0 * SPEED_FAST / 1000.0, 20.0 * SPEED_SLOW / 1000.0, BENCH_LOOP_US / 1000.0,
+            stats[0].steps / seconds, stats[1].steps / seconds, RATE_FAST, RATE_SLOW);
+}
+
+// ════════════════════════════════════════════════════════════════
+// POINT D'ENTRÉE
+// ════════════════════════════════════════════════════════════════
+
+int runStepBenchmark(unsigned long phaseMs, FILE *edgesCsv, FILE *out) {
+    if (phaseMs < 10) phaseMs = 10;
+    failures = 0;
+    edgesFile = edgesCsv;
+    if (edgesFile) fprintf(edgesFile, "t_us,broche,niveau\n");
+
+    halSetClockMode(HAL_CLOCK_VIRTUAL);
+    halSetPinWriteHook(onPinWrite);
+
+    fprintf(out, "════ BANC GÉNÉRATEUR STEP: Timer1 Az / Timer3 El, tick 0.5 µs, %lu ms par scénario ════\n",
+            phaseMs);
+    fprintf(out, "  scénario      axe pas/s           pas |  période µs min/moy/max |"
+                 " haut µs min/max | DIR>pas µs | position\n");
+
+    runGeneratorScenarios(phaseMs, out);
+    runLegacy(phaseMs, out);
+
+    fprintf(out, "Générateur: loop() %.2f ms par passage (consigne seule), ISR: 2 par pas et par axe\n",
+            BENCH_LOOP_US / 1000.0);
+
+    halSetPinWriteHook(nullptr);
+    edgesFile = nullptr;
+    fprintf(out, "%s\n", failures == 0 ? "OK" : "ÉCHEC");
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,40 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Banc générateur d'impulsions STEP
+// ════════════════════════════════════════════════════════════════
+// Fichier: bench_steps.h
+// Description: Fronts STEP/DIR relevés par la HAL (hook d'écriture),
+//              anciennes rafales delayMicroseconds vs générateur sous
+//              interruption (step_generator.h)
+// ════════════════════════════════════════════════════════════════
+// Horloge virtuelle, timers émulés: chaque ISR tombe à l'instant exact
+// de sa comparaison. Une "loop" de --loop-us (200 µs) redonne la
+// consigne à chaque passage, comme updateMotorControl().
+//
+// Scénarios de <ms> ms, Az et El simultanés:
+// - vitesses constantes (SPEED_FAST Az, SPEED_SLOW El)
+// - changement de vitesse à mi-parcours
+// - inversion de sens à mi-parcours
+// - vitesse minimale (STEP_RATE_MIN) et sous le minimum (arrêt)
+// - anciennes rafales de 10 pas (reproduites ici)
+//
+// Par axe: pas émis, période entre fronts montants (min/moy/max),
+// durée haute, délai DIR → front montant suivant, compteur
+// getStepPosition() contre les pas signés relevés sur les broches.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef BENCH_STEPS_H
+#define BENCH_STEPS_H
+
+#include <stdio.h>
+
+/**
+ * Exécute le banc et écrit le rapport
+ *
+ * @param phaseMs  Durée de chaque scénario (ms simulées)
+ * @param edgesCsv Journal des fronts "t_us,broche,niveau" (nullptr: aucun)
+ * @param out      Flux de sortie (stderr)
+ * @return 0 si toutes les vérifications passent, 1 sinon
+ */
+int runStepBenchmark(unsigned long phaseMs, FILE *edgesCsv, FILE *out);
+
+#endif // BENCH_STEPS_H
@@ -0,0 +1,295 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (horloge, GPIO, ADC)
+// ════════════════════════════════════════════════════════════════
+// Fichier: hal_native.cpp
+// Description: Implémentation hôte de l'API temps/GPIO/ADC Arduino
+// ════════════════════════════════════════════════════════════════
+
+#include "Arduino.h"
+#include "hal_native.h"
+
+#include <time.h>
+
+// ════════════════════════════════════════════════════════════════
+// ÉTAT INTERNE
+// ════════════════════════════════════════════════════════════════
+
+static HalClockMode clockMode = HAL_CLOCK_REAL;
+static uint64_t virtualNowUs = 0;
+static uint64_t realStartUs = 0;
+
+static uint8_t pinModes[NUM_DIGITAL_PINS];
+static uint8_t pinOutputs[NUM_DIGITAL_PINS];
+static uint8_t pinInputs[NUM_DIGITAL_PINS];
+static int pwmValues[NUM_DIGITAL_PINS];
+static int adcValues[NUM_ANALOG_INPUTS];
+static HalPinWriteHook pinWriteHook = nullptr;
+
+struct HalTimer {
+    HalTimerIsr isr;
+    uint16_t ticks;             // Période (ticks 0.5 µs)
+    uint64_t nextTick;          // Prochaine comparaison (ticks absolus)
+    bool running;
+};
+
+static HalTimer timers[HAL_TIMER_COUNT];
+static bool inTimerIsr = false;
+static uint64_t isrTick = 0;    // Instant de la comparaison en cours
+
+static HalModel *models[HAL_MAX_MODELS];
+static uint8_t modelCount = 0;
+static bool inModelService = false;
+
+static volatile bool stopRequested = false;
+
+// ════════════════════════════════════════════════════════════════
+// HORLOGE
+// ════════════════════════════════════════════════════════════════
+
+static uint64_t monotonicMicros() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000);
+}
+
+void halSetClockMode(HalClockMode mode) {
+    clockMode = mode;
+    virtualNowUs = 0;
+    realStartUs = monotonicMicros();
+    for (uint8_t i = 0; i < HAL_TIMER_COUNT; i++) timers[i].running = false;
+}
+
+HalClockMode halGetClockMode() {
+    return clockMode;
+}
+
+uint64_t halNowMicros() {
+    if (clockMode == HAL_CLOCK_VIRTUAL) {
+        return virtualNowUs;
+    }
+    if (realStartUs == 0) realStartUs = monotonicMicros();
+    return monotonicMicros() - realStartUs;
+}
+
+// ISR des timers dues jusqu'à untilTick, dans l'ordre chronologique
+static void runTimers(uint64_t untilTick) {
+    if (inTimerIsr) return;
+    for (;;) {
+        HalTimer *next = nullptr;
+        for (uint8_t i = 0; i < HAL_TIMER_COUNT; i++) {
+            HalTimer &t = timers[i];
+            if (t.running && t.nextTick <= untilTick && (next == nullptr || t.nextTick < next->nextTick)) {
+                next = &t;
+            }
+        }
+        if (next == nullptr) return;
+
+        isrTick = next->nextTick;
+        if (clockMode == HAL_CLOCK_VIRTUAL) {
+            uint64_t us = isrTick / HAL_TIMER_TICKS_PER_US;
+            if (us > virtualNowUs) virtualNowUs = us;
+        }
+        inTimerIsr = true;
+        next->isr();
+        inTimerIsr = false;
+        if (next->running && next->nextTick == isrTick) next->nextTick = isrTick + next->ticks;
+    }
+}
+
+void halAdvanceMicros(uint64_t us) {
+    if (clockMode == HAL_CLOCK_VIRTUAL) {
+        uint64_t targetUs = virtualNowUs + us;
+        runTimers(targetUs * HAL_TIMER_TICKS_PER_US);
+        virtualNowUs = targetUs;
+    } else if (us > 0) {
+        uint64_t target = halNowMicros() + us;
+        if (us >= 2000) {
+            struct timespec ts;
+            ts.tv_sec = (time_t)(us / 1000000ULL);
+            ts.tv_nsec = (long)((us % 1000000ULL) * 1000ULL);
+            nanosleep(&ts, nullptr);
+        }
+        while (halNowMicros() < target) {}
+    }
+    halServiceModels();
+}
+
+// ─────────────────────────────────────────────────────────────────
+// API ARDUINO: TEMPS (unsigned long tronqué à 32 bits comme sur AVR)
+// ─────────────────────────────────────────────────────────────────
+
+unsigned long millis() {
+    return (unsigned long)(uint32_t)(halNowMicros() / 1000ULL);
+}
+
+unsigned long micros() {
+    return (unsigned long)(uint32_t)halNowMicros();
+}
+
+void delay(unsigned long ms) {
+    halAdvanceMicros((uint64_t)ms * 1000ULL);
+}
+
+void delayMicroseconds(unsigned int us) {
+    halAdvanceMicros(us);
+}
+
+void yield() {
+}
+
+// ════════════════════════════════════════════════════════════════
+// GPIO / ADC / PWM
+// ════════════════════════════════════════════════════════════════
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= NUM_DIGITAL_PINS) return;
+    pinModes[pin] = mode;
+    // Pull-up interne: entrée au repos à HIGH tant qu'un modèle ne la force pas
+    if (mode == INPUT_PULLUP) pinInputs[pin] = HIGH;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    if (pin >= NUM_DIGITAL_PINS) return;
+    uint8_t level = val ? HIGH : LOW;
+    if (pinModes[pin] != OUTPUT) {
+        // Sur AVR, écrire HIGH sur une entrée active le pull-up
+        pinInputs[pin] = level;
+        return;
+    }
+    if (pinOutputs[pin] != level) {
+        pinOutputs[pin] = level;
+        if (pinWriteHook) pinWriteHook(pin, level, halNowMicros());
+    }
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin >= NUM_DIGITAL_PINS) return LOW;
+    if (pinModes[pin] == OUTPUT) return pinOutputs[pin];
+    return pinInputs[pin];
+}
+
+int analogRead(uint8_t pin) {
+    // Comme le core Mega: canal 0..15 accepté à la place de A0..A15
+    if (pin >= A0) pin -= A0;
+    if (pin >= NUM_ANALOG_INPUTS) return 0;
+    return adcValues[pin];
+}
+
+void analogWrite(uint8_t pin, int val) {
+    if (pin >= NUM_DIGITAL_PINS) return;
+    pinModes[pin] = OUTPUT;
+    pwmValues[pin] = constrain(val, 0, 255);
+}
+
+void analogReference(uint8_t mode) {
+    (void)mode;
+}
+
+void halSetAdc(uint8_t pin, int value) {
+    if (pin >= A0) pin -= A0;
+    if (pin >= NUM_ANALOG_INPUTS) return;
+    adcValues[pin] = constrain(value, 0, 1023);
+}
+
+void halSetPinInput(uint8_t pin, uint8_t level) {
+    if (pin >= NUM_DIGITAL_PINS) return;
+    pinInputs[pin] = level ? HIGH : LOW;
+}
+
+uint8_t halGetPinOutput(uint8_t pin) {
+    if (pin >= NUM_DIGITAL_PINS) return LOW;
+    return pinOutputs[pin];
+}
+
+int halGetPwm(uint8_t pin) {
+    if (pin >= NUM_DIGITAL_PINS) return 0;
+    return pwmValues[pin];
+}
+
+void halSetPinWriteHook(HalPinWriteHook hook) {
+    pinWriteHook = hook;
+}
+
+// ════════════════════════════════════════════════════════════════
+// TIMERS
+// ════════════════════════════════════════════════════════════════
+
+void halTimerStart(uint8_t timer, uint16_t ticks, HalTimerIsr isr) {
+    if (timer >= HAL_TIMER_COUNT || isr == nullptr || ticks == 0) return;
+    HalTimer &t = timers[timer];
+    uint64_t now = inTimerIsr ? isrTick : halNowMicros() * HAL_TIMER_TICKS_PER_US;
+    t.isr = isr;
+    t.ticks = ticks;
+    t.nextTick = now + ticks;
+    t.running = true;
+}
+
+void halTimerSetCompare(uint8_t timer, uint16_t ticks) {
+    if (timer >= HAL_TIMER_COUNT || ticks == 0) return;
+    timers[timer].ticks = ticks;
+}
+
+void halTimerStop(uint8_t timer) {
+    if (timer >= HAL_TIMER_COUNT) return;
+    timers[timer].running = false;
+}
+
+// ════════════════════════════════════════════════════════════════
+// MODÈLES
+// ════════════════════════════════════════════════════════════════
+
+bool halRegisterModel(HalModel *model) {
+    if (model == nullptr || modelCount >= HAL_MAX_MODELS) return false;
+    models[modelCount++] = model;
+    return true;
+}
+
+void halServiceModels() {
+    // Horloge réelle: ISR en retard rattrapées à chaque loop()
+    runTimers(halNowMicros() * HAL_TIMER_TICKS_PER_US);
+
+    // Un modèle qui appelle delay() ne doit pas se ré-entrer
+    if (inModelService) return;
+    inModelService = true;
+    uint64_t now = halNowMicros();
+    for (uint8_t i = 0; i < modelCount; i++) {
+        models[i]->step(now);
+    }
+    inModelService = false;
+}
+
+// ════════════════════════════════════════════════════════════════
+// ALÉATOIRE (générateur déterministe, reproductible en mode virtuel)
+// ════════════════════════════════════════════════════════════════
+
+static uint32_t randState = 1;
+
+void randomSeed(unsigned long seed) {
+    if (seed != 0) randState = (uint32_t)seed;
+}
+
+long random(long howbig) {
+    if (howbig == 0) return 0;
+    // xorshift32
+    randState ^= randState << 13;
+    randState ^= randState >> 17;
+    randState ^= randState << 5;
+    return (long)(randState % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return random(howbig - howsmall) + howsmall;
+}
+
+// ════════════════════════════════════════════════════════════════
+// CYCLE DE VIE
+// ════════════════════════════════════════════════════════════════
+
+void halRequestStop() {
+    stopRequested = true;
+}
+
+bool halStopRequested() {
+    return stopRequested;
+}
@@ -0,0 +1,125 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (pilotage côté hôte)
+// ════════════════════════════════════════════════════════════════
+// Fichier: hal_native.h
+// Description: API réservée à l'hôte pour piloter la HAL: mode
+//              d'horloge, injection des entrées (ADC, pins) et
+//              enregistrement des modèles de simulation.
+//              Ce fichier n'est JAMAIS inclus par le firmware AVR.
+// ════════════════════════════════════════════════════════════════
+// Deux modes d'horloge:
+//   HAL_CLOCK_REAL    : millis()/micros() suivent CLOCK_MONOTONIC,
+//                       delay() dort réellement (usage interactif
+//                       avec PstRotator via TCP ou stdin).
+//   HAL_CLOCK_VIRTUAL : temps simulé déterministe. Il n'avance que
+//                       par delay()/delayMicroseconds(), par le coût
+//                       fixe attribué à chaque loop() et par le temps
+//                       d'émission UART. Deux exécutions identiques
+//                       donnent la même trace, bit pour bit.
+// ════════════════════════════════════════════════════════════════
+
+#ifndef HAL_NATIVE_H
+#define HAL_NATIVE_H
+
+#include <stdint.h>
+
+// ════════════════════════════════════════════════════════════════
+// HORLOGE
+// ════════════════════════════════════════════════════════════════
+
+enum HalClockMode {
+    HAL_CLOCK_REAL = 0,
+    HAL_CLOCK_VIRTUAL = 1
+};
+
+/**
+ * Sélection du mode d'horloge (à appeler avant setup())
+ */
+void halSetClockMode(HalClockMode mode);
+
+/**
+ * Mode d'horloge courant
+ */
+HalClockMode halGetClockMode();
+
+/**
+ * Temps écoulé depuis le démarrage en µs (64 bits, sans débordement)
+ */
+uint64_t halNowMicros();
+
+/**
+ * Avance l'horloge virtuelle de us microsecondes et exécute les
+ * modèles enregistrés. En mode réel: attente active équivalente.
+ */
+void halAdvanceMicros(uint64_t us);
+
+// ════════════════════════════════════════════════════════════════
+// ENTRÉES / SORTIES
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Force la valeur renvoyée par analogRead(pin)
+ * @param pin Numéro Arduino (A0..A15 ou canal 0..15)
+ * @param value Valeur ADC 0-1023
+ */
+void halSetAdc(uint8_t pin, int value);
+
+/**
+ * Force le niveau vu par digitalRead(pin) (entrée pilotée par un modèle)
+ */
+void halSetPinInput(uint8_t pin, uint8_t level);
+
+/**
+ * Dernier niveau écrit par le firmware via digitalWrite(pin)
+ */
+uint8_t halGetPinOutput(uint8_t pin);
+
+/**
+ * Dernier rapport cyclique écrit via analogWrite(pin) (0-255)
+ */
+int halGetPwm(uint8_t pin);
+
+/**
+ * Callback appelé à chaque changement de niveau d'une sortie
+ * (horodatage µs). nullptr pour désactiver.
+ */
+typedef void (*HalPinWriteHook)(uint8_t pin, uint8_t level, uint64_t nowUs);
+void halSetPinWriteHook(HalPinWriteHook hook);
+
+// ════════════════════════════════════════════════════════════════
+// MODÈLES DE SIMULATION
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Modèle physique exécuté à chaque avance de l'horloge
+ * (plant moteur/codeur, Nano simulé, ...). step() reçoit le temps
+ * courant et doit intégrer lui-même le dt depuis son dernier appel.
+ */
+class HalModel {
+public:
+    virtual ~HalModel() {}
+    virtual void step(uint64_t nowUs) = 0;
+};
+
+/**
+ * Enregistre un modèle (max HAL_MAX_MODELS, durée de vie statique)
+ */
+#define HAL_MAX_MODELS 8
+bool halRegisterModel(HalModel *model);
+
+/**
+ * Exécute immédiatement tous les modèles au temps courant
+ */
+void halServiceModels();
+
+// ════════════════════════════════════════════════════════════════
+// CYCLE DE VIE
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Demande l'arrêt propre de la boucle principale (SIGINT, durée atteinte)
+ */
+void halRequestStop();
+bool halStopRequested();
+
+#endif // HAL_NATIVE_H
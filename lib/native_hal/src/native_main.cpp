@@ -0,0 +1,246 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - HAL Native (point d'entrée Linux)
+// ════════════════════════════════════════════════════════════════
+// Fichier: native_main.cpp
+// Description: main() hôte: appelle setup() puis loop() en boucle,
+//              comme le core Arduino, avec options de simulation.
+// ════════════════════════════════════════════════════════════════
+// Usage:
+//   .pio/build/native/program [options]
+//     --virtual          Horloge virtuelle déterministe (défaut: réelle)
+//     --duration <ms>    Arrêt après <ms> millisecondes (temps HAL)
+//     --loop-us <us>     Coût attribué à chaque loop() en mode virtuel
+//                        (défaut 200 µs, ordre de grandeur mesuré sur Mega)
+//     --eeprom <fichier> Image EEPROM persistante (défaut eeprom_native.bin)
+//     --no-stdin         Serial n'écoute pas stdin (sortie seule)
+//
+//   Simulateur monture (sim_plant.h):
+//     --sim                    Active le Nano + rotor + pots simulés
+//     --sim-start <az>:<el>    Position mécanique de départ (°)
+//     --sim-backlash <deg>     Jeu des deux axes (°)
+//     --sim-goto <ms>:<az>:<el> Consigne Easycom à t=<ms> (répétable, implique --sim)
+//     --sim-trace <fichier>    Trace CSV de la monture toutes les 20 ms
+//     --sim-text-nano          Nano sans trames binaires (ignore "BIN?")
+//     --sim-nano-drop <n>      Le Nano perd une commande sur <n>
+//     --sim-power-fail <ms>[:<tenue>[:<retour>]]
+//                              Coupure d'alimentation à t=<ms> (power_monitor.h)
+//     --sim-pot-nonlin <lsb>   Non-linéarité des pots (sinus d'un tour, LSB crête)
+//     --sim-adc-noise <lsb>    Bruit ADC des pots (uniforme ±, défaut 1 LSB)
+//     --sim-sweep <ms>:<az|el> Balayage de table CSWEEP/ESWEEP à t=<ms> (table_sweep.h)
+//     --sim-stepper-accel <dps2>
+//                              Mode direct: accélération max du rotor chargé (°/s²)
+//
+//   Bancs de mesure (exécutés à la place de setup()/loop()):
+//     --bench-easycom <n>      Parseur Easycom String vs en place (bench_easycom.h)
+//     --bench-filter <n>       Moyenne glissante pot: boucle vs somme courante (bench_filter.h)
+//     --bench-angle <n>        Chaîne position float vs millidegrés (bench_angle.h)
+//     --bench-estimator <s>    EMA pot vs estimateur alpha-beta, <s> s par scénario (bench_estimator.h)
+//     --bench-journal <h>      Journal EEPROM: reprise et usure sur <h> heures (bench_journal.h)
+//     --bench-steps <ms>[:<csv>]
+//                              Générateur STEP sous interruption, fronts relevés (bench_steps.h)
+// ════════════════════════════════════════════════════════════════
+
+#include "Arduino.h"
+#include "EEPROM.h"
+#include "bench_angle.h"
+#include "bench_easycom.h"
+#include "bench_estimator.h"
+#include "bench_filter.h"
+#include "bench_journal.h"
+#include "bench_steps.h"
+#include "hal_native.h"
+#include "sim_plant.h"
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void onSignal(int sig) {
+    (void)sig;
+    halRequestStop();
+}
+
+static void printUsage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [--virtual] [--duration ms] [--loop-us us]\n"
+            "          [--eeprom fichier] [--no-stdin]\n"
+            "          [--sim] [--sim-start az:el] [--sim-backlash deg]\n"
+            "          [--sim-goto ms:az:el]... [--sim-trace fichier]\n"
+            "          [--sim-text-nano] [--sim-nano-drop n]\n"
+            "          [--sim-power-fail ms[:tenue[:retour]]]\n"
+            "          [--sim-pot-nonlin lsb] [--sim-adc-noise lsb]\n"
+            "          [--sim-sweep ms:az|el]\n"
+            "          [--sim-stepper-accel dps2]\n"
+            "          [--bench-easycom n] [--bench-filter n] [--bench-angle n]\n"
+            "          [--bench-estimator s] [--bench-journal h]\n"
+            "          [--bench-steps ms[:fichier.csv]]\n", prog);
+}
+
+// Modèles de simulation (durée de vie statique, voir halRegisterModel)
+static SimPlant simPlant;
+static SimScenario simScenario(simPlant);
+
+int main(int argc, char **argv) {
+    bool virtualClock = false;
+    unsigned long durationMs = 0;
+    unsigned long loopCostUs = 200;
+    const char *eepromPath = "eeprom_native.bin";
+    bool useStdin = true;
+    bool simEnabled = false;
+    bool simHasGoto = false;
+    bool simPowerFail = false;
+    bool simSweep = false;
+    FILE *simTrace = nullptr;
+
+    // ─────────────────────────────────────────────────────────────
+    // OPTIONS LIGNE DE COMMANDE
+    // ─────────────────────────────────────────────────────────────
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--virtual") == 0) {
+            virtualClock = true;
+        } else if (strcmp(argv[i], "--duration") == 0 && i + 1 < argc) {
+            durationMs = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--loop-us") == 0 && i + 1 < argc) {
+            loopCostUs = strtoul(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--eeprom") == 0 && i + 1 < argc) {
+            eepromPath = argv[++i];
+        } else if (strcmp(argv[i], "--no-stdin") == 0) {
+            useStdin = false;
+        } else if (strcmp(argv[i], "--sim") == 0) {
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-start") == 0 && i + 1 < argc) {
+            float az = 0.0f, el = 0.0f;
+            if (sscanf(argv[++i], "%f:%f", &az, &el) != 2) { printUsage(argv[0]); return 2; }
+            simPlant.setStartPosition(az, el);
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-backlash") == 0 && i + 1 < argc) {
+            float backlash = (float)atof(argv[++i]);
+            simPlant.axisConfigAz().backlashDeg = backlash;
+            simPlant.axisConfigEl().backlashDeg = backlash;
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-goto") == 0 && i + 1 < argc) {
+            unsigned long atMs = 0;
+            float az = 0.0f, el = 0.0f;
+            if (sscanf(argv[++i], "%lu:%f:%f", &atMs, &az, &el) != 3 ||
+                !simScenario.addGoto(atMs, az, el)) {
+                printUsage(argv[0]);
+                return 2;
+            }
+            simEnabled = true;
+            simHasGoto = true;
+        } else if (strcmp(argv[i], "--sim-trace") == 0 && i + 1 < argc) {
+            simTrace = fopen(argv[++i], "w");
+            if (simTrace == nullptr) { perror(argv[i]); return 2; }
+            simPlant.setTrace(simTrace, 20);
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-text-nano") == 0) {
+            simPlant.setBinarySupport(false);
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-nano-drop") == 0 && i + 1 < argc) {
+            simPlant.setDropEvery(strtoul(argv[++i], nullptr, 10));
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-power-fail") == 0 && i + 1 < argc) {
+            // Retour après la tenue: le Mega aurait redémarré (hors modèle)
+            unsigned long atMs = 0, holdupMs = 50, restoreMs = 0;
+            int n = sscanf(argv[++i], "%lu:%lu:%lu", &atMs, &holdupMs, &restoreMs);
+            if (n < 1 || (n == 3 && restoreMs >= holdupMs)) { printUsage(argv[0]); return 2; }
+            simPlant.setPowerFail(atMs, holdupMs, restoreMs);
+            simEnabled = true;
+            simPowerFail = true;
+        } else if (strcmp(argv[i], "--sim-pot-nonlin") == 0 && i + 1 < argc) {
+            float lsb = (float)atof(argv[++i]);
+            simPlant.axisConfigAz().potNonlinLsb = lsb;
+            simPlant.axisConfigEl().potNonlinLsb = lsb;
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-adc-noise") == 0 && i + 1 < argc) {
+            float lsb = (float)atof(argv[++i]);
+            simPlant.axisConfigAz().adcNoiseLsb = lsb;
+            simPlant.axisConfigEl().adcNoiseLsb = lsb;
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--sim-sweep") == 0 && i + 1 < argc) {
+            unsigned long atMs = 0;
+            char axis[3] = "";
+            if (sscanf(argv[++i], "%lu:%2s", &atMs, axis) != 2 ||
+                (strcmp(axis, "az") != 0 && strcmp(axis, "el") != 0)) {
+                printUsage(argv[0]);
+                return 2;
+            }
+            simPlant.setTableSweep(atMs, strcmp(axis, "el") == 0);
+            simEnabled = true;
+            simSweep = true;
+        } else if (strcmp(argv[i], "--sim-stepper-accel") == 0 && i + 1 < argc) {
+            float accel = (float)atof(argv[++i]);
+            simPlant.axisConfigAz().stepperAccelDps2 = accel;
+            simPlant.axisConfigEl().stepperAccelDps2 = accel;
+            simEnabled = true;
+        } else if (strcmp(argv[i], "--bench-easycom") == 0 && i + 1 < argc) {
+            return runEasycomBenchmark(strtoul(argv[++i], nullptr, 10), stderr);
+        } else if (strcmp(argv[i], "--bench-filter") == 0 && i + 1 < argc) {
+            return runFilterBenchmark(strtoul(argv[++i], nullptr, 10), stderr);
+        } else if (strcmp(argv[i], "--bench-angle") == 0 && i + 1 < argc) {
+            return runAngleBenchmark(strtoul(argv[++i], nullptr, 10), stderr);
+        } else if (strcmp(argv[i], "--bench-estimator") == 0 && i + 1 < argc) {
+            return runEstimatorBenchmark(strtoul(argv[++i], nullptr, 10), stderr);
+        } else if (strcmp(argv[i], "--bench-journal") == 0 && i + 1 < argc) {
+            return runJournalBenchmark(strtoul(argv[++i], nullptr, 10), stderr);
+        } else if (strcmp(argv[i], "--bench-steps") == 0 && i + 1 < argc) {
+            char *csvPath = nullptr;
+            unsigned long phaseMs = strtoul(argv[++i], &csvPath, 10);
+            FILE *csv = nullptr;
+            if (*csvPath == ':') {
+                csv = fopen(csvPath + 1, "w");
+                if (csv == nullptr) { perror(csvPath + 1); return 2; }
+            }
+            int status = runStepBenchmark(phaseMs, csv, stderr);
+            if (csv) fclose(csv);
+            return status;
+        } else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    halSetClockMode(virtualClock ? HAL_CLOCK_VIRTUAL : HAL_CLOCK_REAL);
+    EEPROM.hostLoad(eepromPath);
+    Serial.hostBindStdio(useStdin, true);
+
+    if (simEnabled) {
+        simPlant.begin();
+        if (simHasGoto) halRegisterModel(&simScenario);
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    // ─────────────────────────────────────────────────────────────
+    // BOUCLE ARDUINO
+    // ─────────────────────────────────────────────────────────────
+    setup();
+
+    uint64_t endUs = (uint64_t)durationMs * 1000ULL;
+    while (!halStopRequested()) {
+        loop();
+
+        if (virtualClock) {
+            halAdvanceMicros(loopCostUs);
+        } else {
+            halServiceModels();
+        }
+
+        if (durationMs > 0 && halNowMicros() >= endUs) break;
+    }
+
+    Serial.flush();
+    if (simHasGoto) simScenario.report(stderr);
+    if (simPowerFail) simPlant.reportPowerFail(stderr);
+    if (simSweep) simPlant.reportTableSweep(stderr);
+    if (simEnabled) simPlant.reportSteppers(stderr);
+    if (simEnabled) simPlant.reportMotorsDC(stderr);
+    if (simTrace) fclose(simTrace);
+    if (!EEPROM.hostSave()) {
+        fprintf(stderr, "EEPROM: écriture de %s impossible\n", eepromPath);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,974 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Simulateur monture (Nano + rotor + pots)
+// ════════════════════════════════════════════════════════════════
+// Fichier: sim_plant.cpp
+// Description: Implémentation du modèle de monture et du scénario
+// ════════════════════════════════════════════════════════════════
+
+#include "sim_plant.h"
+
+#include <Arduino.h>
+#include <math.h>
+
+#include "config.h"
+#include "motor_nano.h"     // Constantes trames NANO_FRAME_xx
+#include "position_journal.h"
+#include "power_monitor.h"
+#include "table_sweep.h"
+#include "encoder_ssi.h"    // Position lue par le firmware (rapport)
+
+// ════════════════════════════════════════════════════════════════
+// VALEURS PAR DÉFAUT (ordre de grandeur de la monture réelle)
+// ════════════════════════════════════════════════════════════════
+
+#define SIM_RATE_SLOW_DPS     0.30   // Approche finale (speed=0)
+#define SIM_RATE_FAST_DPS     1.50   // Ralliement (speed=1)
+#define SIM_ACCEL_DPS2        3.0    // Rampe AccelStepper côté Nano
+#define SIM_BACKLASH_DEG      0.10   // Jeu réducteur ramené à l'antenne
+#define SIM_ADC_NOISE_LSB     1.0    // Bruit ADC ±1 LSB
+#define SIM_COMMAND_TIMEOUT   1000   // Arrêt Nano sans commande (ms)
+#define SIM_SUBSTEP_US        1000   // Pas d'intégration max
+#define SIM_SUPPLY_V          12.0   // Alimentation principale
+#define SIM_SUPPLY_TAU_MS     20.0   // Décroissance après coupure (charge moteurs)
+
+// Mode direct (TB6600 + NEMA23 sur le Mega)
+#define SIM_STEPPER_ACCEL_DPS2   6.0    // Couple / inertie parabole 3 m ramenée à l'antenne
+#define SIM_STEPPER_STALL_STEPS  (2.0 * STEPS_PER_REV_MOTOR / 200.0)  // 2 pas entiers de retard
+
+// Mode direct, moteur DC (MC33926 + motoréducteur SVH3)
+#define SIM_DC_NO_LOAD_DPS    2.0    // Vitesse à vide sous 12 V ramenée à l'antenne
+#define SIM_DC_TAU_S          0.20   // Constante de temps mécanique (inertie parabole)
+#define SIM_DC_STALL_A        6.0    // Courant de blocage sous 12 V
+#define SIM_DC_FRICTION_A     0.6    // Frottement sec réducteur (10 % du blocage)
+#define SIM_DC_FB_V_PER_A     0.525  // Sortie FB MC33926
+
+#define SIM_DC_AZ  (!USE_NANO_STEPPER && MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED)
+#define SIM_DC_EL  (!USE_NANO_STEPPER && MOTOR_EL_TYPE == MOTOR_DC_BRUSHED)
+
+#define SIM_AZ_LIMIT_CCW      -3.0
+#define SIM_AZ_LIMIT_CW       346.0
+#define SIM_EL_LIMIT_DOWN     -10.0
+#define SIM_EL_LIMIT_UP       90.0
+
+// CRC-8 polynôme 0x07, implémentation propre au Nano simulé
+static uint8_t nanoSideCrc8(const uint8_t *data, uint8_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+        crc ^= *data++;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// Monture reliée au hook d'écriture HAL (mode direct, un seul hook)
+static SimPlant *directPlant = nullptr;
+
+static float adcPerDegree(float gearRatio) {
+    return gearRatio * (float)POT_ADC_RESOLUTION / 360.0f;
+}
+
+// ════════════════════════════════════════════════════════════════
+// AXE SIMULÉ
+// ════════════════════════════════════════════════════════════════
+
+SimAxis::SimAxis()
+    : motor(0.0f), output(0.0f), velocity(0.0f),
+      commanded(0.0f), commandRate(0.0f), lastPulseUs(0), pulseIntervalUs(0),
+      stalled(false), pulses(0), lost(0), stalls(0), peakVelocity(0.0f),
+      current(0.0f), peakCurrent(0.0f) {
+    memset(&cfg, 0, sizeof(cfg));
+}
+
+void SimAxis::configure(const SimAxisConfig &config, float startDeg) {
+    cfg = config;
+    output = startDeg;
+    motor = startDeg;
+    velocity = 0.0f;
+    commanded = startDeg;
+    commandRate = 0.0f;
+    stalled = false;
+    current = 0.0f;
+}
+
+void SimAxis::integrate(float dt, int8_t dir, bool fast) {
+    float target = 0.0f;
+    if (dir != 0) {
+        target = (float)dir * (fast ? cfg.rateFastDps : cfg.rateSlowDps);
+    }
+    integrateRate(dt, target);
+}
+
+void SimAxis::integrateRate(float dt, float target) {
+    // Vitesse max AccelStepper côté Nano
+    target = constrain(target, -cfg.rateFastDps, cfg.rateFastDps);
+
+    // Le Nano coupe le moteur sur fin de course (mouvement vers la butée)
+    if ((atHighLimit() && target > 0.0f) || (atLowLimit() && target < 0.0f)) {
+        target = 0.0f;
+        if ((atHighLimit() && velocity > 0.0f) || (atLowLimit() && velocity < 0.0f)) {
+            velocity = 0.0f;
+        }
+    }
+
+    // Rampe d'accélération / décélération
+    float dv = cfg.accelDps2 * dt;
+    if (velocity < target) {
+        velocity = (target - velocity > dv) ? velocity + dv : target;
+    } else if (velocity > target) {
+        velocity = (velocity - target > dv) ? velocity - dv : target;
+    }
+
+    moveMotor(velocity * dt);
+}
+
+void SimAxis::moveMotor(double delta) {
+    motor += delta;
+
+    // Jeu: l'antenne ne suit le moteur qu'en dehors de la zone morte
+    float half = cfg.backlashDeg * 0.5f;
+    if (motor - output > half) {
+        output = motor - half;
+    } else if (output - motor > half) {
+        output = motor + half;
+    }
+
+    // Butées mécaniques
+    if (output > cfg.limitHighDeg) {
+        output = cfg.limitHighDeg;
+        motor = output + half;
+        if (velocity > 0.0f) velocity = 0.0f;
+    } else if (output < cfg.limitLowDeg) {
+        output = cfg.limitLowDeg;
+        motor = output - half;
+        if (velocity < 0.0f) velocity = 0.0f;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────
+// MODE DIRECT: ROTOR PAS-À-PAS
+// ─────────────────────────────────────────────────────────────────
+// Le rotor suit la position commandée par les impulsions: cadence
+// courante + rattrapage du retard, accélération bornée par le couple.
+// Au-delà de stallLagSteps de retard le champ ne l'entraîne plus: il
+// s'arrête et perd chaque pas jusqu'à une cadence de démarrage
+// (pull-in: retard r²/2a < stallLagSteps depuis l'arrêt).
+
+void SimAxis::stepPulse(uint64_t nowUs, int8_t dir) {
+    uint64_t interval = nowUs - lastPulseUs;
+    lastPulseUs = nowUs;
+    pulseIntervalUs = interval;
+    pulses++;
+
+    float stepDeg = 1.0f / cfg.stepsPerDeg;
+    if (stalled) {
+        float pullInDps = sqrtf(2.0f * cfg.stepperAccelDps2 * cfg.stallLagSteps * stepDeg);
+        if ((float)interval * 1e-6f * pullInDps < stepDeg) {
+            lost++;
+            return;
+        }
+        stalled = false;
+        commanded = motor;
+    }
+
+    commanded += dir * stepDeg;
+    commandRate = (interval < 1000000ULL) ? dir * stepDeg / ((float)interval * 1e-6f) : 0.0f;
+}
+
+void SimAxis::followSteps(float dt, uint64_t nowUs) {
+    // Plus d'impulsion depuis deux périodes: cadence nulle
+    if (nowUs - lastPulseUs > 2 * pulseIntervalUs) commandRate = 0.0f;
+
+    if (stalled) {
+        velocity = 0.0f;
+        return;
+    }
+
+    float lag = (float)(commanded - motor);
+    float accel = cfg.stepperAccelDps2;
+    float halfStep = 0.5f / cfg.stepsPerDeg;
+
+    // Au repos sur un pas: retenu par le couple de maintien
+    if (commandRate == 0.0f && fabsf(lag) < halfStep &&
+        fabsf(velocity) < sqrtf(2.0f * accel * halfStep)) {
+        moveMotor(lag);
+        velocity = 0.0f;
+        return;
+    }
+
+    float catchUp = sqrtf(2.0f * accel * fabsf(lag));
+    float target = commandRate + (lag > 0.0f ? catchUp : -catchUp);
+    velocity += constrain(target - velocity, -accel * dt, accel * dt);
+    moveMotor(velocity * dt);
+    peakVelocity = max(peakVelocity, fabsf(velocity));
+
+    // Butée mécanique comprise: le rotor bloqué décroche
+    if (fabs(commanded - motor) > cfg.stallLagSteps / cfg.stepsPerDeg) {
+        stalled = true;
+        stalls++;
+        velocity = 0.0f;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────
+// MODE DIRECT: MOTEUR DC
+// ─────────────────────────────────────────────────────────────────
+// Grandeurs ramenées à l'antenne: ke = Vs / vitesse à vide (V par °/s),
+// R = Vs / courant de blocage. Inductance négligée (PWM ~490 Hz, bien
+// plus rapide que la mécanique): i = (V - ke·ω) / R. Accélération
+// proportionnelle à i - frottement sec, constante de temps dcTauS à
+// vide. Arrêté, le moteur ne décolle qu'au-delà de dcFrictionAmps.
+
+void SimAxis::driveDC(float dt, float volts, bool enabled) {
+    float ke = SIM_SUPPLY_V / cfg.dcNoLoadDps;
+    float r = SIM_SUPPLY_V / cfg.dcStallAmps;
+    current = enabled ? (volts - ke * velocity) / r : 0.0f;
+    peakCurrent = max(peakCurrent, fabsf(current));
+
+    float accelPerAmp = cfg.dcNoLoadDps / (cfg.dcTauS * cfg.dcStallAmps);
+    if (velocity == 0.0f) {
+        if (fabsf(current) <= cfg.dcFrictionAmps) return;
+        velocity = accelPerAmp * (current - copysignf(cfg.dcFrictionAmps, current)) * dt;
+    } else {
+        float v = velocity + accelPerAmp * (current - copysignf(cfg.dcFrictionAmps, velocity)) * dt;
+        // Le frottement arrête le moteur, il ne l'inverse pas
+        velocity = (v * velocity < 0.0f) ? 0.0f : v;
+    }
+    moveMotor(velocity * dt);
+    peakVelocity = max(peakVelocity, fabsf(velocity));
+}
+
+float SimAxis::countsAt(float deg) const {
+    float counts = deg * adcPerDegree(cfg.gearRatio);
+    if (cfg.potNonlinLsb != 0.0f) {
+        counts += cfg.potNonlinLsb * sinf(2.0f * (float)M_PI * counts / (float)POT_ADC_RESOLUTION);
+    }
+    return counts;
+}
+
+int SimAxis::potAdc(uint32_t &noiseState) const {
+    float counts = countsAt(output);
+
+    if (cfg.adcNoiseLsb > 0.0f) {
+        // xorshift32 propre au simulateur (n'altère pas random() du firmware)
+        noiseState ^= noiseState << 13;
+        noiseState ^= noiseState >> 17;
+        noiseState ^= noiseState << 5;
+        float u = (float)(noiseState & 0xFFFF) / 65535.0f;
+        counts += (u * 2.0f - 1.0f) * cfg.adcNoiseLsb;
+    }
+
+    long c = (long)floorf(counts);
+    int raw = (int)(((c % POT_ADC_RESOLUTION) + POT_ADC_RESOLUTION) % POT_ADC_RESOLUTION);
+    return cfg.reverseAdc ? (POT_ADC_RESOLUTION - 1 - raw) : raw;
+}
+
+long SimAxis::accumulatedAdc() const {
+    return (long)floorf(countsAt(output));
+}
+
+// ════════════════════════════════════════════════════════════════
+// MONTURE + NANO SIMULÉS
+// ════════════════════════════════════════════════════════════════
+
+SimPlant::SimPlant()
+    : startAz(0.0f), startEl(0.0f), rxIndex(0), dirAz(0), dirEl(0), fast(false),
+      velocityMode(false), rateAz(0.0f), rateEl(0.0f),
+      lastCommandUs(0), commandTimeoutMs(SIM_COMMAND_TIMEOUT), commands(0),
+      binarySupported(true), binaryMode(false), rxFrameIndex(0), txSeq(0),
+      dropEvery(0), received(0), dropped(0),
+      limCw(false), limCcw(false), limUp(false), limDown(false), limitCount(0),
+      powerFail(false), powerFailUs(0), holdupUs(0), restoreUs(0),
+      dropSeen(false), supplyDead(false), journalBeforeAz(0), journalBeforeEl(0),
+      journalBeforeValid(false), journalDeadAz(0), journalDeadEl(0), journalDeadValid(false),
+      detectUs(0), stillUs(0), detectVolts(0.0f),
+      sweep(false), sweepEl(false), sweepUs(0), sweepSent(false),
+      lastStepUs(0), noiseState(0x2545F491UL),
+      traceFile(nullptr), tracePeriodUs(0), nextTraceUs(0) {
+
+    cfgAz.gearRatio = GEAR_RATIO_AZ;
+    cfgAz.rateSlowDps = SIM_RATE_SLOW_DPS;
+    cfgAz.rateFastDps = SIM_RATE_FAST_DPS;
+    cfgAz.accelDps2 = SIM_ACCEL_DPS2;
+    cfgAz.backlashDeg = SIM_BACKLASH_DEG;
+    cfgAz.limitLowDeg = SIM_AZ_LIMIT_CCW;
+    cfgAz.limitHighDeg = SIM_AZ_LIMIT_CW;
+    cfgAz.adcNoiseLsb = SIM_ADC_NOISE_LSB;
+    cfgAz.potNonlinLsb = 0.0f;
+    cfgAz.reverseAdc = REVERSE_AZ;
+    cfgAz.potPin = POT_PIN_AZ;
+    cfgAz.stepsPerDeg = STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_AZ / 360.0f;
+    cfgAz.stepperAccelDps2 = SIM_STEPPER_ACCEL_DPS2;
+    cfgAz.stallLagSteps = SIM_STEPPER_STALL_STEPS;
+    cfgAz.dcNoLoadDps = SIM_DC_NO_LOAD_DPS;
+    cfgAz.dcTauS = SIM_DC_TAU_S;
+    cfgAz.dcStallAmps = SIM_DC_STALL_A;
+    cfgAz.dcFrictionAmps = SIM_DC_FRICTION_A;
+
+    cfgEl = cfgAz;
+    cfgEl.gearRatio = GEAR_RATIO_EL;
+    cfgEl.limitLowDeg = SIM_EL_LIMIT_DOWN;
+    cfgEl.limitHighDeg = SIM_EL_LIMIT_UP;
+    cfgEl.reverseAdc = REVERSE_EL;
+    cfgEl.potPin = POT_PIN_EL;
+    cfgEl.stepsPerDeg = STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_EL / 360.0f;
+
+    rxLine[0] = '\0';
+}
+
+void SimPlant::setTrace(FILE *file, unsigned long periodMs) {
+    traceFile = file;
+    tracePeriodUs = (uint64_t)periodMs * 1000ULL;
+}
+
+void SimPlant::setPowerFail(unsigned long atMs, unsigned long holdupMs, unsigned long restoreMs) {
+    powerFail = true;
+    powerFailUs = (uint64_t)atMs * 1000ULL;
+    holdupUs = (uint64_t)holdupMs * 1000ULL;
+    restoreUs = (uint64_t)restoreMs * 1000ULL;
+}
+
+void SimPlant::setTableSweep(unsigned long atMs, bool elevation) {
+    sweep = true;
+    sweepEl = elevation;
+    sweepUs = (uint64_t)atMs * 1000ULL;
+}
+
+void SimPlant::begin() {
+    axisAz.configure(cfgAz, startAz);
+    axisEl.configure(cfgEl, startEl);
+
+    // Mémoire du firmware cohérente avec la position mécanique de départ
+    // (comme après une extinction propre: dernier enregistrement du
+    // journal EEPROM = ADC cumulé de la position d'arrêt)
+    long journalAz = 0, journalEl = 0;
+    journalRecover(journalAz, journalEl);
+    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
+        journalAz = axisAz.accumulatedAdc();
+    #endif
+    #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
+        journalEl = axisEl.accumulatedAdc();
+    #endif
+    journalWrite(journalAz, journalEl);
+    journalFlush();
+
+    halSetAdc(cfgAz.potPin, axisAz.potAdc(noiseState));
+    halSetAdc(cfgEl.potPin, axisEl.potAdc(noiseState));
+    halSetAdc(POWER_SENSE_PIN, (int)(SIM_SUPPLY_V / POWER_SENSE_RATIO / 5.0 * 1024.0));
+
+    NANO_SERIAL.hostSetTxHook(onNanoByte, this);
+    #if !USE_NANO_STEPPER
+        directPlant = this;
+        halSetPinWriteHook(onPinWrite);
+    #endif
+    #if SIM_DC_AZ
+        halSetPinInput(M1_SF, HIGH);
+    #endif
+    #if SIM_DC_EL
+        halSetPinInput(M2_SF, HIGH);
+    #endif
+    lastStepUs = halNowMicros();
+    halRegisterModel(this);
+
+    if (traceFile) {
+        fprintf(traceFile, "t_ms,az_deg,el_deg,az_dps,el_dps,dir_az,dir_el,fast\n");
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────
+// MODE DIRECT: FRONTS STEP
+// ─────────────────────────────────────────────────────────────────
+
+void SimPlant::onPinWrite(uint8_t pin, uint8_t level, uint64_t nowUs) {
+    SimPlant *self = directPlant;
+    if (self == nullptr || level != HIGH || (pin != AZ_STEP && pin != EL_STEP)) return;
+
+    // Monture intégrée jusqu'au front: retard du rotor à l'instant exact
+    self->step(nowUs);
+    if (self->supplyDead) return;
+
+    if (pin == AZ_STEP) self->axisAz.stepPulse(nowUs, halGetPinOutput(AZ_DIR) == HIGH ? 1 : -1);
+    else self->axisEl.stepPulse(nowUs, halGetPinOutput(EL_DIR) == HIGH ? 1 : -1);
+}
+
+// ─────────────────────────────────────────────────────────────────
+// MODE DIRECT: PONT MC33926
+// ─────────────────────────────────────────────────────────────────
+// Sign-magnitude: OUT1 suit IN1 (PWM), OUT2 suit IN2. Tension moyenne
+// OUT2 - OUT1, positive = CW / UP.
+
+#if SIM_DC_AZ || SIM_DC_EL
+static float bridgeVolts(uint8_t in1, uint8_t in2, float supply) {
+    float out2 = (halGetPinOutput(in2) == HIGH) ? 1.0f : 0.0f;
+    return supply * (out2 - (float)halGetPwm(in1) / 255.0f);
+}
+
+static int feedbackAdc(float amps) {
+    int adc = (int)(fabsf(amps) * SIM_DC_FB_V_PER_A / 5.0f * 1024.0f);
+    return min(adc, POT_ADC_RESOLUTION - 1);
+}
+#endif
+
+// ─────────────────────────────────────────────────────────────────
+// PROTOCOLE NANO
+// ─────────────────────────────────────────────────────────────────
+
+void SimPlant::onNanoByte(void *ctx, uint8_t c) {
+    SimPlant *self = static_cast<SimPlant *>(ctx);
+    if (self->binaryMode && (self->rxFrameIndex > 0 || c == NANO_FRAME_SYNC)) {
+        self->rxFrame[self->rxFrameIndex++] = c;
+        uint8_t size = (self->rxFrameIndex > 1 && self->rxFrame[1] == NANO_FRAME_VEL)
+                       ? NANO_VEL_FRAME_SIZE : NANO_FRAME_SIZE;
+        if (self->rxFrameIndex == size) {
+            self->rxFrameIndex = 0;
+            self->handleFrame();
+        }
+        return;
+    }
+    if (c == '\n' || c == '\r') {
+        if (self->rxIndex > 0) {
+            self->rxLine[self->rxIndex] = '\0';
+            self->handleLine(self->rxLine);
+            self->rxIndex = 0;
+        }
+    } else if (self->rxIndex < sizeof(self->rxLine) - 1) {
+        self->rxLine[self->rxIndex++] = (char)c;
+    }
+}
+
+bool SimPlant::dropCommand() {
+    received++;
+    if (dropEvery > 0 && received % dropEvery == 0) {
+        dropped++;
+        return true;
+    }
+    return false;
+}
+
+void SimPlant::handleLine(const char *line) {
+    int a = 0, e = 0, s = 0;
+
+    if (strcmp(line, "BIN?") == 0) {
+        if (!binarySupported) return;
+        reply("BIN:OK");
+        binaryMode = true;
+        return;
+    }
+
+    if (dropCommand()) return;
+
+    if (sscanf(line, "M:%d:%d:%d", &a, &e, &s) == 3) {
+        dirAz = (int8_t)constrain(a, -1, 1);
+        // Câblage El inversé côté Nano: "-1" fait MONTER l'antenne
+        dirEl = (int8_t)-constrain(e, -1, 1);
+        fast = (s != 0);
+        velocityMode = false;
+    } else if (strcmp(line, "STOP") == 0) {
+        dirAz = 0;
+        dirEl = 0;
+        velocityMode = false;
+    } else {
+        return;
+    }
+
+    commands++;
+    lastCommandUs = halNowMicros();
+    reply("OK");
+}
+
+void SimPlant::handleFrame() {
+    uint8_t size = (rxFrame[1] == NANO_FRAME_VEL) ? NANO_VEL_FRAME_SIZE : NANO_FRAME_SIZE;
+    if (nanoSideCrc8(&rxFrame[1], size - 2) != rxFrame[size - 1]) {
+        sendFrame(NANO_FRAME_NACK, rxFrame[2]);
+        return;
+    }
+    if (rxFrame[1] == NANO_FRAME_MOVE) {
+        if (dropCommand()) return;
+        uint8_t arg = rxFrame[3];
+        dirAz = (int8_t)constrain((int)(arg & 0x03) - 1, -1, 1);
+        // Câblage El inversé côté Nano: "-1" fait MONTER l'antenne
+        dirEl = (int8_t)-constrain((int)((arg >> 2) & 0x03) - 1, -1, 1);
+        fast = ((arg >> 4) & 0x03) != 0;
+        velocityMode = false;
+    } else if (rxFrame[1] == NANO_FRAME_VEL) {
+        if (dropCommand()) return;
+        int16_t velAz = (int16_t)(rxFrame[3] | (rxFrame[4] << 8));
+        int16_t velEl = (int16_t)(rxFrame[5] | (rxFrame[6] << 8));
+        rateAz = (float)velAz / (float)(NANO_VEL_SCALE * NANO_STEPS_PER_DEG_AZ);
+        // Câblage El inversé côté Nano
+        rateEl = -(float)velEl / (float)(NANO_VEL_SCALE * NANO_STEPS_PER_DEG_EL);
+        dirAz = (int8_t)((rateAz > 0.0f) - (rateAz < 0.0f));
+        dirEl = (int8_t)((rateEl > 0.0f) - (rateEl < 0.0f));
+        velocityMode = true;
+    } else {
+        return;
+    }
+
+    commands++;
+    lastCommandUs = halNowMicros();
+    sendFrame(NANO_FRAME_ACK, rxFrame[2]);
+}
+
+void SimPlant::sendFrame(uint8_t type, uint8_t arg) {
+    uint8_t frame[5] = { NANO_FRAME_SYNC, type, ++txSeq, arg, 0 };
+    frame[4] = nanoSideCrc8(&frame[1], 3);
+    for (uint8_t i = 0; i < sizeof(frame); i++) {
+        NANO_SERIAL.hostInject(frame[i]);
+    }
+}
+
+void SimPlant::reply(const char *msg) {
+    NANO_SERIAL.hostInject(msg);
+    NANO_SERIAL.hostInject('\n');
+}
+
+void SimPlant::publishLimit(bool active, bool &state, const char *name) {
+    if (active == state) return;
+    state = active;
+    if (active) limitCount++;
+
+    if (binaryMode) {
+        // Masque complet: une trame perdue est corrigée par la suivante
+        uint8_t mask = (limCw ? NANO_LIMIT_BIT_CW : 0) | (limCcw ? NANO_LIMIT_BIT_CCW : 0) |
+                       (limUp ? NANO_LIMIT_BIT_UP : 0) | (limDown ? NANO_LIMIT_BIT_DOWN : 0);
+        sendFrame(NANO_FRAME_LIMIT, mask);
+        return;
+    }
+    NANO_SERIAL.hostInject(active ? "LIMIT:" : "CLEAR:");
+    reply(name);
+}
+
+// ─────────────────────────────────────────────────────────────────
+// INTÉGRATION
+// ─────────────────────────────────────────────────────────────────
+
+void SimPlant::step(uint64_t nowUs) {
+    if (nowUs <= lastStepUs) return;
+
+    // Chien de garde Nano: plus de keepalive → arrêt
+    if (commandTimeoutMs > 0 && (dirAz != 0 || dirEl != 0) &&
+        nowUs - lastCommandUs > (uint64_t)commandTimeoutMs * 1000ULL) {
+        dirAz = 0;
+        dirEl = 0;
+        rateAz = 0.0f;
+        rateEl = 0.0f;
+    }
+
+    trackPowerFail(nowUs);
+    trackTableSweep(nowUs);
+    if (supplyDead) lastStepUs = nowUs;
+
+    while (lastStepUs < nowUs) {
+        uint64_t dtUs = nowUs - lastStepUs;
+        if (dtUs > SIM_SUBSTEP_US) dtUs = SIM_SUBSTEP_US;
+        float dt = (float)dtUs * 1e-6f;
+        #if USE_NANO_STEPPER
+            if (velocityMode) {
+                axisAz.integrateRate(dt, rateAz);
+                axisEl.integrateRate(dt, rateEl);
+            } else {
+                axisAz.integrate(dt, dirAz, fast);
+                axisEl.integrate(dt, dirEl, fast);
+            }
+        #else
+            #if SIM_DC_AZ
+                axisAz.driveDC(dt, bridgeVolts(M1_IN1, M1_IN2, supplyVolts(lastStepUs)),
+                               halGetPinOutput(M1_D2) == LOW);
+            #else
+                axisAz.followSteps(dt, lastStepUs + dtUs);
+            #endif
+            #if SIM_DC_EL
+                axisEl.driveDC(dt, bridgeVolts(M2_IN1, M2_IN2, supplyVolts(lastStepUs)),
+                               halGetPinOutput(M2_D2) == LOW);
+            #else
+                axisEl.followSteps(dt, lastStepUs + dtUs);
+            #endif
+        #endif
+        lastStepUs += dtUs;
+    }
+
+    #if USE_NANO_STEPPER
+        publishLimit(axisAz.atHighLimit(), limCw, "AZ:CW");
+        publishLimit(axisAz.atLowLimit(), limCcw, "AZ:CCW");
+        publishLimit(axisEl.atHighLimit(), limUp, "EL:UP");
+        publishLimit(axisEl.atLowLimit(), limDown, "EL:DOWN");
+    #else
+        // Fins de course série NC sur le Mega: LOW = butée atteinte
+        bool azLimit = axisAz.atHighLimit() || axisAz.atLowLimit();
+        bool elLimit = axisEl.atHighLimit() || axisEl.atLowLimit();
+        if (azLimit && !limCw) limitCount++;
+        if (elLimit && !limUp) limitCount++;
+        limCw = azLimit;
+        limUp = elLimit;
+        halSetPinInput(LIMIT_AZ, azLimit ? LOW : HIGH);
+        halSetPinInput(LIMIT_EL, elLimit ? LOW : HIGH);
+    #endif
+
+    halSetAdc(cfgAz.potPin, axisAz.potAdc(noiseState));
+    halSetAdc(cfgEl.potPin, axisEl.potAdc(noiseState));
+    #if SIM_DC_AZ
+        halSetAdc(M1_FB, feedbackAdc(axisAz.currentAmps()));
+    #endif
+    #if SIM_DC_EL
+        halSetAdc(M2_FB, feedbackAdc(axisEl.currentAmps()));
+    #endif
+    int supplyAdc = (int)(supplyVolts(nowUs) / POWER_SENSE_RATIO / 5.0 * 1024.0);
+    halSetAdc(POWER_SENSE_PIN, min(supplyAdc, POT_ADC_RESOLUTION - 1));
+
+    if (traceFile && tracePeriodUs > 0 && nowUs >= nextTraceUs) {
+        fprintf(traceFile, "%lu,%.3f,%.3f,%.3f,%.3f,%d,%d,%d\n",
+                (unsigned long)(nowUs / 1000ULL),
+                axisAz.outputDeg(), axisEl.outputDeg(),
+                axisAz.velocityDps(), axisEl.velocityDps(),
+                dirAz, dirEl, fast ? 1 : 0);
+        nextTraceUs = nowUs + tracePeriodUs;
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────
+// COUPURE D'ALIMENTATION
+// ─────────────────────────────────────────────────────────────────
+
+float SimPlant::supplyVolts(uint64_t nowUs) const {
+    if (!powerFail || nowUs < powerFailUs) return SIM_SUPPLY_V;
+    if (restoreUs > 0 && nowUs >= powerFailUs + restoreUs) return SIM_SUPPLY_V;
+    float ms = (float)(nowUs - powerFailUs) * 1e-3f;
+    return SIM_SUPPLY_V * expf(-ms / SIM_SUPPLY_TAU_MS);
+}
+
+void SimPlant::trackPowerFail(uint64_t nowUs) {
+    if (!powerFail || nowUs < powerFailUs) return;
+
+    if (!dropSeen) {
+        // Ce que l'enregistrement périodique seul aurait laissé
+        dropSeen = true;
+        journalBeforeValid = journalReadLatest(journalBeforeAz, journalBeforeEl);
+    }
+    if (detectUs == 0 && powerFailCount() > 0) {
+        detectUs = nowUs;
+        detectVolts = supplyVolts(nowUs);
+    }
+
+    // Tenue épuisée (sauf micro-coupure): Mega et Nano éteints
+    bool microCut = restoreUs > 0 && restoreUs < holdupUs;
+    if (!supplyDead && !microCut && nowUs >= powerFailUs + holdupUs) {
+        // Le firmware hôte continue de tourner: journal figé ici
+        supplyDead = true;
+        journalDeadValid = journalReadLatest(journalDeadAz, journalDeadEl);
+        axisAz.halt();
+        axisEl.halt();
+        dirAz = 0;
+        dirEl = 0;
+        rateAz = 0.0f;
+        rateEl = 0.0f;
+    }
+
+    if (detectUs > 0 && stillUs == 0 && !axisAz.isMoving() && !axisEl.isMoving()) {
+        stillUs = nowUs;
+    }
+}
+
+#if (ENCODER_AZ_TYPE == ENCODER_POT_MT) || (ENCODER_EL_TYPE == ENCODER_POT_MT)
+static void reportJournalAxis(FILE *out, const char *name, const SimAxis &axis, float gearRatio,
+                              long before, bool beforeValid, long saved, bool savedValid) {
+    float perDeg = adcPerDegree(gearRatio);
+    long actual = axis.accumulatedAdc();
+    fprintf(out, "  %s  antenne %8.3f°  journal: ", name, axis.outputDeg());
+    if (beforeValid) fprintf(out, "sans sauvegarde %+8.3f°", (before - actual) / perDeg);
+    else fprintf(out, "sans sauvegarde       - ");
+    if (savedValid) fprintf(out, "  final %+8.3f°\n", (saved - actual) / perDeg);
+    else fprintf(out, "  final       -\n");
+}
+#endif
+
+void SimPlant::reportPowerFail(FILE *out) const {
+    if (!powerFail) return;
+
+    fprintf(out, "════ COUPURE ALIMENTATION à t=%lu ms (tenue %lu ms",
+            (unsigned long)(powerFailUs / 1000ULL), (unsigned long)(holdupUs / 1000ULL));
+    if (restoreUs > 0) fprintf(out, ", retour à +%lu ms", (unsigned long)(restoreUs / 1000ULL));
+    fprintf(out, ") ════\n");
+
+    if (!dropSeen) {
+        fprintf(out, "  simulation terminée avant la coupure\n");
+        return;
+    }
+    if (detectUs == 0) {
+        fprintf(out, "  coupure non détectée par le firmware (ENABLE_POWER_MONITOR = %d)\n",
+                ENABLE_POWER_MONITOR);
+    } else {
+        fprintf(out, "  détection        +%6.1f ms (%.2f V)\n",
+                (detectUs - powerFailUs) * 1e-3, detectVolts);
+        if (stillUs > 0) {
+            fprintf(out, "  antenne immobile +%6.1f ms%s\n", (stillUs - powerFailUs) * 1e-3,
+                    supplyDead && stillUs >= powerFailUs + holdupUs ? " (figée par la coupure)" : "");
+        }
+        fprintf(out, "  coupures vues: %u, tenue %s\n", powerFailCount(),
+                supplyDead ? "épuisée (Mega éteint)" : "suffisante (micro-coupure)");
+    }
+
+    // Écart position journalisée - position réelle de l'antenne
+    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT) || (ENCODER_EL_TYPE == ENCODER_POT_MT)
+        long savedAz = journalDeadAz, savedEl = journalDeadEl;
+        bool savedValid = journalDeadValid;
+        if (!supplyDead) savedValid = journalReadLatest(savedAz, savedEl);
+    #endif
+    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
+        reportJournalAxis(out, "Az", axisAz, cfgAz.gearRatio,
+                          journalBeforeAz, journalBeforeValid, savedAz, savedValid);
+    #endif
+    #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
+        reportJournalAxis(out, "El", axisEl, cfgEl.gearRatio,
+                          journalBeforeEl, journalBeforeValid, savedEl, savedValid);
+    #endif
+}
+
+// ─────────────────────────────────────────────────────────────────
+// BALAYAGE DES TABLES
+// ─────────────────────────────────────────────────────────────────
+
+extern long azCorrectionTable[AZ_TABLE_POINTS];   // encoder_ssi.cpp
+extern long elCorrectionTable[EL_TABLE_POINTS];
+
+void SimPlant::trackTableSweep(uint64_t nowUs) {
+    if (!sweep || sweepSent || nowUs < sweepUs) return;
+    sweepSent = true;
+
+    const long *table = sweepEl ? elCorrectionTable : azCorrectionTable;
+    int points = sweepEl ? EL_TABLE_POINTS : AZ_TABLE_POINTS;
+    memcpy(tableBefore, table, points * sizeof(long));
+
+    // Opérateur: approche dans le sens croissant, angle de départ exact
+    if (sweepEl) axisEl.takeUpBacklash(1);
+    else axisAz.takeUpBacklash(1);
+    char cmd[32];
+    snprintf(cmd, sizeof(cmd), "%cSWEEP%.3f\r", sweepEl ? 'E' : 'C',
+             sweepEl ? axisEl.outputDeg() : axisAz.outputDeg());
+    Serial.hostInject(cmd);
+}
+
+void SimPlant::reportTableSweep(FILE *out) const {
+    if (!sweep) return;
+
+    const SimAxis &axis = sweepEl ? axisEl : axisAz;
+    const SimAxisConfig &cfg = sweepEl ? cfgEl : cfgAz;
+    const long *table = sweepEl ? elCorrectionTable : azCorrectionTable;
+    int points = sweepEl ? EL_TABLE_POINTS : AZ_TABLE_POINTS;
+    int first = sweepEl ? EL_TABLE_START : 0;
+    int step = sweepEl ? EL_TABLE_STEP : AZ_TABLE_STEP;
+    float perDeg = adcPerDegree(cfg.gearRatio);
+
+    fprintf(out, "════ BALAYAGE TABLE %s (non-linéarité pot %.1f LSB, bruit ±%.1f LSB) ════\n",
+            sweepEl ? "EL" : "AZ", cfg.potNonlinLsb, cfg.adcNoiseLsb);
+    if (!sweepSent) {
+        fprintf(out, "  simulation terminée avant le balayage\n");
+        return;
+    }
+    if (tableSweepRunning()) {
+        fprintf(out, "  balayage non terminé (durée trop courte)\n");
+        return;
+    }
+
+    // Écart (°) entre la valeur du point et la lecture ADC moyenne à cet
+    // angle (troncature floorf de potAdc: ∓0.5 LSB sous le bruit selon
+    // le sens du pot)
+    double sumBefore = 0.0, sumAfter = 0.0, maxBefore = 0.0, maxAfter = 0.0, maxOutside = 0.0;
+    int inside = 0, outside = 0, worst = first;
+    for (int i = 0; i < points; i++) {
+        float deg = (float)(first + i * step);
+        float truth = axis.countsAt(deg) + (cfg.reverseAdc ? 0.5f : -0.5f);
+        double before = fabs((tableBefore[i] - truth) / perDeg);
+        double after = fabs((table[i] - truth) / perDeg);
+
+        if (deg < cfg.limitLowDeg || deg > cfg.limitHighDeg) {
+            outside++;
+            maxOutside = fmax(maxOutside, after);
+            continue;
+        }
+        inside++;
+        sumBefore += before * before;
+        sumAfter += after * after;
+        maxBefore = fmax(maxBefore, before);
+        if (after > maxAfter) {
+            maxAfter = after;
+            worst = (int)deg;
+        }
+    }
+
+    if (inside > 0) {
+        fprintf(out, "  %2d points dans la course: avant rms %.3f° max %.3f° | après rms %.3f° max %.3f° (%d°)\n",
+                inside, sqrt(sumBefore / inside), maxBefore, sqrt(sumAfter / inside), maxAfter, worst);
+    }
+    if (outside > 0) {
+        fprintf(out, "  %2d points hors course (extrapolés): après max %.3f°\n", outside, maxOutside);
+    }
+    fprintf(out, "  (1 LSB table = %.3f°)\n", 1.0 / perDeg);
+}
+
+// ─────────────────────────────────────────────────────────────────
+// MODE DIRECT: RAPPORT
+// ─────────────────────────────────────────────────────────────────
+
+#if !USE_NANO_STEPPER && !(SIM_DC_AZ && SIM_DC_EL)
+static void reportStepperAxis(FILE *out, const char *name, const SimAxis &axis) {
+    fprintf(out, "  %s  impulsions %8lu | perdues %8lu | décrochages %4lu | vitesse max %6.2f°/s\n",
+            name, axis.pulseCount(), axis.lostPulses(), axis.stallCount(), axis.peakVelocityDps());
+}
+#endif
+
+void SimPlant::reportSteppers(FILE *out) const {
+    #if !USE_NANO_STEPPER && !(SIM_DC_AZ && SIM_DC_EL)
+        fprintf(out, "════ PAS-À-PAS DIRECT (rotor %.1f°/s² max, décrochage à %.0f pas de retard, rampe %s) ════\n",
+                cfgAz.stepperAccelDps2, cfgAz.stallLagSteps,
+                (ENABLE_STEP_TIMER && ENABLE_STEPPER_RAMP) ? "oui" : "non");
+        #if !SIM_DC_AZ
+            reportStepperAxis(out, "Az", axisAz);
+        #endif
+        #if !SIM_DC_EL
+            reportStepperAxis(out, "El", axisEl);
+        #endif
+    #else
+        (void)out;
+    #endif
+}
+
+#if SIM_DC_AZ || SIM_DC_EL
+static void reportDCAxis(FILE *out, const char *name, const SimAxis &axis, uint8_t in1, uint8_t in2) {
+    int duty = halGetPwm(in1);
+    int pwm = (halGetPinOutput(in2) == HIGH) ? 255 - duty : -duty;
+    fprintf(out, "  %s  vitesse max %6.2f°/s | courant max %5.2f A | courant final %5.2f A | PWM final %4d\n",
+            name, axis.peakVelocityDps(), axis.peakCurrentAmps(), axis.currentAmps(), pwm);
+}
+#endif
+
+void SimPlant::reportMotorsDC(FILE *out) const {
+    #if SIM_DC_AZ || SIM_DC_EL
+        fprintf(out, "════ MOTEURS DC (à vide %.1f°/s, τ %.2f s, blocage %.1f A, frottement %.2f A, PID %d ms) ════\n",
+                cfgAz.dcNoLoadDps, cfgAz.dcTauS, cfgAz.dcStallAmps, cfgAz.dcFrictionAmps, PID_PERIOD_MS);
+        #if SIM_DC_AZ
+            reportDCAxis(out, "Az", axisAz, M1_IN1, M1_IN2);
+        #endif
+        #if SIM_DC_EL
+            reportDCAxis(out, "El", axisEl, M2_IN1, M2_IN2);
+        #endif
+    #else
+        (void)out;
+    #endif
+}
+
+// ════════════════════════════════════════════════════════════════
+// SCÉNARIO + MÉTRIQUES
+// ════════════════════════════════════════════════════════════════
+
+SimScenario::SimScenario(const SimPlant &plant) : plant(plant), gotoCount(0), active(-1) {
+}
+
+bool SimScenario::addGoto(unsigned long atMs, float azDeg, float elDeg) {
+    if (gotoCount >= SIM_MAX_GOTO) return false;
+    Goto &g = gotos[gotoCount++];
+    memset(&g, 0, sizeof(g));
+    g.atMs = atMs;
+    g.az = azDeg;
+    g.el = elDeg;
+    return true;
+}
+
+void SimScenario::step(uint64_t nowUs) {
+    for (uint8_t i = 0; i < gotoCount; i++) {
+        Goto &g = gotos[i];
+        if (g.sent || nowUs < (uint64_t)g.atMs * 1000ULL) continue;
+
+        // Injection de la consigne comme PstRotator (Easycom sur Serial)
+        char cmd[32];
+        snprintf(cmd, sizeof(cmd), "AZ%.1f EL%.1f\r", g.az, g.el);
+        Serial.hostInject(cmd);
+
+        if (active >= 0) gotos[active].endUs = nowUs;
+        g.sent = true;
+        g.sentUs = nowUs;
+        resetMetrics(g.mAz, g.az, plant.az(), nowUs);
+        resetMetrics(g.mEl, g.el, plant.el(), nowUs);
+        active = (int8_t)i;
+    }
+
+    if (active >= 0) {
+        track(gotos[active].mAz, plant.az(), currentAz, nowUs);
+        track(gotos[active].mEl, plant.el(), currentEl, nowUs);
+        trackPath(gotos[active]);
+    }
+}
+
+void SimScenario::resetMetrics(AxisMetrics &m, float target, const SimAxis &axis, uint64_t nowUs) {
+    memset(&m, 0, sizeof(m));
+    m.target = target;
+    m.startPos = axis.outputDeg();
+    m.finalPos = m.startPos;
+    m.finalRead = m.startPos;
+    m.wasMoving = axis.isMoving();
+    m.lastStopUs = nowUs;
+}
+
+void SimScenario::track(AxisMetrics &m, const SimAxis &axis, float readDeg, uint64_t nowUs) {
+    bool moving = axis.isMoving();
+
+    if (moving && !m.wasMoving) {
+        m.starts++;
+        if (m.stoppedOnce) m.restarts++;
+    } else if (!moving && m.wasMoving) {
+        m.lastStopUs = nowUs;
+        m.stoppedOnce = true;
+    }
+    m.wasMoving = moving;
+
+    // Dépassement: excursion au-delà de la cible dans le sens du ralliement
+    float sign = (m.target >= m.startPos) ? 1.0f : -1.0f;
+    float excess = sign * (axis.outputDeg() - m.target);
+    if (excess > m.overshoot) m.overshoot = excess;
+
+    m.finalPos = axis.outputDeg();
+    m.finalRead = readDeg;
+}
+
+void SimScenario::trackPath(Goto &g) {
+    // Distance du point courant à la droite départ → consigne
+    float spanAz = g.mAz.target - g.mAz.startPos;
+    float spanEl = g.mEl.target - g.mEl.startPos;
+    float length = hypotf(spanAz, spanEl);
+    if (length <= 0.0f) return;
+
+    float az = plant.az().outputDeg() - g.mAz.startPos;
+    float el = plant.el().outputDeg() - g.mEl.startPos;
+    float deviation = fabsf(az * spanEl - el * spanAz) / length;
+    if (deviation > g.pathDeviation) g.pathDeviation = deviation;
+}
+
+void SimScenario::reportAxis(FILE *out, const char *name, const Goto &g, const AxisMetrics &m) const {
+    fprintf(out, "  %s %7.2f -> %7.2f : ", name, m.startPos, m.target);
+    if (m.wasMoving) {
+        fprintf(out, "NON ÉTABLI");
+    } else if (m.starts == 0) {
+        fprintf(out, "immobile   ");
+    } else {
+        fprintf(out, "établi en %6lu ms", (unsigned long)((m.lastStopUs - g.sentUs) / 1000ULL));
+    }
+    fprintf(out, " | dépassement %.3f° | erreur %+.3f° (lue %+.3f°) | démarrages %u | pompage %u\n",
+            m.overshoot, m.finalPos - m.target, m.finalRead - m.target, m.starts, m.restarts);
+}
+
+void SimScenario::report(FILE *out) const {
+    fprintf(out, "════ SIMULATION: %u consigne(s), tolérance %.2f°, redémarrage %.2f° ════\n",
+            gotoCount, (double)POSITION_TOLERANCE, (double)POSITION_RESTART);
+    for (uint8_t i = 0; i < gotoCount; i++) {
+        const Goto &g = gotos[i];
+        if (!g.sent) {
+            fprintf(out, "#%u t=%lu ms: non envoyée (durée trop courte)\n", i + 1, g.atMs);
+            continue;
+        }
+        fprintf(out, "#%u t=%lu ms: écart max à la droite %.3f°\n", i + 1, g.atMs, g.pathDeviation);
+        reportAxis(out, "Az", g, g.mAz);
+        reportAxis(out, "El", g, g.mEl);
+    }
+    fprintf(out, "Commandes Nano: %lu | fins de course: %lu | perdues: %lu\n",
+            plant.commandCount(), plant.limitEvents(), plant.droppedCommands());
+}
@@ -0,0 +1,400 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Simulateur monture (Nano + rotor + pots)
+// ════════════════════════════════════════════════════════════════
+// Fichier: sim_plant.h
+// Description: Modèle hôte déterministe de la chaîne
+//              Nano stepper → réducteurs → antenne → potentiomètres.
+//              Il consomme les trames "M:dirAz:dirEl:speed" émises
+//              par updateMotorNano() sur NANO_SERIAL et renvoie les
+//              positions par analogRead(POT_PIN_AZ/EL).
+// ════════════════════════════════════════════════════════════════
+// Côté Nano simulé (NANO_SERIAL):
+//   Reçoit : "M:dirAz:dirEl:speed", "STOP"
+//   Renvoie: "OK" à chaque commande,
+//            "LIMIT:AZ:CW" / "CLEAR:AZ:CW" (idem CCW, EL:UP, EL:DOWN)
+//            quand l'antenne atteint / quitte une butée.
+//   Sans commande pendant commandTimeoutMs, le Nano arrête les moteurs
+//   (d'où le keepalive 500 ms du firmware).
+//   "BIN?" → "BIN:OK" puis trames binaires (motor_nano.h): MOVE reçu,
+//   ACK / NACK / LIMIT émis; VEL → vitesse continue (même rampe). setBinarySupport(false) simule un Nano
+//   texte seul (BIN? ignoré), setDropEvery(n) perd une commande sur n.
+//
+// Mécanique (par axe, en degrés ANTENNE):
+//   - vitesse lente / rapide selon le champ speed, rampe d'accélération
+//   - jeu (backlash): zone morte entre moteur et antenne à l'inversion
+//   - butées: fin de course + arrêt mécanique du mouvement
+//   - mode direct (USE_NANO_STEPPER = 0): fronts STEP/DIR du Mega
+//     relevés par le hook d'écriture HAL. Rotor lié à la position
+//     commandée, accélération bornée par le couple (stepperAccelDps2);
+//     retard > stallLagSteps → décrochage: le rotor s'arrête, les pas
+//     sont perdus jusqu'à une cadence de démarrage (pull-in) tenable
+//   - moteur DC (MOTOR_xx_TYPE = MOTOR_DC_BRUSHED, mode direct):
+//     pont MC33926 sign-magnitude lu sur IN1 (PWM) / IN2 / D2, tension
+//     moyenne Vs × (IN2 − IN1/255). Courant i = (V − ke·ω)/R, vitesse
+//     du premier ordre (dcTauS) moins un frottement sec dcFrictionAmps
+//     (décollage au-delà); D2 HIGH → roue libre. Sortie FB
+//     (525 mV/A) publiée sur M1_FB / M2_FB, SF toujours HIGH
+//   - potentiomètre: angle × GEAR_RATIO × 1024/360 + non-linéarité
+//     (sinus d'un tour pot, potNonlinLsb), modulo 1024, bruit ADC
+//     ±adcNoiseLsb, inversion REVERSE_AZ/EL appliquée
+//
+// Coupure d'alimentation (setPowerFail): tension du pont diviseur
+// POWER_SENSE_PIN à 12 V, puis décroissance exponentielle; moteurs et
+// antenne figés à la fin de la tenue (Mega éteint). Mesure la latence
+// de détection, l'arrêt de l'antenne et l'écart entre la position
+// journalisée et la position réelle.
+//
+// Balayage des tables (setTableSweep): envoie "CSWEEP<angle>" /
+// "ESWEEP<angle>" avec l'angle mécanique exact (opérateur avec une
+// référence parfaite) puis compare la table obtenue à la position
+// réelle de chaque point.
+//
+// Scénario (SimScenario): injecte des commandes Easycom "AZx ELy"
+// sur Serial à des instants donnés et mesure pour chaque consigne
+// le temps d'établissement, le dépassement et le pompage
+// (redémarrages après le premier arrêt) autour de
+// POSITION_TOLERANCE / POSITION_RESTART, ainsi que l'écart max à la
+// droite départ → consigne dans le plan Az/El (trajet en "L" ou
+// coordonné, motion_planner.h).
+// ════════════════════════════════════════════════════════════════
+
+#ifndef SIM_PLANT_H
+#define SIM_PLANT_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "config.h"
+#include "hal_native.h"
+
+// ════════════════════════════════════════════════════════════════
+// CONFIGURATION D'UN AXE
+// ════════════════════════════════════════════════════════════════
+
+struct SimAxisConfig {
+    float gearRatio;        // Tours pot pour 1 tour antenne (GEAR_RATIO_xx)
+    float rateSlowDps;      // Vitesse lente (speed=0), °/s antenne
+    float rateFastDps;      // Vitesse rapide (speed=1), °/s antenne
+    float accelDps2;        // Accélération/décélération, °/s²
+    float backlashDeg;      // Jeu total entre moteur et antenne, °
+    float limitLowDeg;      // Fin de course CCW / DOWN, °
+    float limitHighDeg;     // Fin de course CW / UP, °
+    float adcNoiseLsb;      // Amplitude bruit ADC (uniforme ±), LSB
+    float potNonlinLsb;     // Non-linéarité pot: sinus d'un tour pot, LSB crête
+    bool reverseAdc;        // Sens pot inversé (REVERSE_xx)
+    uint8_t potPin;         // Entrée analogique (POT_PIN_xx)
+    float stepsPerDeg;      // Mode direct: pas moteur par degré antenne
+    float stepperAccelDps2; // Mode direct: accélération max du rotor chargé, °/s²
+    float stallLagSteps;    // Mode direct: retard rotor au décrochage (pas)
+    float dcNoLoadDps;      // Moteur DC: vitesse à vide sous SIM_SUPPLY_V, °/s antenne
+    float dcTauS;           // Moteur DC: constante de temps mécanique, s
+    float dcStallAmps;      // Moteur DC: courant de blocage sous SIM_SUPPLY_V, A
+    float dcFrictionAmps;   // Moteur DC: frottement sec (courant de décollage), A
+};
+
+// ════════════════════════════════════════════════════════════════
+// AXE SIMULÉ
+// ════════════════════════════════════════════════════════════════
+
+class SimAxis {
+public:
+    SimAxis();
+
+    void configure(const SimAxisConfig &cfg, float startDeg);
+
+    /**
+     * Intègre le mouvement sur dt secondes
+     * @param dir Direction commandée (-1, 0, 1)
+     * @param fast true = vitesse rapide
+     */
+    void integrate(float dt, int8_t dir, bool fast);
+
+    /**
+     * Intègre le mouvement à vitesse commandée (trame VEL)
+     * @param rateDps Vitesse antenne signée, bornée à rateFastDps
+     */
+    void integrateRate(float dt, float rateDps);
+
+    /**
+     * Front montant STEP (mode direct)
+     * @param dir Niveau DIR: +1 HIGH (CW/UP), -1 LOW
+     */
+    void stepPulse(uint64_t nowUs, int8_t dir);
+
+    /**
+     * Intègre le rotor pas-à-pas sur dt secondes (mode direct)
+     * @param nowUs Fin de l'intervalle (cadence commandée périmée)
+     */
+    void followSteps(float dt, uint64_t nowUs);
+
+    /**
+     * Intègre le moteur DC sur dt secondes
+     * @param volts   Tension moyenne aux bornes (> 0 = CW / UP)
+     * @param enabled false = pont désactivé (D2 HIGH): roue libre
+     */
+    void driveDC(float dt, float volts, bool enabled);
+
+    /**
+     * Valeur ADC 0-1023 vue par analogRead() (bruit inclus)
+     */
+    int potAdc(uint32_t &noiseState) const;
+
+    /**
+     * ADC cumulé équivalent à la position (table linéaire du firmware)
+     */
+    long accumulatedAdc() const;
+
+    /**
+     * Pas ADC cumulés (non arrondis, sans bruit) pour un angle antenne
+     */
+    float countsAt(float deg) const;
+
+    float outputDeg() const { return (float)output; }
+    float velocityDps() const { return velocity; }
+    bool atLowLimit() const { return output <= cfg.limitLowDeg; }
+    bool atHighLimit() const { return output >= cfg.limitHighDeg; }
+    bool isMoving() const { return velocity != 0.0f; }
+
+    /**
+     * Moteur hors tension: arrêt immédiat (réducteur irréversible)
+     */
+    void halt() { velocity = 0.0f; }
+
+    /**
+     * Jeu rattrapé dans le sens dir (approche préalable de l'opérateur)
+     */
+    void takeUpBacklash(int8_t dir) { motor = output + dir * cfg.backlashDeg * 0.5; }
+
+    // Mode direct: impulsions reçues, perdues, décrochages, vitesse max
+    unsigned long pulseCount() const { return pulses; }
+    unsigned long lostPulses() const { return lost; }
+    unsigned long stallCount() const { return stalls; }
+    float peakVelocityDps() const { return peakVelocity; }
+
+    // Moteur DC: courant instantané et crête (A)
+    float currentAmps() const { return current; }
+    float peakCurrentAmps() const { return peakCurrent; }
+
+private:
+    SimAxisConfig cfg;
+    double motor;           // Position côté moteur (°, ramenée à l'antenne)
+                            // double: incréments de ~1e-5° par sous-pas
+    double output;          // Position antenne (après jeu)
+    float velocity;         // Vitesse moteur signée (°/s)
+
+    // Mode direct
+    double commanded;       // Position commandée par les impulsions (°)
+    float commandRate;      // Cadence des impulsions (°/s signés)
+    uint64_t lastPulseUs;
+    uint64_t pulseIntervalUs;
+    bool stalled;
+    unsigned long pulses, lost, stalls;
+    float peakVelocity;
+
+    // Moteur DC
+    float current;
+    float peakCurrent;
+
+    void moveMotor(double delta);
+};
+
+// ════════════════════════════════════════════════════════════════
+// MONTURE + NANO SIMULÉS
+// ════════════════════════════════════════════════════════════════
+
+class SimPlant : public HalModel {
+public:
+    SimPlant();
+
+    /**
+     * Configuration par défaut issue de config.h (à appeler avant begin)
+     */
+    SimAxisConfig &axisConfigAz() { return cfgAz; }
+    SimAxisConfig &axisConfigEl() { return cfgEl; }
+    void setStartPosition(float azDeg, float elDeg) { startAz = azDeg; startEl = elDeg; }
+    void setCommandTimeout(unsigned long ms) { commandTimeoutMs = ms; }
+    void setBinarySupport(bool enabled) { binarySupported = enabled; }
+    void setDropEvery(unsigned long n) { dropEvery = n; }
+    void setTrace(FILE *file, unsigned long periodMs);
+
+    /**
+     * Coupure d'alimentation à t = atMs
+     * @param holdupMs  Tenue du 5 V: moteurs et antenne figés ensuite
+     * @param restoreMs Retour de la tension à atMs + restoreMs
+     *                  (0 = jamais; < holdupMs = micro-coupure tenue)
+     */
+    void setPowerFail(unsigned long atMs, unsigned long holdupMs, unsigned long restoreMs);
+
+    /**
+     * Balayage de table (table_sweep.h) lancé à t = atMs
+     * @param elevation false = CSWEEP (Az), true = ESWEEP (El)
+     */
+    void setTableSweep(unsigned long atMs, bool elevation);
+
+    /**
+     * Raccorde NANO_SERIAL, écrit la position de départ dans l'EEPROM
+     * (ADC cumulé cohérent avec les pots) et enregistre le modèle.
+     * À appeler AVANT setup().
+     */
+    void begin();
+
+    void step(uint64_t nowUs) override;
+
+    const SimAxis &az() const { return axisAz; }
+    const SimAxis &el() const { return axisEl; }
+    int8_t commandDirAz() const { return dirAz; }
+    int8_t commandDirEl() const { return dirEl; }
+
+    // Statistiques globales
+    unsigned long commandCount() const { return commands; }
+    unsigned long limitEvents() const { return limitCount; }
+    unsigned long droppedCommands() const { return dropped; }
+
+    /**
+     * Rapport coupure d'alimentation (si setPowerFail)
+     */
+    void reportPowerFail(FILE *out) const;
+
+    /**
+     * Rapport balayage: écart table - position réelle par point
+     */
+    void reportTableSweep(FILE *out) const;
+
+    /**
+     * Rapport mode direct: impulsions, pas perdus, décrochages
+     */
+    void reportSteppers(FILE *out) const;
+
+    /**
+     * Rapport moteurs DC: vitesse et courant crête
+     */
+    void reportMotorsDC(FILE *out) const;
+
+private:
+    SimAxisConfig cfgAz, cfgEl;
+    SimAxis axisAz, axisEl;
+    float startAz, startEl;
+
+    // Protocole Nano
+    char rxLine[32];
+    uint8_t rxIndex;
+    int8_t dirAz, dirEl;        // Directions antenne (El déjà ré-inversée)
+    bool fast;
+    bool velocityMode;          // Dernière commande = trame VEL
+    float rateAz, rateEl;       // Vitesses commandées (°/s antenne)
+    uint64_t lastCommandUs;
+    unsigned long commandTimeoutMs;
+    unsigned long commands;
+
+    // Trames binaires
+    bool binarySupported;
+    bool binaryMode;
+    uint8_t rxFrame[8];
+    uint8_t rxFrameIndex;
+    uint8_t txSeq;
+    unsigned long dropEvery;    // 0 = liaison parfaite
+    unsigned long received;
+    unsigned long dropped;
+
+    // Fins de course publiées
+    bool limCw, limCcw, limUp, limDown;
+    unsigned long limitCount;
+
+    // Coupure d'alimentation
+    bool powerFail;
+    uint64_t powerFailUs, holdupUs, restoreUs;
+    bool dropSeen;              // Coupure commencée
+    bool supplyDead;            // Tenue épuisée: tout est figé
+    long journalBeforeAz, journalBeforeEl;  // Dernier enregistrement avant coupure
+    bool journalBeforeValid;
+    long journalDeadAz, journalDeadEl;      // Journal à l'extinction du Mega
+    bool journalDeadValid;
+    uint64_t detectUs;          // Coupure vue par le firmware (powerFailCount)
+    uint64_t stillUs;           // Antenne immobile après détection
+    float detectVolts;
+
+    // Balayage de table
+    bool sweep;
+    bool sweepEl;
+    uint64_t sweepUs;
+    bool sweepSent;
+    long tableBefore[AZ_TABLE_POINTS > EL_TABLE_POINTS ? AZ_TABLE_POINTS : EL_TABLE_POINTS];
+
+    uint64_t lastStepUs;
+    uint32_t noiseState;
+
+    FILE *traceFile;
+    uint64_t tracePeriodUs;
+    uint64_t nextTraceUs;
+
+    static void onNanoByte(void *ctx, uint8_t c);
+    static void onPinWrite(uint8_t pin, uint8_t level, uint64_t nowUs);
+    bool dropCommand();
+    void handleLine(const char *line);
+    void handleFrame();
+    void sendFrame(uint8_t type, uint8_t arg);
+    void reply(const char *msg);
+    void publishLimit(bool active, bool &state, const char *name);
+    float supplyVolts(uint64_t nowUs) const;
+    void trackPowerFail(uint64_t nowUs);
+    void trackTableSweep(uint64_t nowUs);
+};
+
+// ════════════════════════════════════════════════════════════════
+// SCÉNARIO DE CONSIGNES + MÉTRIQUES
+// ════════════════════════════════════════════════════════════════
+
+#define SIM_MAX_GOTO 32
+
+class SimScenario : public HalModel {
+public:
+    explicit SimScenario(const SimPlant &plant);
+
+    /**
+     * Ajoute une consigne Easycom envoyée à t = atMs
+     */
+    bool addGoto(unsigned long atMs, float azDeg, float elDeg);
+
+    void step(uint64_t nowUs) override;
+
+    /**
+     * Rapport final (une ligne par consigne et par axe)
+     */
+    void report(FILE *out) const;
+
+private:
+    struct AxisMetrics {
+        float target;
+        float startPos;
+        float overshoot;        // Dépassement max au-delà de la cible (°)
+        uint64_t lastStopUs;    // Dernier passage mouvement → arrêt
+        uint16_t starts;        // Démarrages moteur
+        uint16_t restarts;      // Démarrages après le premier arrêt (pompage)
+        bool stoppedOnce;       // Premier arrêt après consigne atteint
+        bool wasMoving;
+        float finalPos;
+        float finalRead;        // Position lue par le firmware (currentAz/El)
+    };
+
+    struct Goto {
+        unsigned long atMs;
+        float az, el;
+        bool sent;
+        uint64_t sentUs;
+        uint64_t endUs;
+        AxisMetrics mAz, mEl;
+        float pathDeviation;    // Écart max à la droite départ → consigne (°)
+    };
+
+    const SimPlant &plant;
+    Goto gotos[SIM_MAX_GOTO];
+    uint8_t gotoCount;
+    int8_t active;
+
+    void resetMetrics(AxisMetrics &m, float target, const SimAxis &axis, uint64_t nowUs);
+    void track(AxisMetrics &m, const SimAxis &axis, float readDeg, uint64_t nowUs);
+    void trackPath(Goto &g);
+    void reportAxis(FILE *out, const char *name, const Goto &g, const AxisMetrics &m) const;
+};
+
+#endif // SIM_PLANT_H
@@ -0,0 +1,181 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Acquisition ADC sous interruption (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: adc_sampler.cpp
+// Description: ISR ADC_vect, alternance des canaux, décimation
+// ════════════════════════════════════════════════════════════════
+
+#include "adc_sampler.h"
+
+#if ENABLE_ADC_SAMPLER && defined(__AVR__)
+
+// ════════════════════════════════════════════════════════════════
+// CANAUX ÉCHANTILLONNÉS
+// ════════════════════════════════════════════════════════════════
+
+#define ADC_SAMPLES  (1 << (2 * ADC_OVERSAMPLE_BITS))   // Conversions par résultat
+
+// Canal ADC d'une broche analogique (Mega: A0..A15 → 0..15)
+#define ADC_CHANNEL(pin)  ((uint8_t)((pin) - A0))
+
+#if ADC_SUPPLY
+  #define SUPPLY_CHANNEL  ADC_CHANNEL(POWER_SENSE_PIN)
+#else
+  #define SUPPLY_CHANNEL  0
+#endif
+
+static const uint8_t samplerChannels[ADC_CHANNELS] = {
+    ADC_CHANNEL(POT_PIN_AZ),
+    ADC_CHANNEL(POT_PIN_EL),
+    SUPPLY_CHANNEL,
+    ADC_CHANNEL(M1_FB),
+    ADC_CHANNEL(M2_FB)
+};
+
+static const bool samplerEnabled[ADC_CHANNELS] = {
+    ADC_POT_AZ, ADC_POT_EL, ADC_SUPPLY, ADC_CURRENT_AZ, ADC_CURRENT_EL
+};
+
+// ════════════════════════════════════════════════════════════════
+// ÉTAT PARTAGÉ AVEC L'ISR
+// ════════════════════════════════════════════════════════════════
+
+static volatile uint16_t results[ADC_CHANNELS][2];  // [canal][case], double buffer
+static volatile uint8_t front[ADC_CHANNELS];        // Case lisible par canal
+static volatile unsigned long counts[ADC_CHANNELS]; // Résultats publiés par canal
+
+// Accumulation (ISR seule)
+static uint8_t current = ADC_CH_AZ;         // Canal en cours
+static uint16_t sum = 0;
+static uint8_t taken = 0;
+static uint8_t discard = 0;                 // Conversions à jeter après changement
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS INTERNES
+// ════════════════════════════════════════════════════════════════
+
+static void selectChannel(uint8_t ch) {
+    uint8_t mux = samplerChannels[ch];
+
+    // Référence AVCC, MUX4..0 dans ADMUX, MUX5 dans ADCSRB (ADTS = 0: continu)
+    ADMUX = _BV(REFS0) | (mux & 0x07);
+    ADCSRB = (mux & 0x08) ? _BV(MUX5) : 0;
+}
+
+static uint8_t nextChannel(uint8_t ch) {
+    uint8_t next = ch;
+    for (uint8_t i = 0; i < ADC_CHANNELS; i++) {
+        next = (next + 1 == ADC_CHANNELS) ? 0 : next + 1;
+        if (samplerEnabled[next]) return next;
+    }
+    return ch;
+}
+
+// ════════════════════════════════════════════════════════════════
+// ISR
+// ════════════════════════════════════════════════════════════════
+
+ISR(ADC_vect) {
+    uint16_t sample = ADC;      // ADCL puis ADCH
+
+    // Conversion démarrée avant le changement de MUX: ancien canal
+    if (discard > 0) {
+        discard--;
+        return;
+    }
+
+    sum += sample;
+    if (++taken < ADC_SAMPLES) return;
+
+    // Décimation: 4^n conversions → 10 + n bits
+    uint8_t back = front[current] ^ 1;
+    results[current][back] = sum >> ADC_OVERSAMPLE_BITS;
+    front[current] = back;
+    counts[current]++;
+
+    sum = 0;
+    taken = 0;
+
+    // Canal suivant: le MUX est pris au début de la conversion
+    // suivante, celle déjà lancée appartient encore à ce canal
+    uint8_t next = nextChannel(current);
+    if (next != current) {
+        current = next;
+        selectChannel(current);
+        discard = 1;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+void setupAdcSampler() {
+    current = nextChannel(ADC_CHANNELS - 1);   // Premier canal actif
+    sum = 0;
+    taken = 0;
+    discard = 1;
+    selectChannel(current);
+
+    // ADC actif, conversion continue, interruption, prescaler 128 (125 kHz)
+    ADCSRA = _BV(ADEN) | _BV(ADSC) | _BV(ADATE) | _BV(ADIE) |
+             _BV(ADPS2) | _BV(ADPS1) | _BV(ADPS0);
+
+    // Premier résultat de chaque canal avant la première lecture position
+    unsigned long start = millis();
+    while (millis() - start < 50) {
+        bool ready = true;
+        for (uint8_t ch = 0; ch < ADC_CHANNELS; ch++) {
+            if (samplerEnabled[ch] && adcSamplerCount(ch) == 0) ready = false;
+        }
+        if (ready) break;
+    }
+
+    #if DEBUG_SERIAL
+        Serial.print(F("[ADC] Acquisition continue, "));
+        Serial.print(ADC_SAMPLES);
+        Serial.print(F(" conversions/résultat, "));
+        Serial.print(10 + ADC_OVERSAMPLE_BITS);
+        Serial.println(F(" bits"));
+    #endif
+}
+
+uint16_t adcSamplerRead(uint8_t ch) {
+    // Case lisible relue si l'ISR a basculé pendant la copie
+    uint8_t f;
+    uint16_t value;
+    do {
+        f = front[ch];
+        value = results[ch][f];
+    } while (f != front[ch]);
+    return value;
+}
+
+unsigned long adcSamplerCount(uint8_t ch) {
+    noInterrupts();
+    unsigned long n = counts[ch];
+    interrupts();
+    return n;
+}
+
+#else
+
+// Sans ISR (désactivé ou HAL native): analogRead() bloquant
+static uint8_t adcSamplerPin(uint8_t ch) {
+    #if ADC_SUPPLY
+        if (ch == ADC_CH_SUPPLY) return POWER_SENSE_PIN;
+    #endif
+    if (ch == ADC_CH_CURRENT_AZ) return M1_FB;
+    if (ch == ADC_CH_CURRENT_EL) return M2_FB;
+    return (ch == ADC_CH_AZ) ? POT_PIN_AZ : POT_PIN_EL;
+}
+
+void setupAdcSampler() {}
+
+uint16_t adcSamplerRead(uint8_t ch) {
+    return (uint16_t)analogRead(adcSamplerPin(ch)) << POT_FINE_BITS;
+}
+
+unsigned long adcSamplerCount(uint8_t ch) { (void)ch; return 0; }
+
+#endif // ENABLE_ADC_SAMPLER && __AVR__
@@ -10,14 +10,18 @@
 #include "encoder_ssi.h"    // Pour currentAz, currentEl, rawCountsAz, rawCountsEl
 #include "motor_stepper.h"  // Pour targetAz, targetEl, stopAllMotors
 #include "network.h"        // Pour sendToClient
+#include "profiler.h"       // Pour printProfilerReport, profilerReset
+#include "trajectory.h"     // Pour trajectorySetpoint, printTrajectoryReport
+#include "position_journal.h" // Pour journalWrite (RESET)
+#include "table_sweep.h"    // Pour startTableSweep, abortTableSweep
 #include <EEPROM.h>         // Pour sauvegarde calibration
 
 // ════════════════════════════════════════════════════════════════
 // VARIABLES EXTERNES (définies dans autres modules)
 // ════════════════════════════════════════════════════════════════
 
-extern float currentAz;     // encoder_ssi.cpp
-extern float currentEl;     // encoder_ssi.cpp
+extern angle_t currentAzMdeg; // encoder_ssi.cpp
+extern angle_t currentElMdeg; // encoder_ssi.cpp
 extern float targetAz;      // motor_stepper.cpp / motor_nano.cpp
 extern float targetEl;      // motor_stepper.cpp / motor_nano.cpp
 
@@ -27,268 +31,416 @@ extern float targetEl;      // motor_stepper.cpp / motor_nano.cpp
 extern int rawCountsAz;     // encoder_ssi.cpp
 extern int rawCountsEl;     // encoder_ssi.cpp
 extern long turnsAz;        // encoder_ssi.cpp
+extern long turnsEl;        // encoder_ssi.cpp
 extern long offsetStepsAz;  // encoder_ssi.cpp
 extern long offsetStepsEl;  // encoder_ssi.cpp
 
 // ════════════════════════════════════════════════════════════════
-// PARSING COMMANDE PRINCIPALE (style K3NG)
+// DÉCODAGE EN PLACE (sans allocation tas)
 // ════════════════════════════════════════════════════════════════
-
-void parseEasycomCommand(String command) {
-    // Normalisation commande
-    command.toUpperCase();
-    command.trim();
-
-    // Ignorer commandes vides
-    if (command.length() == 0) {
-        return;
+// Le buffer commande (rxBuffer) est normalisé sur place, puis
+// parcouru une seule fois pour repérer les mots-clés AZ, EL, SA/SE.
+// Aucune String: le tas du Mega ne se fragmente plus au fil des
+// commandes de tracking (une toutes les 1-5 s pendant des heures).
+
+static size_t normalizeCommand(char *command) {
+    // Équivalent String::toUpperCase() + trim(), sur place
+    const char *src = command;
+    while (isSpace(*src)) src++;
+
+    size_t len = 0;
+    while (src[len] != '\0') {
+        command[len] = (char)toupper((unsigned char)src[len]);
+        len++;
     }
+    while (len > 0 && isSpace(command[len - 1])) len--;
+    command[len] = '\0';
+    return len;
+}
 
-    #if DEBUG_EASYCOM_RX
-        Serial.print(F("[RX] "));
-        Serial.println(command);
-    #endif
+static bool isNumericChar(char c, bool allowPlus) {
+    return isDigit(c) || c == '.' || c == '-' || (allowPlus && c == '+');
+}
 
-    // ─────────────────────────────────────────────────────────────
-    // COMMANDES ARRÊT (Priorité absolue)
-    // ─────────────────────────────────────────────────────────────
+static bool parseNumberAfter(char *command, size_t from, bool allowPlus, float &value) {
+    // Premier groupe de caractères numériques après 'from'
+    // (mêmes règles que l'ancien parsing: caractères non numériques
+    // ignorés avant le nombre, arrêt au premier après)
+    char *start = command + from;
+    while (*start != '\0' && !isNumericChar(*start, allowPlus)) start++;
+    if (*start == '\0') return false;
+
+    char *end = start;
+    while (isNumericChar(*end, allowPlus)) end++;
+
+    // Terminaison temporaire pour atof(), puis restauration
+    char saved = *end;
+    *end = '\0';
+    value = (float)atof(start);
+    *end = saved;
+    return true;
+}
+
+bool decodeEasycomCommand(char *command, EasycomCommand &cmd) {
+    cmd.type = EASYCOM_NONE;
+    cmd.hasAz = false;
+    cmd.hasEl = false;
+    cmd.az = 0.0;
+    cmd.el = 0.0;
+    cmd.value = 0.0;
+
+    size_t len = normalizeCommand(command);
+    if (len == 0) {
+        return false;
+    }
 
     // ─────────────────────────────────────────────────────────────
-    // COMMANDES ARRÊT: S, SA, SE, SA SE, STOP, ;
-    // PstRotator peut envoyer "SA SE" (les deux ensemble)
+    // PASSE UNIQUE: positions AZ / EL, présence SA / SE
     // ─────────────────────────────────────────────────────────────
-    bool isStopCmd = false;
-
-    // Vérifier différents formats de commande STOP
-    if (command == "S" || command == "STOP" || command == ";") {
-        isStopCmd = true;
-    }
-    // SA seul ou SA suivi d'espace (ex: "SA SE")
-    else if (command == "SA" || command.startsWith("SA ")) {
-        isStopCmd = true;
-    }
-    // SE seul ou SE suivi d'espace
-    else if (command == "SE" || command.startsWith("SE ")) {
-        isStopCmd = true;
-    }
-    // Contient SA ou SE quelque part (ex: "SA SE", "SASE")
-    else if (command.indexOf("SA") != -1 || command.indexOf("SE") != -1) {
-        // Vérifier que ce n'est pas une commande de calibration (ex: S45.0)
-        if (!(command.startsWith("S") && command.length() > 1 && isDigit(command.charAt(1)))) {
-            isStopCmd = true;
+    int posAz = -1;
+    int posEl = -1;
+    bool hasStopPair = false;
+
+    for (size_t i = 0; i + 1 < len; i++) {
+        char c = command[i];
+        char n = command[i + 1];
+        if (c == 'A' && n == 'Z') {
+            if (posAz < 0) posAz = (int)i;
+        } else if (c == 'E' && n == 'L') {
+            if (posEl < 0) posEl = (int)i;
+        } else if (c == 'S' && (n == 'A' || n == 'E')) {
+            hasStopPair = true;
         }
     }
 
-    if (isStopCmd) {
-        targetAz = NO_TARGET;
-        targetEl = NO_TARGET;
-
-        #if DEBUG_MOTOR_CMD
-            Serial.println(F("[STOP] Arrêt demandé"));
-        #endif
-
-        // Feedback immédiat
-        sendPositionResponse();
-        return;
-    }
+    char c0 = command[0];
+    bool digitAfterFirst = (len > 1) && isDigit(command[1]);
 
     // ─────────────────────────────────────────────────────────────
-    // RESET EEPROM: RESET_EEPROM ou RESET
+    // MOTS-CLÉS EXACTS (avant le test SA/SE: "RESET", "CRESET" et
+    // "ERESET" contiennent "SE" et étaient pris pour un STOP)
     // ─────────────────────────────────────────────────────────────
+    if (strcmp(command, "RESET_EEPROM") == 0 || strcmp(command, "RESET") == 0) {
+        cmd.type = EASYCOM_RESET;
+        return true;
+    }
 
-    if (command == "RESET_EEPROM" || command == "RESET") {
-        #if DEBUG_SERIAL
-            Serial.println(F(""));
-            Serial.println(F("════════════════════════════════════════════════════════════════"));
-            Serial.println(F("    RESET EEPROM DEMANDÉ"));
-            Serial.println(F("════════════════════════════════════════════════════════════════"));
-            Serial.println(F(""));
-
-            // Afficher valeurs AVANT
-            Serial.println(F("Valeurs AVANT effacement:"));
-            Serial.print(F("  turnsAz:   ")); Serial.println(turnsAz);
-
-            long turnsElTemp;
-            EEPROM.get(EEPROM_TURNS_EL, turnsElTemp);
-            Serial.print(F("  turnsEl:   ")); Serial.println(turnsElTemp);
-            Serial.print(F("  offsetAz:  ")); Serial.println(offsetStepsAz);
-            Serial.print(F("  offsetEl:  ")); Serial.println(offsetStepsEl);
-            Serial.println(F(""));
-        #endif
-
-        // Effacer toutes les valeurs
-        long zero = 0L;
-        EEPROM.put(EEPROM_TURNS_AZ, zero);
-        EEPROM.put(EEPROM_TURNS_EL, zero);
-        EEPROM.put(EEPROM_OFFSET_AZ, zero);
-        EEPROM.put(EEPROM_OFFSET_EL, zero);
-
-        // Mettre à jour variables globales
-        turnsAz = 0;
-        offsetStepsAz = 0;
-        offsetStepsEl = 0;
-
-        #if DEBUG_SERIAL
-            Serial.println(F("Valeurs APRÈS effacement:"));
-            Serial.print(F("  turnsAz:   ")); Serial.println(turnsAz);
-            Serial.print(F("  turnsEl:   ")); Serial.println(zero);
-            Serial.print(F("  offsetAz:  ")); Serial.println(offsetStepsAz);
-            Serial.print(F("  offsetEl:  ")); Serial.println(offsetStepsEl);
-            Serial.println(F(""));
-            Serial.println(F("════════════════════════════════════════════════════════════════"));
-            Serial.println(F("    ✓ EEPROM EFFACÉE AVEC SUCCÈS"));
-            Serial.println(F("════════════════════════════════════════════════════════════════"));
-            Serial.println(F(""));
-            Serial.println(F("IMPORTANT: Redémarrez l'Arduino (reset) pour que les changements"));
-            Serial.println(F("           soient pris en compte dans tous les modules."));
-            Serial.println(F(""));
-        #endif
+    #if ENABLE_PROFILER
+        if (strcmp(command, "PROF") == 0)    { cmd.type = EASYCOM_PROF;    return true; }
+        if (strcmp(command, "PROFCLR") == 0) { cmd.type = EASYCOM_PROFCLR; return true; }
+    #endif
 
-        sendPositionResponse();
-        return;
-    }
+    #if ENABLE_TRAJECTORY
+        if (strcmp(command, "TRK") == 0)     { cmd.type = EASYCOM_TRK;     return true; }
+        if (strcmp(command, "TRKCLR") == 0)  { cmd.type = EASYCOM_TRKCLR;  return true; }
+    #endif
 
-    // ─────────────────────────────────────────────────────────────
-    // COMMANDES TABLE CORRECTION AZIMUTH (POT_MT uniquement)
-    // ─────────────────────────────────────────────────────────────
-    // C10, C20, etc. → Calibrer point de table (sans reset ADC)
-    // CTABLE → Afficher table complète
-    // CRESET → Réinitialiser table à valeurs linéaires
+    #if SSI_AZ_USED || SSI_EL_USED
+        if (strcmp(command, "SSI") == 0)     { cmd.type = EASYCOM_SSI;     return true; }
+        if (strcmp(command, "SSICLR") == 0)  { cmd.type = EASYCOM_SSICLR;  return true; }
+    #endif
 
-    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
-        // CTABLE: Afficher table correction
-        if (command == "CTABLE") {
-            printAzCorrectionTable();
-            sendPositionResponse();
-            return;
+    // Balayage: "CSWEEP" / "ESWEEP" + angle de départ (avant C<n> / E<n>)
+    #if TABLE_SWEEP_AZ
+        if (strncmp(command, "CSWEEP", 6) == 0 && len > 6) {
+            cmd.type = EASYCOM_CSWEEP;
+            cmd.value = (float)atof(command + 6);
+            return true;
         }
+    #endif
 
-        // CRESET: Réinitialiser table à linéaire
-        if (command == "CRESET") {
-            resetAzCorrectionTable();
-            sendPositionResponse();
-            return;
+    #if TABLE_SWEEP_EL
+        if (strncmp(command, "ESWEEP", 6) == 0 && len > 6) {
+            cmd.type = EASYCOM_ESWEEP;
+            cmd.value = (float)atof(command + 6);
+            return true;
         }
+    #endif
 
-        // C10, C20, etc.: Calibrer un point de table
-        // (sans reset accumulatedAdcAz, juste enregistrer le point)
-        if (command.startsWith("C") && command.length() > 1 && isDigit(command.charAt(1))) {
-            float cal = command.substring(1).toFloat();
-            calibrateAzTablePoint(cal);
-            sendPositionResponse();
-            return;
-        }
+    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
+        if (strcmp(command, "CTABLE") == 0) { cmd.type = EASYCOM_CTABLE; return true; }
+        if (strcmp(command, "CRESET") == 0) { cmd.type = EASYCOM_CRESET; return true; }
+    #endif
+
+    #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
+        if (strcmp(command, "ETABLE") == 0) { cmd.type = EASYCOM_ETABLE; return true; }
+        if (strcmp(command, "ERESET") == 0) { cmd.type = EASYCOM_ERESET; return true; }
     #endif
 
     // ─────────────────────────────────────────────────────────────
-    // COMMANDES TABLE CORRECTION ÉLÉVATION (POT_MT uniquement)
+    // COMMANDES ARRÊT: S, SA, SE, SA SE, STOP, ;
+    // PstRotator peut envoyer "SA SE" (les deux ensemble)
+    // SA ou SE n'importe où = arrêt, sauf calibration S45.0
     // ─────────────────────────────────────────────────────────────
-    // E10, E20, etc. → Calibrer point de table élévation
-    // ETABLE → Afficher table complète
-    // ERESET → Réinitialiser table à valeurs linéaires
-
-    #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
-        // ETABLE: Afficher table correction élévation
-        if (command == "ETABLE") {
-            printElCorrectionTable();
-            sendPositionResponse();
-            return;
-        }
+    if (strcmp(command, "S") == 0 || strcmp(command, "STOP") == 0 || strcmp(command, ";") == 0 ||
+        (hasStopPair && !(c0 == 'S' && digitAfterFirst))) {
+        cmd.type = EASYCOM_STOP;
+        return true;
+    }
 
-        // ERESET: Réinitialiser table élévation à linéaire
-        if (command == "ERESET") {
-            resetElCorrectionTable();
-            sendPositionResponse();
-            return;
+    // ─────────────────────────────────────────────────────────────
+    // POINTS DE TABLE: C10 (azimuth), E10 / E-10 (élévation)
+    // ─────────────────────────────────────────────────────────────
+    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
+        if (c0 == 'C' && digitAfterFirst) {
+            cmd.type = EASYCOM_CPOINT;
+            cmd.value = (float)atof(command + 1);
+            return true;
         }
+    #endif
 
-        // E10, E20, E-10, E-20 etc.: Calibrer un point de table élévation
-        if (command.startsWith("E") && command.length() > 1 && (isDigit(command.charAt(1)) || command.charAt(1) == '-')) {
-            float cal = command.substring(1).toFloat();
-            calibrateElTablePoint(cal);
-            sendPositionResponse();
-            return;
+    #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
+        if (c0 == 'E' && len > 1 && (isDigit(command[1]) || command[1] == '-')) {
+            cmd.type = EASYCOM_EPOINT;
+            cmd.value = (float)atof(command + 1);
+            return true;
         }
     #endif
 
     // ─────────────────────────────────────────────────────────────
-    // CALIBRATION AZIMUTH: Z123.5 (Reset ADC + calibre point table)
+    // CALIBRATION: Z123.5 (azimuth), S45.0 (élévation)
+    // Note: "S" seul = STOP, "S45" = calibration
     // ─────────────────────────────────────────────────────────────
+    if (c0 == 'Z' && len > 1) {
+        cmd.type = EASYCOM_CAL_AZ;
+        cmd.value = (float)atof(command + 1);
+        return true;
+    }
 
-    if (command.startsWith("Z") && command.length() > 1) {
-        float cal = command.substring(1).toFloat();
-        calibrateAz(cal);  // Appel fonction calibration (gère POT_MT et SSI)
-        sendPositionResponse();
-        return;
+    if (c0 == 'S' && digitAfterFirst) {
+        cmd.type = EASYCOM_CAL_EL;
+        cmd.value = (float)atof(command + 1);
+        return true;
     }
 
     // ─────────────────────────────────────────────────────────────
-    // CALIBRATION ÉLÉVATION: S45.0 (S suivi d'un chiffre)
-    // Note: "S" seul = STOP, "S45" = calibration
+    // GOTO / QUERY: AZ123.5 EL45.0, AZ, EL, AZ EL
     // ─────────────────────────────────────────────────────────────
+    cmd.type = EASYCOM_GOTO;
+    if (posAz >= 0) cmd.hasAz = parseNumberAfter(command, posAz + 2, false, cmd.az);
+    if (posEl >= 0) cmd.hasEl = parseNumberAfter(command, posEl + 2, false, cmd.el);
+    return true;
+}
+
+// ════════════════════════════════════════════════════════════════
+// PARSING COMMANDE PRINCIPALE (style K3NG)
+// ════════════════════════════════════════════════════════════════
+
+void parseEasycomCommand(char *command) {
+    EasycomCommand cmd;
 
-    if (command.startsWith("S") && command.length() > 1 && isDigit(command.charAt(1))) {
-        float cal = command.substring(1).toFloat();
-        calibrateEl(cal);  // Appel fonction calibration (gère POT_MT et SSI)
-        sendPositionResponse();
+    // Ignorer commandes vides
+    if (!decodeEasycomCommand(command, cmd)) {
         return;
     }
 
-    // ─────────────────────────────────────────────────────────────
-    // COMMANDES GOTO: AZ123.5 EL45.0
-    // ─────────────────────────────────────────────────────────────
+    #if DEBUG_EASYCOM_RX
+        Serial.print(F("[RX] "));
+        Serial.println(command);
+    #endif
 
-    // Parsing AZ
-    int posAz = command.indexOf("AZ");
-    if (posAz != -1) {
-        String valueStr = "";
-        for (int i = posAz + 2; i < (int)command.length(); i++) {
-            char c = command.charAt(i);
-            if (isDigit(c) || c == '.' || c == '-') {
-                valueStr += c;
-            } else if (valueStr.length() > 0) {
-                break;
-            }
-        }
+    switch (cmd.type) {
+        // ─────────────────────────────────────────────────────────
+        // ARRÊT (Priorité absolue)
+        // ─────────────────────────────────────────────────────────
+        case EASYCOM_STOP:
+            targetAz = NO_TARGET;
+            targetEl = NO_TARGET;
+            trajectoryReset();
+            abortTableSweep();
 
-        if (valueStr.length() > 0) {
-            float newTarget = valueStr.toFloat();
+            #if DEBUG_MOTOR_CMD
+                Serial.println(F("[STOP] Arrêt demandé"));
+            #endif
+            break;
 
-            // Toujours accepter le nouveau target (POSITION_TOLERANCE dans motor_nano
-            // gère le seuil de mouvement, et le Nextion doit voir chaque mise à jour)
-            targetAz = newTarget;
+        // ─────────────────────────────────────────────────────────
+        // RESET EEPROM: RESET_EEPROM ou RESET
+        // ─────────────────────────────────────────────────────────
+        case EASYCOM_RESET: {
+            #if DEBUG_SERIAL
+                Serial.println(F(""));
+                Serial.println(F("════════════════════════════════════════════════════════════════"));
+                Serial.println(F("    RESET EEPROM DEMANDÉ"));
+                Serial.println(F("════════════════════════════════════════════════════════════════"));
+                Serial.println(F(""));
+
+                // Afficher valeurs AVANT
+                Serial.println(F("Valeurs AVANT effacement:"));
+                Serial.print(F("  turnsAz:   ")); Serial.println(turnsAz);
+                Serial.print(F("  turnsEl:   ")); Serial.println(turnsEl);
+                Serial.print(F("  offsetAz:  ")); Serial.println(offsetStepsAz);
+                Serial.print(F("  offsetEl:  ")); Serial.println(offsetStepsEl);
+                Serial.println(F(""));
+            #endif
 
-            #if DEBUG_MOTOR_CMD
-                Serial.print(F("[GOTO] Az="));
-                Serial.println(newTarget, 1);
+            // Effacer toutes les valeurs (tours: nouvel enregistrement journal)
+            long zero = 0L;
+            journalWrite(zero, zero);
+            journalFlush();
+            EEPROM.put(EEPROM_OFFSET_AZ, zero);
+            EEPROM.put(EEPROM_OFFSET_EL, zero);
+
+            // Mettre à jour variables globales
+            turnsAz = 0;
+            turnsEl = 0;
+            offsetStepsAz = 0;
+            offsetStepsEl = 0;
+
+            #if DEBUG_SERIAL
+                Serial.println(F("Valeurs APRÈS effacement:"));
+                Serial.print(F("  turnsAz:   ")); Serial.println(turnsAz);
+                Serial.print(F("  turnsEl:   ")); Serial.println(zero);
+                Serial.print(F("  offsetAz:  ")); Serial.println(offsetStepsAz);
+                Serial.print(F("  offsetEl:  ")); Serial.println(offsetStepsEl);
+                Serial.println(F(""));
+                Serial.println(F("════════════════════════════════════════════════════════════════"));
+                Serial.println(F("    ✓ EEPROM EFFACÉE AVEC SUCCÈS"));
+                Serial.println(F("════════════════════════════════════════════════════════════════"));
+                Serial.println(F(""));
+                Serial.println(F("IMPORTANT: Redémarrez l'Arduino (reset) pour que les changements"));
+                Serial.println(F("           soient pris en compte dans tous les modules."));
+                Serial.println(F(""));
             #endif
+            break;
         }
-    }
 
-    // Parsing EL
-    int posEl = command.indexOf("EL");
-    if (posEl != -1) {
-        String valueStr = "";
-        for (int i = posEl + 2; i < (int)command.length(); i++) {
-            char c = command.charAt(i);
-            if (isDigit(c) || c == '.' || c == '-') {
-                valueStr += c;
-            } else if (valueStr.length() > 0) {
+        // ─────────────────────────────────────────────────────────
+        // PROFILEUR BOUCLE: PROF (rapport) et PROFCLR (remise à zéro)
+        // ─────────────────────────────────────────────────────────
+        #if ENABLE_PROFILER
+            case EASYCOM_PROF:
+                printProfilerReport();
+                break;
+
+            case EASYCOM_PROFCLR:
+                profilerReset();
+                break;
+        #endif
+
+        // ─────────────────────────────────────────────────────────
+        // POURSUITE: TRK (rapport) et TRKCLR (remise à zéro)
+        // ─────────────────────────────────────────────────────────
+        #if ENABLE_TRAJECTORY
+            case EASYCOM_TRK:
+                printTrajectoryReport();
+                break;
+
+            case EASYCOM_TRKCLR:
+                trajectoryClearStats();
+                break;
+        #endif
+
+        // ─────────────────────────────────────────────────────────
+        // ENCODEURS SSI: SSI (compteurs trames) et SSICLR (remise à zéro)
+        // ─────────────────────────────────────────────────────────
+        #if SSI_AZ_USED || SSI_EL_USED
+            case EASYCOM_SSI:
+                printSSIReport();
+                break;
+
+            case EASYCOM_SSICLR:
+                ssiClearStats();
+                break;
+        #endif
+
+        // ─────────────────────────────────────────────────────────
+        // TABLE CORRECTION AZIMUTH (POT_MT uniquement)
+        // ─────────────────────────────────────────────────────────
+        // C10, C20, etc. → Calibrer point de table (sans reset ADC)
+        // CTABLE → Afficher table complète
+        // CRESET → Réinitialiser table à valeurs linéaires
+        #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
+            case EASYCOM_CTABLE:
+                printAzCorrectionTable();
+                break;
+
+            case EASYCOM_CRESET:
+                resetAzCorrectionTable();
+                break;
+
+            case EASYCOM_CPOINT:
+                calibrateAzTablePoint(cmd.value);
+                break;
+        #endif
+
+        // ─────────────────────────────────────────────────────────
+        // BALAYAGE AUTOMATIQUE DES TABLES (table_sweep.h)
+        // ─────────────────────────────────────────────────────────
+        // CSWEEP12.5 → balayage Az, antenne actuellement à 12.5°
+        // ESWEEP-5   → balayage El, antenne actuellement à -5°
+        #if TABLE_SWEEP_AZ
+            case EASYCOM_CSWEEP:
+                if (!startTableSweep(SWEEP_AXIS_AZ, cmd.value)) sendToClient("SWEEP AZ refuse\r\n");
+                break;
+        #endif
+
+        #if TABLE_SWEEP_EL
+            case EASYCOM_ESWEEP:
+                if (!startTableSweep(SWEEP_AXIS_EL, cmd.value)) sendToClient("SWEEP EL refuse\r\n");
+                break;
+        #endif
+
+        // ─────────────────────────────────────────────────────────
+        // TABLE CORRECTION ÉLÉVATION (POT_MT uniquement)
+        // ─────────────────────────────────────────────────────────
+        // E10, E20, E-10 etc. → Calibrer point de table élévation
+        // ETABLE → Afficher table complète
+        // ERESET → Réinitialiser table à valeurs linéaires
+        #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
+            case EASYCOM_ETABLE:
+                printElCorrectionTable();
+                break;
+
+            case EASYCOM_ERESET:
+                resetElCorrectionTable();
+                break;
+
+            case EASYCOM_EPOINT:
+                calibrateElTablePoint(cmd.value);
                 break;
+        #endif
+
+        // ─────────────────────────────────────────────────────────
+        // CALIBRATION: Z123.5 / S45.0 (gère POT_MT et SSI)
+        // ─────────────────────────────────────────────────────────
+        case EASYCOM_CAL_AZ:
+            calibrateAz(cmd.value);
+            break;
+
+        case EASYCOM_CAL_EL:
+            calibrateEl(cmd.value);
+            break;
+
+        // ─────────────────────────────────────────────────────────
+        // GOTO: AZ123.5 EL45.0 (query si aucune valeur)
+        // ─────────────────────────────────────────────────────────
+        case EASYCOM_GOTO:
+            // Toujours accepter le nouveau target (POSITION_TOLERANCE dans motor_nano
+            // gère le seuil de mouvement, et le Nextion doit voir chaque mise à jour)
+            if (cmd.hasAz) {
+                targetAz = cmd.az;
+                trajectorySetpoint(TRAJ_AZ, cmd.az);
+
+                #if DEBUG_MOTOR_CMD
+                    Serial.print(F("[GOTO] Az="));
+                    Serial.println(cmd.az, 1);
+                #endif
             }
-        }
 
-        if (valueStr.length() > 0) {
-            float newTarget = valueStr.toFloat();
+            if (cmd.hasEl) {
+                targetEl = cmd.el;
+                trajectorySetpoint(TRAJ_EL, cmd.el);
 
-            // Toujours accepter le nouveau target
-            targetEl = newTarget;
+                #if DEBUG_MOTOR_CMD
+                    Serial.print(F("[GOTO] El="));
+                    Serial.println(cmd.el, 1);
+                #endif
+            }
+            break;
 
-            #if DEBUG_MOTOR_CMD
-                Serial.print(F("[GOTO] El="));
-                Serial.println(newTarget, 1);
-            #endif
-        }
+        default:
+            break;
     }
 
     // ─────────────────────────────────────────────────────────────
@@ -298,17 +450,111 @@ void parseEasycomCommand(String command) {
     sendPositionResponse();
 }
 
+// ════════════════════════════════════════════════════════════════
+// RÉPONSE POSITION (virgule fixe, buffer statique + cache)
+// ════════════════════════════════════════════════════════════════
+// PstRotator interroge plusieurs fois par seconde: l'ancienne
+// version faisait 4 concaténations String + 2 String(float, 1)
+// (dtostrf) à chaque commande. Ici la position (millidegrés) est
+// convertie en dixièmes de degré entiers, et la réponse n'est
+// reformatée que si ces dixièmes changent. Position identique à
+// l'appel précédent (antenne arrêtée): aucune conversion.
+
+// "AZ-xxxxxxxxxx.x EL-xxxxxxxxxx.x\r\n" au pire: 34 caractères + '\0'
+#define POSITION_RESPONSE_SIZE 40
+
+static char positionResponse[POSITION_RESPONSE_SIZE];
+static int32_t cachedTenthsAz = 0;
+static int32_t cachedTenthsEl = 0;
+static angle_t cachedMdegAz = 0;
+static angle_t cachedMdegEl = 0;
+static bool positionCacheValid = false;
+
+// Dixièmes au-delà: "ovf" (positions réelles très loin en dessous)
+#define ANGLE_TENTHS_MAX  999999999.0
+
+int32_t angleToTenths(float value) {
+    // Clé de cache: dixièmes arrondis, signe inclus ("-0.0" ≠ "0.0")
+    // NaN / dépassement → ANGLE_TENTHS_INVALID (toujours reformaté)
+    double tenths = fabs((double)value) * 10.0 + 0.5;
+    if (!(tenths < ANGLE_TENTHS_MAX)) return ANGLE_TENTHS_INVALID;
+    int32_t key = (int32_t)tenths;
+    return signbit(value) ? ~key : key;
+}
+
+int32_t mdegToTenths(angle_t mdeg) {
+    // Même clé que angleToTenths(): demi vers le haut, négatif → ~dixièmes
+    uint32_t magnitude = (mdeg < 0) ? 0UL - (uint32_t)mdeg : (uint32_t)mdeg;
+    // ÷100 par réciproque (×0x51EB851F >> 37, exact sur 32 bits):
+    // __umulsidi3 au lieu de la division logicielle __udivmodsi4
+    int32_t key = (int32_t)(((uint64_t)(magnitude + 50) * 0x51EB851FUL) >> 37);
+    return (mdeg < 0) ? ~key : key;
+}
+
+char *formatTenths(char *out, int32_t key) {
+    // Écrit la clé en "[-]entier.dixième", renvoie la fin
+    if (key == ANGLE_TENTHS_INVALID) {
+        memcpy(out, "ovf", 3);
+        return out + 3;
+    }
+
+    if (key < 0) {
+        *out++ = '-';
+        key = ~key;
+    }
+
+    uint32_t whole = (uint32_t)key / 10;
+    char digits[10];
+    uint8_t n = 0;
+    do {
+        digits[n++] = (char)('0' + whole % 10);
+        whole /= 10;
+    } while (whole != 0);
+    while (n > 0) *out++ = digits[--n];
+
+    *out++ = '.';
+    *out++ = (char)('0' + (uint32_t)key % 10);
+    return out;
+}
+
+const char *getPositionResponse() {
+    PROF_SECTION_START(profResponse);
+
+    if (positionCacheValid && currentAzMdeg == cachedMdegAz && currentElMdeg == cachedMdegEl) {
+        PROF_SECTION_END(PROF_RESPONSE, profResponse);
+        return positionResponse;
+    }
+    cachedMdegAz = currentAzMdeg;
+    cachedMdegEl = currentElMdeg;
+
+    int32_t keyAz = mdegToTenths(currentAzMdeg);
+    int32_t keyEl = mdegToTenths(currentElMdeg);
+
+    if (!positionCacheValid || keyAz != cachedTenthsAz || keyEl != cachedTenthsEl) {
+        // Format Easycom: "AZ123.5 EL45.0\r\n"
+        char *p = positionResponse;
+        *p++ = 'A'; *p++ = 'Z';
+        p = formatTenths(p, keyAz);
+        *p++ = ' '; *p++ = 'E'; *p++ = 'L';
+        p = formatTenths(p, keyEl);
+        *p++ = '\r'; *p++ = '\n';
+        *p = '\0';
+
+        cachedTenthsAz = keyAz;
+        cachedTenthsEl = keyEl;
+        positionCacheValid = true;
+    }
+
+    PROF_SECTION_END(PROF_RESPONSE, profResponse);
+    return positionResponse;
+}
+
 // ════════════════════════════════════════════════════════════════
 // ENVOI RÉPONSE POSITION
 // ════════════════════════════════════════════════════════════════
 
 void sendPositionResponse() {
-    // Format Easycom: "AZ123.5 EL45.0\r\n"
-    String response = "AZ";
-    response += String(currentAz, 1);
-    response += " EL";
-    response += String(currentEl, 1);
-    response += "\r\n";
+    const char *response = getPositionResponse();
 
     sendToClient(response);
 
@@ -323,68 +569,53 @@ void sendPositionResponse() {
 // ════════════════════════════════════════════════════════════════
 
 String generatePositionResponse() {
-    String response = "AZ";
-    response += String(currentAz, 1);
-    response += " EL";
-    response += String(currentEl, 1);
-    response += "\r\n";
-    return response;
+    return String(getPositionResponse());
 }
 
 // ════════════════════════════════════════════════════════════════
 // PARSING VALEUR NUMÉRIQUE (utilitaire)
 // ════════════════════════════════════════════════════════════════
 
-float parseNumericValue(String command, String keyword, bool &valueFound) {
-    int pos = command.indexOf(keyword);
+float parseNumericValue(const char *command, const char *keyword, bool &valueFound) {
+    const char *pos = strstr(command, keyword);
 
-    if (pos == -1) {
+    if (pos == NULL) {
         valueFound = false;
         return 0.0;
     }
 
-    String valueStr = "";
-    int startPos = pos + keyword.length();
-
-    for (int i = startPos; i < (int)command.length(); i++) {
-        char c = command.charAt(i);
-        if (isDigit(c) || c == '.' || c == '-' || c == '+') {
-            valueStr += c;
-        } else if (valueStr.length() > 0) {
-            break;
-        }
-    }
-
-    if (valueStr.length() > 0) {
-        valueFound = true;
-        return valueStr.toFloat();
-    }
+    // Copie locale: parseNumberAfter termine temporairement le nombre
+    char buffer[RX_BUFFER_SIZE];
+    strncpy(buffer, pos + strlen(keyword), sizeof(buffer) - 1);
+    buffer[sizeof(buffer) - 1] = '\0';
 
-    valueFound = false;
-    return 0.0;
+    float value = 0.0;
+    valueFound = parseNumberAfter(buffer, 0, true, value);
+    return value;
 }
 
 // ════════════════════════════════════════════════════════════════
 // DÉTECTION QUERY POSITION
 // ════════════════════════════════════════════════════════════════
 
-bool isPositionQuery(String command) {
-    return (command == "AZ" || command == "EL" || command == "AZ EL");
+bool isPositionQuery(const char *command) {
+    return (strcmp(command, "AZ") == 0 || strcmp(command, "EL") == 0 || strcmp(command, "AZ EL") == 0);
 }
 
 // ════════════════════════════════════════════════════════════════
 // DÉTECTION COMMANDE STOP
 // ════════════════════════════════════════════════════════════════
 
-bool isStopCommand(String command) {
-    return (command == "S" || command == "SA" || command == "SE" || command == "STOP");
+bool isStopCommand(const char *command) {
+    return (strcmp(command, "S") == 0 || strcmp(command, "SA") == 0 ||
+            strcmp(command, "SE") == 0 || strcmp(command, "STOP") == 0);
 }
 
 // ════════════════════════════════════════════════════════════════
 // DEBUG AFFICHAGE
 // ════════════════════════════════════════════════════════════════
 
-void printEasycomDebug(String command) {
+void printEasycomDebug(const char *command) {
     Serial.print(F("[EASYCOM] "));
     Serial.println(command);
 }
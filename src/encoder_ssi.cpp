@@ -8,16 +8,28 @@
 #include "encoder_ssi.h"
 #include "easycom.h"  // Pour printEncoderRawDebug()
 #include "network.h"  // Pour sendToClient()
+#include "adc_sampler.h"  // Pour adcSamplerRead()
+#include "running_average.h"
+#include "table_lookup.h"
+#include "position_estimator.h"
+#include "step_fusion.h"
+#include "position_journal.h"
 #include <EEPROM.h>
 
 // ════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES
 // ════════════════════════════════════════════════════════════════
 
-// Position courante en degrés
+// Position courante en millidegrés (angle.h) et miroir en degrés
+angle_t currentAzMdeg = 0;
+angle_t currentElMdeg = 0;
 float currentAz = 0.0;
 float currentEl = 0.0;
 
+// Vitesse estimée (°/s Q16), pots multi-tours seulement
+long currentAzRateQ16 = 0;
+long currentElRateQ16 = 0;
+
 // Valeurs brutes encodeurs
 int rawCountsAz = 0;
 int rawCountsEl = 0;
@@ -29,6 +41,8 @@ int previousRawEl = 0;
 // Accumulation ADC pour méthode cumulative (POT_MT)
 long accumulatedAdcAz = 0;  // ADC total accumulé depuis calibration
 long accumulatedAdcEl = 0;
+long accumulatedFineAz = 0;  // Même accumulation en unités fines
+long accumulatedFineEl = 0;
 
 // Tracking tours (utilisé pour SSI_INC, gardé pour compatibilité)
 long turnsAz = 0;
@@ -43,24 +57,43 @@ unsigned long lastEncoderReadTime = 0;
 
 // Variables filtrage potentiomètre (moyenne glissante)
 #if (ENCODER_AZ_TYPE == ENCODER_POT_1T) || (ENCODER_AZ_TYPE == ENCODER_POT_MT)
-    int potAdcBufferAz[POT_SAMPLES_AZ] = {0};  // Buffer circulaire ADC azimuth
-    int potBufferIndexAz = 0;                   // Index buffer circulaire azimuth
-    bool potBufferFullAz = false;               // Flag buffer plein azimuth
+    RunningAverage<int, POT_SAMPLES_AZ> potFilterAz;  // Moyenne glissante ADC azimuth
 #endif
 
 #if (ENCODER_EL_TYPE == ENCODER_POT_1T) || (ENCODER_EL_TYPE == ENCODER_POT_MT)
-    int potAdcBufferEl[POT_SAMPLES_EL] = {0};  // Buffer circulaire ADC élévation
-    int potBufferIndexEl = 0;                   // Index buffer circulaire élévation
-    bool potBufferFullEl = false;               // Flag buffer plein élévation
+    RunningAverage<int, POT_SAMPLES_EL> potFilterEl;  // Moyenne glissante ADC élévation
 #endif
 
 // Variables tracking tours potentiomètre multi-tours
 // Note: On utilise turnsAz/turnsEl (variables globales) pour les compteurs de tours POT_MT
 // previousRawAdc est déclaré static dans updateEncoders() pour la détection wraparound
 
-// Filtrage EMA azimuth (module-level pour reset lors calibration)
-float filteredAz = 0.0;
-bool azFilterInitialized = false;
+// Estimateur position/vitesse azimuth (module-level pour reset lors calibration)
+PositionEstimator estimatorAz = {0, 0, false};
+
+// Fusion pas commandés / estimateur (step_fusion.h)
+static StepFusion fusionAz = {0, 0, 0, 0, 0, false};
+
+// Valeurs enregistrées dans le journal EEPROM (position_journal.h):
+// ADC cumulé pour POT_MT, compteur de tours sinon
+#if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
+  #define JOURNAL_VALUE_AZ     accumulatedAdcAz
+  #define JOURNAL_DEADBAND_AZ  EEPROM_JOURNAL_DEADBAND
+#else
+  #define JOURNAL_VALUE_AZ     turnsAz
+  #define JOURNAL_DEADBAND_AZ  0
+#endif
+#if (ENCODER_EL_TYPE == ENCODER_POT_MT)
+  #define JOURNAL_VALUE_EL     accumulatedAdcEl
+  #define JOURNAL_DEADBAND_EL  EEPROM_JOURNAL_DEADBAND
+#else
+  #define JOURNAL_VALUE_EL     turnsEl
+  #define JOURNAL_DEADBAND_EL  0
+#endif
+
+static void journalPosition() {
+    journalWrite(JOURNAL_VALUE_AZ, JOURNAL_VALUE_EL);
+}
 
 // ════════════════════════════════════════════════════════════════
 // TABLE DE CORRECTION AZIMUTH (35 points)
@@ -72,6 +105,12 @@ bool azFilterInitialized = false;
 long azCorrectionTable[AZ_TABLE_POINTS];  // ADC cumulé pour chaque point
 bool azTableLoaded = false;               // Table chargée depuis EEPROM
 
+// Pentes par segment, recalculées à chaque modification (voir table_lookup.h)
+static long azSlopes[AZ_TABLE_POINTS - 1];
+static TableLookup azLookup = {
+    azCorrectionTable, azSlopes, AZ_TABLE_POINTS, 0, AZ_TABLE_STEP * 1000L, 0
+};
+
 // ════════════════════════════════════════════════════════════════
 // TABLE DE CORRECTION ÉLÉVATION (10 points)
 // ════════════════════════════════════════════════════════════════
@@ -80,9 +119,193 @@ bool azTableLoaded = false;               // Table chargée depuis EEPROM
 long elCorrectionTable[EL_TABLE_POINTS];  // ADC cumulé pour chaque point
 bool elTableLoaded = false;               // Table chargée depuis EEPROM
 
-// Filtrage EMA élévation (module-level pour reset lors calibration)
-float filteredEl = 0.0;
-bool elFilterInitialized = false;
+static long elSlopes[EL_TABLE_POINTS - 1];
+static TableLookup elLookup = {
+    elCorrectionTable, elSlopes, EL_TABLE_POINTS, EL_TABLE_START * 1000L, EL_TABLE_STEP * 1000L, 0
+};
+
+// Estimateur position/vitesse élévation (module-level pour reset lors calibration)
+PositionEstimator estimatorEl = {0, 0, false};
+static StepFusion fusionEl = {0, 0, 0, 0, 0, false};
+
+// ════════════════════════════════════════════════════════════════
+// POSITION EN VIRGULE FIXE
+// ════════════════════════════════════════════════════════════════
+
+// Échelles compteurs → millidegrés (Q16, voir angle.h)
+#define SSI_AZ_SCALE     ANGLE_SCALE_Q16(360000.0 / (SSI_COUNTS_PER_REV * GEAR_RATIO_AZ))
+#define SSI_EL_SCALE     ANGLE_SCALE_Q16(90000.0 / 4095.0)
+#define POT_1T_AZ_SCALE  ANGLE_SCALE_Q16(360000.0 / ((long)POT_ADC_RESOLUTION << POT_FINE_BITS))
+#define POT_1T_EL_SCALE  ANGLE_SCALE_Q16(360000.0 / ((long)POT_ADC_RESOLUTION << POT_FINE_BITS) / GEAR_RATIO_EL)
+#define POT_MT_AZ_SCALE  ANGLE_SCALE_Q16(360000.0 / (1024L << POT_FINE_BITS) / GEAR_RATIO_AZ)
+#define POT_MT_EL_SCALE  ANGLE_SCALE_Q16(360000.0 / (1024L << POT_FINE_BITS) / GEAR_RATIO_EL)
+
+static void setPositionAz(angle_t angle) {
+    currentAzMdeg = angle;
+    currentAz = angleToDegrees(angle);     // Miroir float (hors chemin critique)
+}
+
+static void setPositionEl(angle_t angle) {
+    currentElMdeg = angle;
+    currentEl = angleToDegrees(angle);
+}
+
+// Moteur commandé (gains de l'estimateur): direction envoyée au
+// Nano, sinon drapeau de mouvement du pilotage direct
+#if USE_NANO_STEPPER
+    extern int8_t currentDirAz;
+    extern int8_t currentDirEl;
+    #define AXIS_COMMANDED_AZ  (currentDirAz != 0)
+    #define AXIS_COMMANDED_EL  (currentDirEl != 0)
+#else
+    extern bool movingAz;
+    extern bool movingEl;
+    #define AXIS_COMMANDED_AZ  movingAz
+    #define AXIS_COMMANDED_EL  movingEl
+#endif
+
+static void resetEstimatorAz(angle_t angle) {
+    estimatorReset(estimatorAz, angle);
+    fusionReset(fusionAz);
+    currentAzRateQ16 = 0;
+}
+
+static void resetEstimatorEl(angle_t angle) {
+    estimatorReset(estimatorEl, angle);
+    fusionReset(fusionEl);
+    currentElRateQ16 = 0;
+}
+
+// ════════════════════════════════════════════════════════════════
+// ACCÈS DIRECT PORTS SSI
+// ════════════════════════════════════════════════════════════════
+// digitalWrite/digitalRead coûtent ~50 cycles par appel (table pin →
+// port à chaque fois). Les registres et masques sont résolus une fois
+// dans setupEncoders, chaque front CLK devient une seule écriture.
+// Hors AVR (HAL native): repli sur digitalWrite/digitalRead.
+
+#if defined(__AVR__)
+static volatile uint8_t *ssiClkOut;
+static volatile uint8_t *ssiCsAzOut;
+static volatile uint8_t *ssiCsElOut;
+static volatile uint8_t *ssiDataAzIn;
+static volatile uint8_t *ssiDataElIn;
+static uint8_t ssiClkMask, ssiCsAzMask, ssiCsElMask, ssiDataAzMask, ssiDataElMask;
+
+#if SSI_AZ_USED || SSI_EL_USED
+static void setupSSIPorts() {
+    ssiClkOut     = portOutputRegister(digitalPinToPort(SSI_CLK));
+    ssiCsAzOut    = portOutputRegister(digitalPinToPort(SSI_CS_AZ));
+    ssiCsElOut    = portOutputRegister(digitalPinToPort(SSI_CS_EL));
+    ssiDataAzIn   = portInputRegister(digitalPinToPort(SSI_DATA_AZ));
+    ssiDataElIn   = portInputRegister(digitalPinToPort(SSI_DATA_EL));
+    ssiClkMask    = digitalPinToBitMask(SSI_CLK);
+    ssiCsAzMask   = digitalPinToBitMask(SSI_CS_AZ);
+    ssiCsElMask   = digitalPinToBitMask(SSI_CS_EL);
+    ssiDataAzMask = digitalPinToBitMask(SSI_DATA_AZ);
+    ssiDataElMask = digitalPinToBitMask(SSI_DATA_EL);
+}
+#endif
+
+// Lecture-modification-écriture: appelées interruptions coupées
+#define SSI_CLK_LOW()     (*ssiClkOut &= ~ssiClkMask)
+#define SSI_CLK_HIGH()    (*ssiClkOut |= ssiClkMask)
+#define SSI_CS_AZ_LOW()   (*ssiCsAzOut &= ~ssiCsAzMask)
+#define SSI_CS_AZ_HIGH()  (*ssiCsAzOut |= ssiCsAzMask)
+#define SSI_CS_EL_LOW()   (*ssiCsElOut &= ~ssiCsElMask)
+#define SSI_CS_EL_HIGH()  (*ssiCsElOut |= ssiCsElMask)
+#define SSI_DATA_AZ_BIT() ((*ssiDataAzIn & ssiDataAzMask) != 0)
+#define SSI_DATA_EL_BIT() ((*ssiDataElIn & ssiDataElMask) != 0)
+
+#else
+#if SSI_AZ_USED || SSI_EL_USED
+static void setupSSIPorts() {}
+#endif
+
+#define SSI_CLK_LOW()     digitalWrite(SSI_CLK, LOW)
+#define SSI_CLK_HIGH()    digitalWrite(SSI_CLK, HIGH)
+#define SSI_CS_AZ_LOW()   digitalWrite(SSI_CS_AZ, LOW)
+#define SSI_CS_AZ_HIGH()  digitalWrite(SSI_CS_AZ, HIGH)
+#define SSI_CS_EL_LOW()   digitalWrite(SSI_CS_EL, LOW)
+#define SSI_CS_EL_HIGH()  digitalWrite(SSI_CS_EL, HIGH)
+#define SSI_DATA_AZ_BIT() (digitalRead(SSI_DATA_AZ) == HIGH)
+#define SSI_DATA_EL_BIT() (digitalRead(SSI_DATA_EL) == HIGH)
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// VALIDATION TRAMES SSI
+// ════════════════════════════════════════════════════════════════
+
+struct SSIAxisStats {
+    unsigned long frames[SSI_FRAME_CODES];  // Trames lues par état (SSI_FRAME_xxx)
+    unsigned long retries;                  // Relectures après trame invalide
+    unsigned long rejected;                 // Lectures rejetées (budget épuisé)
+    uint8_t lastStatus;                     // État de la dernière trame
+};
+
+static SSIAxisStats ssiStats[2];
+
+#if SSI_AZ_USED
+// Première trame valide: référence du suivi de tours azimuth
+static bool ssiSeededAz = false;
+#endif
+
+static bool ssiFrameAccepted(uint8_t axis, unsigned long frame) {
+    uint8_t status = ssiFrameStatus(frame);
+    ssiStats[axis].frames[status]++;
+    ssiStats[axis].lastStatus = status;
+    return status == SSI_FRAME_OK;
+}
+
+/**
+ * Lecture validée des trames Az/El
+ * Les axes invalides sont relus ensemble, SSI_MAX_RETRIES fois au plus
+ *
+ * @param validAz true si trame Az acceptée (frameAz valide)
+ * @param validEl true si trame El acceptée (frameEl valide)
+ */
+static void readCheckedSSIFrames(bool readAz, bool readEl,
+                                 unsigned long &frameAz, unsigned long &frameEl,
+                                 bool &validAz, bool &validEl) {
+    bool pendingAz = readAz;
+    bool pendingEl = readEl;
+
+    for (uint8_t attempt = 0; ; attempt++) {
+        unsigned long az, el;
+        readSSIFrames(pendingAz, pendingEl, az, el);
+
+        if (pendingAz && ssiFrameAccepted(SSI_AXIS_AZ, az)) {
+            frameAz = az;
+            pendingAz = false;
+        }
+        if (pendingEl && ssiFrameAccepted(SSI_AXIS_EL, el)) {
+            frameEl = el;
+            pendingEl = false;
+        }
+
+        if (!pendingAz && !pendingEl) break;
+        if (attempt >= SSI_MAX_RETRIES) break;
+
+        if (pendingAz) ssiStats[SSI_AXIS_AZ].retries++;
+        if (pendingEl) ssiStats[SSI_AXIS_EL].retries++;
+        delayMicroseconds(SSI_HALF_PERIOD_US);  // CS HIGH minimum entre trames
+    }
+
+    if (pendingAz) ssiStats[SSI_AXIS_AZ].rejected++;
+    if (pendingEl) ssiStats[SSI_AXIS_EL].rejected++;
+
+    validAz = readAz && !pendingAz;
+    validEl = readEl && !pendingEl;
+
+    #if DEBUG_ENCODER_RAW
+        if (pendingAz || pendingEl) {
+            Serial.print(F("[SSI] Trame rejetée"));
+            if (pendingAz) { Serial.print(F(" Az état=")); Serial.print(ssiStats[SSI_AXIS_AZ].lastStatus); }
+            if (pendingEl) { Serial.print(F(" El état=")); Serial.print(ssiStats[SSI_AXIS_EL].lastStatus); }
+            Serial.println();
+        }
+    #endif
+}
 
 // ════════════════════════════════════════════════════════════════
 // INITIALISATION
@@ -92,8 +315,7 @@ void setupEncoders() {
     // ─────────────────────────────────────────────────────────────
     // CONFIGURATION PINS SSI (si encodeurs SSI utilisés)
     // ─────────────────────────────────────────────────────────────
-    #if (ENCODER_AZ_TYPE == ENCODER_SSI_ABSOLUTE) || (ENCODER_AZ_TYPE == ENCODER_SSI_INC) || \
-        (ENCODER_EL_TYPE == ENCODER_SSI_ABSOLUTE) || (ENCODER_EL_TYPE == ENCODER_SSI_INC)
+    #if SSI_AZ_USED || SSI_EL_USED
         pinMode(SSI_CLK, OUTPUT);
         pinMode(SSI_CS_AZ, OUTPUT);
         pinMode(SSI_DATA_AZ, INPUT);
@@ -104,6 +326,8 @@ void setupEncoders() {
         digitalWrite(SSI_CLK, HIGH);
         digitalWrite(SSI_CS_AZ, HIGH);
         digitalWrite(SSI_CS_EL, HIGH);
+
+        setupSSIPorts();
     #endif
 
     // ─────────────────────────────────────────────────────────────
@@ -117,6 +341,13 @@ void setupEncoders() {
         pinMode(POT_PIN_EL, INPUT);
     #endif
 
+    // Conversion ADC continue sous interruption (plus d'analogRead bloquant)
+    // (pots, tension d'alimentation et courants moteurs DC, voir
+    // power_monitor.h et motor_dc.h)
+    #if ADC_POT_AZ || ADC_POT_EL || ADC_SUPPLY || ADC_CURRENT_AZ || ADC_CURRENT_EL
+        setupAdcSampler();
+    #endif
+
     // ─────────────────────────────────────────────────────────────
     // CHARGEMENT CALIBRATION EEPROM
     // ─────────────────────────────────────────────────────────────
@@ -139,12 +370,8 @@ void setupEncoders() {
     // Initialisation potentiomètre multi-tours AZIMUTH
     #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
         // Lire ADC initial et pré-remplir buffer filtrage
-        int initialAdcAz = analogRead(POT_PIN_AZ);
-
-        for (int i = 0; i < POT_SAMPLES_AZ; i++) {
-            potAdcBufferAz[i] = initialAdcAz;
-        }
-        potBufferFullAz = true;
+        int initialAdcAz = adcSamplerRead(ADC_CH_AZ);
+        potFilterAz.fill(initialAdcAz);
 
         // Note: previousRawAdcAz (static dans updateEncoders) sera initialisé
         // automatiquement à la première lecture
@@ -153,12 +380,8 @@ void setupEncoders() {
     // Initialisation potentiomètre multi-tours ÉLÉVATION
     #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
         // Lire ADC initial et pré-remplir buffer filtrage
-        int initialAdcEl = analogRead(POT_PIN_EL);
-
-        for (int i = 0; i < POT_SAMPLES_EL; i++) {
-            potAdcBufferEl[i] = initialAdcEl;
-        }
-        potBufferFullEl = true;
+        int initialAdcEl = adcSamplerRead(ADC_CH_EL);
+        potFilterEl.fill(initialAdcEl);
 
         // Note: previousRawAdcEl (static dans updateEncoders) sera initialisé
         // automatiquement à la première lecture
@@ -208,73 +431,88 @@ void setupEncoders() {
 // ════════════════════════════════════════════════════════════════
 
 void updateEncoders() {
+    // Écriture journal EEPROM en cours: un octet par passage
+    journalService();
+
     // Throttling lecture (intervalle défini dans config.h)
     unsigned long currentTime = millis();
     if (currentTime - lastEncoderReadTime < ENCODER_READ_INTERVAL) {
         return;  // Pas encore temps de lire
     }
+    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT) || (ENCODER_EL_TYPE == ENCODER_POT_MT)
+        unsigned long readDtMs = currentTime - lastEncoderReadTime;  // Prédiction estimateur
+    #endif
     lastEncoderReadTime = currentTime;
 
+    #if SSI_AZ_USED || SSI_EL_USED
+        // Une seule rafale CLK pour les deux encodeurs (même instant)
+        // Trame rejetée → position de l'axe inchangée ce cycle
+        unsigned long ssiFrameAz = 0, ssiFrameEl = 0;
+        bool ssiValidAz, ssiValidEl;
+        readCheckedSSIFrames(SSI_AZ_USED, SSI_EL_USED, ssiFrameAz, ssiFrameEl,
+                             ssiValidAz, ssiValidEl);
+    #endif
+
     // ═════════════════════════════════════════════════════════════
     // LECTURE AZIMUTH
     // ═════════════════════════════════════════════════════════════
 
-    #if (ENCODER_AZ_TYPE == ENCODER_SSI_ABSOLUTE) || (ENCODER_AZ_TYPE == ENCODER_SSI_INC)
+    #if SSI_AZ_USED
         // ─────────────────────────────────────────────────────────
         // ENCODEUR SSI (HH-12)
         // ─────────────────────────────────────────────────────────
-        rawCountsAz = readSSI_Absolute(SSI_CS_AZ, SSI_DATA_AZ, REVERSE_AZ);
-
-        // Détection transition tour (wraparound 0↔4095)
-        int deltaAz = rawCountsAz - previousRawAz;
-        if (deltaAz > 2048) {
-            turnsAz--;  // Passage 4095→0 sens négatif
-        } else if (deltaAz < -2048) {
-            turnsAz++;  // Passage 0→4095 sens positif
+        if (ssiValidAz) {
+            rawCountsAz = ssiFrameCounts(ssiFrameAz, REVERSE_AZ);
+
+            // Première trame valide: pas de transition (previousRawAz arbitraire)
+            if (!ssiSeededAz) {
+                previousRawAz = rawCountsAz;
+                ssiSeededAz = true;
+            }
+
+            // Détection transition tour (wraparound 0↔4095)
+            int deltaAz = rawCountsAz - previousRawAz;
+            if (deltaAz > 2048) {
+                turnsAz--;  // Passage 4095→0 sens négatif
+            } else if (deltaAz < -2048) {
+                turnsAz++;  // Passage 0→4095 sens positif
+            }
+            previousRawAz = rawCountsAz;
+
+            // Calcul position absolue en millidegrés
+            long currentStepsAz = (turnsAz * 4096L) + rawCountsAz - offsetStepsAz;
+            angle_t az = angleScale(currentStepsAz, SSI_AZ_SCALE);
+
+            // NORMALISATION 0-360° (IMPORTANT!)
+            while (az < 0) az += ANGLE_DEG(360);
+            while (az >= ANGLE_DEG(360)) az -= ANGLE_DEG(360);
+            setPositionAz(az);
         }
-        previousRawAz = rawCountsAz;
-
-        // Calcul position absolue en degrés
-        long currentStepsAz = (turnsAz * 4096L) + rawCountsAz - offsetStepsAz;
-        currentAz = (float)currentStepsAz * 360.0 / (4096.0 * GEAR_RATIO_AZ);
-
-        // NORMALISATION 0-360° (IMPORTANT!)
-        while (currentAz < 0) currentAz += 360.0;
-        while (currentAz >= 360) currentAz -= 360.0;
 
     #elif (ENCODER_AZ_TYPE == ENCODER_POT_1T)
         // ─────────────────────────────────────────────────────────
         // POTENTIOMÈTRE 1 TOUR (Filtrage moyenne glissante)
         // ─────────────────────────────────────────────────────────
 
-        // Lecture ADC brute (0-1023)
-        int rawAdc = analogRead(POT_PIN_AZ);
+        // Lecture ADC suréchantillonnée (0-POT_FINE_MAX)
+        int rawAdc = adcSamplerRead(ADC_CH_AZ);
         #if REVERSE_AZ
-            rawAdc = 1023 - rawAdc;  // Inversion sens
+            rawAdc = POT_FINE_MAX - rawAdc;  // Inversion sens
         #endif
 
-        // Ajout au buffer circulaire
-        potAdcBufferAz[potBufferIndexAz] = rawAdc;
-        potBufferIndexAz = (potBufferIndexAz + 1) % POT_SAMPLES_AZ;
-        if (potBufferIndexAz == 0) potBufferFullAz = true;
+        // Moyenne glissante (somme courante, O(1))
+        int adcValue = potFilterAz.add(rawAdc);
 
-        // Calcul moyenne glissante
-        long adcSum = 0;
-        int sampleCount = potBufferFullAz ? POT_SAMPLES_AZ : potBufferIndexAz;
-        for (int i = 0; i < sampleCount; i++) {
-            adcSum += potAdcBufferAz[i];
-        }
-        int adcValue = (int)(adcSum / sampleCount);
-
-        rawCountsAz = adcValue;  // Pour compatibilité debug
+        rawCountsAz = adcValue >> POT_FINE_BITS;  // Pour compatibilité debug (0-1023)
 
         // Mapping direct: ADC 0-1023 → 0-360°
-        // Formule: degrees = (adcValue / 1024.0) * 360.0
-        currentAz = ((float)adcValue / (float)POT_ADC_RESOLUTION) * 360.0;
+        // Formule: angle = adcValue × 360° / 1024 (unités fines)
+        angle_t az = angleScale(adcValue, POT_1T_AZ_SCALE);
 
         // Contrainte 0-360° (sécurité)
-        if (currentAz < 0.0) currentAz = 0.0;
-        if (currentAz > 360.0) currentAz = 360.0;
+        if (az < 0) az = 0;
+        if (az > ANGLE_DEG(360)) az = ANGLE_DEG(360);
+        setPositionAz(az);
 
     #elif (ENCODER_AZ_TYPE == ENCODER_POT_MT)
         // ═══════════════════════════════════════════════════════════
@@ -294,9 +532,10 @@ void updateEncoders() {
         // ─────────────────────────────────────────────────────────
         // ÉTAPE 1: LECTURE ADC
         // ─────────────────────────────────────────────────────────
-        int rawAdc = analogRead(POT_PIN_AZ);
+        // Valeur suréchantillonnée en unités fines (1/2^POT_FINE_BITS LSB)
+        int rawAdc = adcSamplerRead(ADC_CH_AZ);
         #if REVERSE_AZ
-            rawAdc = 1023 - rawAdc;
+            rawAdc = POT_FINE_MAX - rawAdc;
         #endif
 
         // ─────────────────────────────────────────────────────────
@@ -315,58 +554,61 @@ void updateEncoders() {
         int delta = rawAdc - previousRawAz;
 
         // Correction wraparound: si delta trop grand, c'est un passage 0↔1023
-        if (delta > 512) {
-            delta -= 1024;  // Passage 1023→0 en sens inverse (CCW)
-        } else if (delta < -512) {
-            delta += 1024;  // Passage 0→1023 en sens inverse (CW)
+        if (delta > (512 << POT_FINE_BITS)) {
+            delta -= (1024 << POT_FINE_BITS);  // Passage 1023→0 en sens inverse (CCW)
+        } else if (delta < -(512 << POT_FINE_BITS)) {
+            delta += (1024 << POT_FINE_BITS);  // Passage 0→1023 en sens inverse (CW)
+        }
+
+        // accumulatedAdcAz (EEPROM, table) reste en LSB 10 bits: si modifié
+        // ailleurs (calibration, chargement EEPROM), resynchronisation
+        if ((accumulatedFineAz >> POT_FINE_BITS) != accumulatedAdcAz) {
+            accumulatedFineAz = accumulatedAdcAz * (1L << POT_FINE_BITS);
         }
 
         // Accumuler (turnsAz stocke maintenant l'ADC accumulé, pas les tours)
         // On réutilise offsetStepsAz pour stocker la position de référence
-        accumulatedAdcAz += delta;
+        accumulatedFineAz += delta;
+        accumulatedAdcAz = accumulatedFineAz >> POT_FINE_BITS;
 
         previousRawAz = rawAdc;
 
-        // Sauvegarder périodiquement (pas à chaque cycle pour éviter usure EEPROM)
-        static unsigned long lastEepromSaveAz = 0;
-        if (millis() - lastEepromSaveAz > 5000) {  // Toutes les 5 secondes
-            EEPROM.put(EEPROM_TURNS_AZ, accumulatedAdcAz);
-            lastEepromSaveAz = millis();
-        }
-
         // ─────────────────────────────────────────────────────────
         // ÉTAPE 3: CALCUL POSITION EN DEGRÉS (Table d'interpolation)
         // ─────────────────────────────────────────────────────────
         // Utilise la table de correction avec interpolation linéaire
         // au lieu du simple GEAR_RATIO (compense non-linéarité pot)
 
-        float rawAzDeg = adcToDegrees(accumulatedAdcAz);
+        angle_t rawAz = adcToAngle(accumulatedFineAz);
 
         // ─────────────────────────────────────────────────────────
-        // ÉTAPE 4: FILTRAGE EMA (Exponential Moving Average)
+        // ÉTAPE 4: ESTIMATION POSITION / VITESSE (alpha-beta)
         // ─────────────────────────────────────────────────────────
-        // Lisse les fluctuations ADC à l'arrêt
-        // Alpha = 0.25 → 25% nouvelle valeur, 75% ancienne (bon compromis)
-        // Variables filteredAz et azFilterInitialized sont module-level
-        // pour permettre reset lors de la calibration
-
-        if (!azFilterInitialized) {
-            filteredAz = rawAzDeg;
-            azFilterInitialized = true;
-        } else {
-            filteredAz = 0.10 * rawAzDeg + 0.90 * filteredAz;
-        }
-        currentAz = filteredAz;
+        // Lisse les fluctuations ADC à l'arrêt, suit sans retard
+        // quand le moteur est commandé (voir position_estimator.h)
+        // estimatorAz est module-level pour reset lors de la calibration
+
+        angle_t az = estimatorUpdate(estimatorAz, rawAz, readDtMs, AXIS_COMMANDED_AZ);
+        currentAzRateQ16 = estimatorAz.velocity;
+
+        // ─────────────────────────────────────────────────────────
+        // ÉTAPE 5: FUSION PAS COMMANDÉS (step_fusion.h)
+        // ─────────────────────────────────────────────────────────
+        // Pas moteur à court terme (sans retard ni bruit), recalage
+        // lent sur l'estimateur en régime établi
+
+        az = fusionUpdate(fusionAz, FUSION_AZ, az, readDtMs);
 
         // Normalisation 0-360° pour Easycom/PstRotator
-        while (currentAz >= 360.0) currentAz -= 360.0;
-        while (currentAz < 0.0) currentAz += 360.0;
+        while (az >= ANGLE_DEG(360)) az -= ANGLE_DEG(360);
+        while (az < 0) az += ANGLE_DEG(360);
 
         // Snap à 0° si très proche de 360° (évite 359.9° après calibration à 0°)
         // Avec limite mécanique à ~343°, on ne sera jamais légitimement à 359°
-        if (currentAz > 359.5) currentAz = 0.0;
+        if (az > ANGLE_DEG(359.5)) az = 0;
+        setPositionAz(az);
 
-        rawCountsAz = rawAdc;  // Pour debug
+        rawCountsAz = rawAdc >> POT_FINE_BITS;  // Pour debug (0-1023)
 
     #endif
 
@@ -374,15 +616,17 @@ void updateEncoders() {
     // LECTURE ÉLÉVATION
     // ═════════════════════════════════════════════════════════════
 
-    #if (ENCODER_EL_TYPE == ENCODER_SSI_ABSOLUTE) || (ENCODER_EL_TYPE == ENCODER_SSI_INC)
+    #if SSI_EL_USED
         // ─────────────────────────────────────────────────────────
         // ENCODEUR SSI (HH-12)
         // ─────────────────────────────────────────────────────────
-        rawCountsEl = readSSI_Absolute(SSI_CS_EL, SSI_DATA_EL, REVERSE_EL);
+        if (ssiValidEl) {
+            rawCountsEl = ssiFrameCounts(ssiFrameEl, REVERSE_EL);
 
-        // Calcul position: mapping direct 0-4095 → 0-90°
-        long currentStepsEl = (long)rawCountsEl - offsetStepsEl;
-        currentEl = (float)currentStepsEl * 90.0 / 4095.0;
+            // Calcul position: mapping direct 0-4095 → 0-90°
+            long currentStepsEl = (long)rawCountsEl - offsetStepsEl;
+            setPositionEl(angleScale(currentStepsEl, SSI_EL_SCALE));
+        }
 
     #elif (ENCODER_EL_TYPE == ENCODER_POT_1T)
         // ─────────────────────────────────────────────────────────
@@ -391,41 +635,30 @@ void updateEncoders() {
         // Utilisé quand la plage mécanique < 1 tour du pot
         // (ex: élévation -10° à +60° = 70° → pot fait ~0.97 tour)
 
-        // Lecture ADC brute (0-1023)
-        int rawAdcEl = analogRead(POT_PIN_EL);
+        // Lecture ADC suréchantillonnée (0-POT_FINE_MAX)
+        int rawAdcEl = adcSamplerRead(ADC_CH_EL);
         #if REVERSE_EL
-            rawAdcEl = 1023 - rawAdcEl;  // Inversion sens
+            rawAdcEl = POT_FINE_MAX - rawAdcEl;  // Inversion sens
         #endif
 
-        // Ajout au buffer circulaire
-        potAdcBufferEl[potBufferIndexEl] = rawAdcEl;
-        potBufferIndexEl = (potBufferIndexEl + 1) % POT_SAMPLES_EL;
-        if (potBufferIndexEl == 0) potBufferFullEl = true;
-
-        // Calcul moyenne glissante
-        long adcSumEl = 0;
-        int sampleCountEl = potBufferFullEl ? POT_SAMPLES_EL : potBufferIndexEl;
-        for (int i = 0; i < sampleCountEl; i++) {
-            adcSumEl += potAdcBufferEl[i];
-        }
-        int adcValueEl = (int)(adcSumEl / sampleCountEl);
+        // Moyenne glissante (somme courante, O(1))
+        int adcValueEl = potFilterEl.add(rawAdcEl);
 
-        rawCountsEl = adcValueEl;  // Pour compatibilité debug
+        rawCountsEl = adcValueEl >> POT_FINE_BITS;  // Pour compatibilité debug (0-1023)
 
         // ─────────────────────────────────────────────────────────
         // CALCUL POSITION AVEC GEAR_RATIO ET OFFSET
         // ─────────────────────────────────────────────────────────
-        // potDegrees = position du pot (0-360°)
-        // offsetDegreesPot = offset en degrés pot (depuis calibration)
-        // currentEl = (potDegrees - offset) / GEAR_RATIO
+        // offsetStepsEl = offset pot en LSB 10 bits (depuis calibration)
+        // angle = (adc - offset) × 360° / 1024 / GEAR_RATIO (unités fines)
 
-        float potDegreesEl = ((float)adcValueEl / (float)POT_ADC_RESOLUTION) * 360.0;
-        float offsetDegreesPotEl = ((float)offsetStepsEl / (float)POT_ADC_RESOLUTION) * 360.0;
-        currentEl = (potDegreesEl - offsetDegreesPotEl) / GEAR_RATIO_EL;
+        long potFineEl = (long)adcValueEl - offsetStepsEl * (1L << POT_FINE_BITS);
+        angle_t el = angleScale(potFineEl, POT_1T_EL_SCALE);
 
         // Contrainte -15° à +95° (marge de sécurité)
-        if (currentEl < -15.0) currentEl = -15.0;
-        if (currentEl > 95.0) currentEl = 95.0;
+        if (el < ANGLE_DEG(-15)) el = ANGLE_DEG(-15);
+        if (el > ANGLE_DEG(95)) el = ANGLE_DEG(95);
+        setPositionEl(el);
 
     #elif (ENCODER_EL_TYPE == ENCODER_POT_MT)
         // ═══════════════════════════════════════════════════════════
@@ -437,9 +670,10 @@ void updateEncoders() {
         // ─────────────────────────────────────────────────────────
         // ÉTAPE 1: LECTURE ADC
         // ─────────────────────────────────────────────────────────
-        int rawAdcEl = analogRead(POT_PIN_EL);
+        // Valeur suréchantillonnée en unités fines (1/2^POT_FINE_BITS LSB)
+        int rawAdcEl = adcSamplerRead(ADC_CH_EL);
         #if REVERSE_EL
-            rawAdcEl = 1023 - rawAdcEl;
+            rawAdcEl = POT_FINE_MAX - rawAdcEl;
         #endif
 
         // ─────────────────────────────────────────────────────────
@@ -456,47 +690,61 @@ void updateEncoders() {
         int deltaEl = rawAdcEl - previousRawEl;
 
         // Correction wraparound
-        if (deltaEl > 512) {
-            deltaEl -= 1024;
-        } else if (deltaEl < -512) {
-            deltaEl += 1024;
+        if (deltaEl > (512 << POT_FINE_BITS)) {
+            deltaEl -= (1024 << POT_FINE_BITS);
+        } else if (deltaEl < -(512 << POT_FINE_BITS)) {
+            deltaEl += (1024 << POT_FINE_BITS);
+        }
+
+        // Resynchronisation si accumulatedAdcEl modifié ailleurs (voir azimuth)
+        if ((accumulatedFineEl >> POT_FINE_BITS) != accumulatedAdcEl) {
+            accumulatedFineEl = accumulatedAdcEl * (1L << POT_FINE_BITS);
         }
 
         // Accumuler
-        accumulatedAdcEl += deltaEl;
+        accumulatedFineEl += deltaEl;
+        accumulatedAdcEl = accumulatedFineEl >> POT_FINE_BITS;
         previousRawEl = rawAdcEl;
 
-        // Sauvegarder périodiquement
-        static unsigned long lastEepromSaveEl = 0;
-        if (millis() - lastEepromSaveEl > 5000) {
-            EEPROM.put(EEPROM_TURNS_EL, accumulatedAdcEl);
-            lastEepromSaveEl = millis();
-        }
-
         // ─────────────────────────────────────────────────────────
         // ÉTAPE 3: CALCUL POSITION EN DEGRÉS (Table d'interpolation)
         // ─────────────────────────────────────────────────────────
-        float rawElDeg = adcToDegreesEl(accumulatedAdcEl);
+        angle_t rawEl = adcToAngleEl(accumulatedFineEl);
 
         // ─────────────────────────────────────────────────────────
-        // ÉTAPE 4: FILTRAGE EMA
+        // ÉTAPE 4: ESTIMATION POSITION / VITESSE (alpha-beta)
         // ─────────────────────────────────────────────────────────
-        if (!elFilterInitialized) {
-            filteredEl = rawElDeg;
-            elFilterInitialized = true;
-        } else {
-            filteredEl = 0.10 * rawElDeg + 0.90 * filteredEl;
-        }
-        currentEl = filteredEl;
+        angle_t el = estimatorUpdate(estimatorEl, rawEl, readDtMs, AXIS_COMMANDED_EL);
+        currentElRateQ16 = estimatorEl.velocity;
+
+        // ─────────────────────────────────────────────────────────
+        // ÉTAPE 5: FUSION PAS COMMANDÉS (step_fusion.h)
+        // ─────────────────────────────────────────────────────────
+        el = fusionUpdate(fusionEl, FUSION_EL, el, readDtMs);
 
         // Contrainte selon plage de la table (-40° à +80°)
-        if (currentEl < (float)EL_TABLE_START) currentEl = (float)EL_TABLE_START;
-        if (currentEl > (float)(EL_TABLE_START + (EL_TABLE_POINTS - 1) * EL_TABLE_STEP)) currentEl = (float)(EL_TABLE_START + (EL_TABLE_POINTS - 1) * EL_TABLE_STEP);
+        if (el < EL_TABLE_START * ANGLE_PER_DEG) el = EL_TABLE_START * ANGLE_PER_DEG;
+        if (el > (EL_TABLE_START + (EL_TABLE_POINTS - 1) * EL_TABLE_STEP) * ANGLE_PER_DEG) {
+            el = (EL_TABLE_START + (EL_TABLE_POINTS - 1) * EL_TABLE_STEP) * ANGLE_PER_DEG;
+        }
+        setPositionEl(el);
 
-        rawCountsEl = rawAdcEl;  // Pour debug
+        rawCountsEl = rawAdcEl >> POT_FINE_BITS;  // Pour debug (0-1023)
 
     #endif
 
+    // ─────────────────────────────────────────────────────────────
+    // JOURNAL EEPROM (tours / ADC cumulé)
+    // ─────────────────────────────────────────────────────────────
+    // Au plus un enregistrement par période, aucun si inchangé
+
+    static unsigned long lastJournalTime = 0;
+    if (currentTime - lastJournalTime >= EEPROM_JOURNAL_PERIOD_MS) {
+        journalWriteIfMoved(JOURNAL_VALUE_AZ, JOURNAL_VALUE_EL,
+                            JOURNAL_DEADBAND_AZ, JOURNAL_DEADBAND_EL);
+        lastJournalTime = currentTime;
+    }
+
     // ─────────────────────────────────────────────────────────────
     // DEBUG (optionnel)
     // ─────────────────────────────────────────────────────────────
@@ -510,44 +758,132 @@ void updateEncoders() {
 }
 
 // ════════════════════════════════════════════════════════════════
-// LECTURE SSI ABSOLU
+// POSITION EXTRAPOLÉE (asservissement)
 // ════════════════════════════════════════════════════════════════
 
-int readSSI_Absolute(int csPin, int dataPin, bool reverse) {
-    // Protocole SSI 12-bit (HH-12 SSI):
-    // - 18 pulses CLK total (12 bits data + 6 bits status/parity)
-    // - Data valide pendant CLK LOW
-    // - MSB first (bit 11 → bit 0)
+static angle_t extrapolate(angle_t position, long rateQ16, unsigned long now) {
+    // Âge borné: lecture sautée (loop bloquée) → pas d'extrapolation folle
+    unsigned long age = min(now - lastEncoderReadTime, (unsigned long)ENCODER_READ_INTERVAL);
+    return position + (angle_t)((rateQ16 * (long)age) >> 16);
+}
 
-    unsigned long data = 0;
+angle_t currentAzAt(unsigned long now) {
+    return extrapolate(currentAzMdeg, currentAzRateQ16, now);
+}
 
-    // Activer transmission (CS LOW)
-    digitalWrite(csPin, LOW);
-    delayMicroseconds(5);
+angle_t currentElAt(unsigned long now) {
+    return extrapolate(currentElMdeg, currentElRateQ16, now);
+}
 
-    // 18 pulses CLK (12 data + 6 status)
-    for (int i = 0; i < 18; i++) {
-        digitalWrite(SSI_CLK, LOW);
-        delayMicroseconds(5);
-        digitalWrite(SSI_CLK, HIGH);
-        delayMicroseconds(5);
+// ════════════════════════════════════════════════════════════════
+// LECTURE SSI ABSOLU
+// ════════════════════════════════════════════════════════════════
 
-        // Lire uniquement 12 premiers bits (data utile)
-        if (i < 12 && digitalRead(dataPin)) {
-            data |= (1L << (11 - i));  // MSB first
-        }
+void readSSIFrames(bool readAz, bool readEl, unsigned long &frameAz, unsigned long &frameEl) {
+    // Protocole SSI HH-12 (AS5045):
+    // - CS LOW puis SSI_FRAME_BITS pulses CLK, MSB first
+    // - Bit lu après chaque front montant
+    // - CLK commune: les deux encodeurs sortent leur bit au même front
+
+    unsigned long az = 0;
+    unsigned long el = 0;
+
+    noInterrupts();     // Trame continue (pas de front CLK étiré)
+
+    // Activer transmission (CS LOW)
+    if (readAz) SSI_CS_AZ_LOW();
+    if (readEl) SSI_CS_EL_LOW();
+    delayMicroseconds(SSI_HALF_PERIOD_US);
+
+    for (uint8_t i = 0; i < SSI_FRAME_BITS; i++) {
+        SSI_CLK_LOW();
+        delayMicroseconds(SSI_HALF_PERIOD_US);
+        SSI_CLK_HIGH();
+        delayMicroseconds(SSI_HALF_PERIOD_US);
+
+        az <<= 1;
+        el <<= 1;
+        if (SSI_DATA_AZ_BIT()) az |= 1;
+        if (SSI_DATA_EL_BIT()) el |= 1;
     }
 
     // Fin transmission (CS HIGH)
-    digitalWrite(csPin, HIGH);
+    SSI_CS_AZ_HIGH();
+    SSI_CS_EL_HIGH();
+
+    interrupts();
+
+    frameAz = readAz ? az : 0;
+    frameEl = readEl ? el : 0;
+}
 
-    // Conversion unsigned long → int (12-bit: 0-4095)
-    int val = (int)data;
+int ssiFrameCounts(unsigned long frame, bool reverse) {
+    // 12 premiers bits = position, 6 suivants = état/parité
+    int val = (int)((frame >> (SSI_FRAME_BITS - 12)) & 0x0FFF);
 
     // Inversion sens si demandé (REVERSE_AZ/EL)
     return reverse ? (4095 - val) : val;
 }
 
+uint8_t ssiFrameStatus(unsigned long frame) {
+    // OCF testé en premier: ligne DATA bloquée à 0 = parité correcte
+    if (!(frame & 0x20)) return SSI_FRAME_OCF;
+
+    // Parité paire: nombre de bits à 1 pair sur les 18 bits
+    uint8_t ones = 0;
+    for (unsigned long f = frame & 0x3FFFFUL; f; f &= f - 1) ones++;
+    if (ones & 1) return SSI_FRAME_PARITY;
+
+    if (frame & 0x10) return SSI_FRAME_COF;
+    if (frame & 0x08) return SSI_FRAME_LIN;
+    if ((frame & 0x06) == 0x06) return SSI_FRAME_MAGNET;
+    return SSI_FRAME_OK;
+}
+
+int readSSI_Absolute(int csPin, int dataPin, bool reverse) {
+    (void)dataPin;  // Ligne DATA déduite de l'axe (CS)
+
+    bool isAz = (csPin == SSI_CS_AZ);
+    unsigned long frameAz = 0, frameEl = 0;
+    bool validAz, validEl;
+    readCheckedSSIFrames(isAz, !isAz, frameAz, frameEl, validAz, validEl);
+
+    // Trame rejetée: dernière valeur valide (pas de faux saut)
+    if (!(isAz ? validAz : validEl)) {
+        return isAz ? previousRawAz : previousRawEl;
+    }
+    return ssiFrameCounts(isAz ? frameAz : frameEl, reverse);
+}
+
+void printSSIReport() {
+    sendToClient("\r\n");
+    sendToClient("=== ENCODEURS SSI ===\r\n");
+
+    for (uint8_t i = 0; i < 2; i++) {
+        const SSIAxisStats &a = ssiStats[i];
+        unsigned long total = 0;
+        for (uint8_t c = 0; c < SSI_FRAME_CODES; c++) total += a.frames[c];
+
+        String line = (i == SSI_AXIS_AZ) ? "AZ " : "EL ";
+        line += "trames=" + String(total);
+        line += " ok=" + String(a.frames[SSI_FRAME_OK]);
+        line += " ocf=" + String(a.frames[SSI_FRAME_OCF]);
+        line += " par=" + String(a.frames[SSI_FRAME_PARITY]);
+        line += " cof=" + String(a.frames[SSI_FRAME_COF]);
+        line += " lin=" + String(a.frames[SSI_FRAME_LIN]);
+        line += " mag=" + String(a.frames[SSI_FRAME_MAGNET]);
+        line += " relect=" + String(a.retries);
+        line += " rejet=" + String(a.rejected);
+        line += " dernier=" + String(a.lastStatus);
+        line += "\r\n";
+        sendToClient(line);
+    }
+}
+
+void ssiClearStats() {
+    memset(ssiStats, 0, sizeof(ssiStats));
+}
+
 // ════════════════════════════════════════════════════════════════
 // LECTURE SSI INCRÉMENTAL
 // ════════════════════════════════════════════════════════════════
@@ -572,12 +908,9 @@ int readSSI_Incremental(int csPin, int dataPin, bool reverse, long &turns) {
         previousRawEl = currentRaw;
     }
 
-    // 4. Sauvegarde EEPROM si changement tour (éviter usure excessive)
+    // 4. Journal EEPROM si changement tour
     if (turnChange != 0) {
-        if (csPin == SSI_CS_AZ) {
-            EEPROM.put(EEPROM_TURNS_AZ, turns);
-        }
-        // Note: turnsEl pas sauvegardé car élévation généralement < 1 tour
+        journalPosition();
     }
 
     return currentRaw;
@@ -638,12 +971,8 @@ int detectTurnTransition(int currentRaw, int previousRaw) {
 void resetPotBufferAz(int adcValue) {
     #if (ENCODER_AZ_TYPE == ENCODER_POT_1T) || (ENCODER_AZ_TYPE == ENCODER_POT_MT)
         // Remplir le buffer avec la valeur actuelle pour cohérence
-        for (int i = 0; i < POT_SAMPLES_AZ; i++) {
-            potAdcBufferAz[i] = adcValue;
-        }
-        potBufferIndexAz = 0;
-        potBufferFullAz = true;
-        rawCountsAz = adcValue;
+        potFilterAz.fill(adcValue);
+        rawCountsAz = adcValue >> POT_FINE_BITS;
 
         // Reset valeur précédente pour éviter faux wraparound
         previousRawAz = adcValue;
@@ -658,12 +987,8 @@ void resetPotBufferAz(int adcValue) {
 void resetPotBufferEl(int adcValue) {
     #if (ENCODER_EL_TYPE == ENCODER_POT_1T) || (ENCODER_EL_TYPE == ENCODER_POT_MT)
         // Remplir le buffer avec la valeur actuelle pour cohérence
-        for (int i = 0; i < POT_SAMPLES_EL; i++) {
-            potAdcBufferEl[i] = adcValue;
-        }
-        potBufferIndexEl = 0;
-        potBufferFullEl = true;
-        rawCountsEl = adcValue;
+        potFilterEl.fill(adcValue);
+        rawCountsEl = adcValue >> POT_FINE_BITS;
 
         #if DEBUG_SERIAL
             Serial.print(F("✓ Buffer El réinitialisé avec ADC="));
@@ -692,14 +1017,14 @@ void calibrateAz(float realDegrees) {
         // C10, C20, C30, etc.
 
         // Lire ADC actuel
-        int currentAdc = analogRead(POT_PIN_AZ);
+        int currentAdc = adcSamplerRead(ADC_CH_AZ);
         #if REVERSE_AZ
-            currentAdc = 1023 - currentAdc;
+            currentAdc = POT_FINE_MAX - currentAdc;
         #endif
 
         // Reset accumulation à 0 (point de référence)
         accumulatedAdcAz = 0;
-        EEPROM.put(EEPROM_TURNS_AZ, accumulatedAdcAz);
+        journalPosition();
 
         // Reset previousRawAz pour éviter faux delta au prochain cycle
         previousRawAz = currentAdc;
@@ -707,9 +1032,8 @@ void calibrateAz(float realDegrees) {
         // Reset buffer filtrage
         resetPotBufferAz(currentAdc);
 
-        // Reset filtre EMA
-        filteredAz = realDegrees;
-        azFilterInitialized = true;
+        // Reset estimateur
+        resetEstimatorAz(angleFromDegrees(realDegrees));
 
         // ─────────────────────────────────────────────────────────
         // RECALCUL COMPLET TABLE DE CORRECTION
@@ -727,18 +1051,19 @@ void calibrateAz(float realDegrees) {
 
         // Sauvegarder dans EEPROM
         for (int i = 0; i < AZ_TABLE_POINTS; i++) {
-            EEPROM.put(EEPROM_AZ_TABLE + (i * sizeof(long)), azCorrectionTable[i]);
+            EEPROM.put(EEPROM_AZ_TABLE + (i * sizeof(int32_t)), azCorrectionTable[i]);
         }
+        tableLookupRebuild(azLookup);
 
         // Mise à jour position courante immédiatement
-        currentAz = realDegrees;
+        setPositionAz(angleFromDegrees(realDegrees));
 
         #if DEBUG_SERIAL
             Serial.println(F("═══════════════════════════════════════"));
             Serial.print(F("✓ CALIBRATION Az: "));
             Serial.print(realDegrees, 1);
             Serial.println(F("°"));
-            Serial.print(F("  ADC actuel: ")); Serial.println(currentAdc);
+            Serial.print(F("  ADC actuel: ")); Serial.println(currentAdc >> POT_FINE_BITS);
             Serial.println(F("  Table recalculée avec cette ref:"));
             Serial.print(F("    0° = ADC ")); Serial.println(azCorrectionTable[0]);
             Serial.print(F("    ")); Serial.print((int)realDegrees); Serial.print(F("° = ADC "));
@@ -765,7 +1090,7 @@ void calibrateAz(float realDegrees) {
         EEPROM.put(EEPROM_OFFSET_AZ, offsetStepsAz);
 
         // Mise à jour position courante immédiatement
-        currentAz = realDegrees;
+        setPositionAz(angleFromDegrees(realDegrees));
 
         #if DEBUG_SERIAL
             Serial.print(F("✓ Calibration Az SSI: "));
@@ -795,13 +1120,13 @@ void calibrateEl(float realDegrees) {
         // 3. Calculer et stocker l'offset
 
         // Lire ADC directement pour avoir la valeur actuelle exacte
-        int currentAdc = analogRead(POT_PIN_EL);
+        int currentAdc = adcSamplerRead(ADC_CH_EL);
         #if REVERSE_EL
-            currentAdc = 1023 - currentAdc;
+            currentAdc = POT_FINE_MAX - currentAdc;
         #endif
 
         // Position actuelle du pot (degrés)
-        float potDegrees = ((float)currentAdc / (float)POT_ADC_RESOLUTION) * 360.0;
+        float potDegrees = ((float)currentAdc / (float)((long)POT_ADC_RESOLUTION << POT_FINE_BITS)) * 360.0;
 
         // Réinitialiser le buffer avec la valeur ADC actuelle
         resetPotBufferEl(currentAdc);
@@ -814,13 +1139,13 @@ void calibrateEl(float realDegrees) {
         EEPROM.put(EEPROM_OFFSET_EL, offsetStepsEl);
 
         // Mise à jour position courante immédiatement
-        currentEl = realDegrees;
+        setPositionEl(angleFromDegrees(realDegrees));
 
         #if DEBUG_SERIAL
             Serial.print(F("✓ Calibration El POT_1T: "));
             Serial.print(realDegrees, 1);
             Serial.print(F("° (ADC="));
-            Serial.print(currentAdc);
+            Serial.print(currentAdc >> POT_FINE_BITS);
             Serial.print(F(", potDeg="));
             Serial.print(potDegrees, 1);
             Serial.print(F(", offset="));
@@ -837,21 +1162,20 @@ void calibrateEl(float realDegrees) {
         // - Enregistre le point dans la table
 
         // Lire ADC actuel
-        int currentAdc = analogRead(POT_PIN_EL);
+        int currentAdc = adcSamplerRead(ADC_CH_EL);
         #if REVERSE_EL
-            currentAdc = 1023 - currentAdc;
+            currentAdc = POT_FINE_MAX - currentAdc;
         #endif
 
         // Reset accumulation à 0
         accumulatedAdcEl = 0;
-        EEPROM.put(EEPROM_TURNS_EL, accumulatedAdcEl);
+        journalPosition();
 
         // Reset buffer filtrage
         resetPotBufferEl(currentAdc);
 
-        // Reset filtre EMA
-        filteredEl = realDegrees;
-        elFilterInitialized = true;
+        // Reset estimateur
+        resetEstimatorEl(angleFromDegrees(realDegrees));
 
         // ─────────────────────────────────────────────────────────
         // RECALCUL COMPLET TABLE DE CORRECTION
@@ -867,18 +1191,19 @@ void calibrateEl(float realDegrees) {
 
         // Sauvegarder dans EEPROM
         for (int i = 0; i < EL_TABLE_POINTS; i++) {
-            EEPROM.put(EEPROM_EL_TABLE + (i * sizeof(long)), elCorrectionTable[i]);
+            EEPROM.put(EEPROM_EL_TABLE + (i * sizeof(int32_t)), elCorrectionTable[i]);
         }
+        tableLookupRebuild(elLookup);
 
         // Mise à jour position courante immédiatement
-        currentEl = realDegrees;
+        setPositionEl(angleFromDegrees(realDegrees));
 
         #if DEBUG_SERIAL
             Serial.println(F("═══════════════════════════════════════"));
             Serial.print(F("✓ CALIBRATION El: "));
             Serial.print(realDegrees, 1);
             Serial.println(F("°"));
-            Serial.print(F("  ADC actuel: ")); Serial.println(currentAdc);
+            Serial.print(F("  ADC actuel: ")); Serial.println(currentAdc >> POT_FINE_BITS);
             Serial.println(F("  Table recalculée avec cette ref:"));
             Serial.print(F("    ")); Serial.print(EL_TABLE_START);
             Serial.print(F("° = ADC ")); Serial.println(elCorrectionTable[0]);
@@ -900,7 +1225,7 @@ void calibrateEl(float realDegrees) {
         EEPROM.put(EEPROM_OFFSET_EL, offsetStepsEl);
 
         // Mise à jour position courante immédiatement
-        currentEl = realDegrees;
+        setPositionEl(angleFromDegrees(realDegrees));
 
         #if DEBUG_SERIAL
             Serial.print(F("✓ Calibration El SSI: "));
@@ -921,24 +1246,30 @@ void loadCalibrationFromEEPROM() {
     // Adresses définies dans config.h
 
     // ─────────────────────────────────────────────────────────────
-    // CHARGEMENT AZIMUTH
+    // POSITION ACCUMULÉE (journal, voir position_journal.h)
     // ─────────────────────────────────────────────────────────────
-    #if (ENCODER_AZ_TYPE == ENCODER_POT_MT)
-        // POT_MT: Charger accumulatedAdcAz (méthode cumulative)
-        EEPROM.get(EEPROM_TURNS_AZ, accumulatedAdcAz);
-        if (accumulatedAdcAz == -1 || (unsigned long)accumulatedAdcAz == 4294967295UL) {
-            accumulatedAdcAz = 0;
-            EEPROM.put(EEPROM_TURNS_AZ, accumulatedAdcAz);
+    // POT_MT: accumulatedAdcAz/El (méthode cumulative)
+    // SSI/autres: turnsAz/El (compteurs de tours)
+    long journalAz = 0, journalEl = 0;
+    if (!journalRecover(journalAz, journalEl)) {
+        // Journal vierge: reprise des anciens emplacements fixes
+        EEPROM.get(EEPROM_TURNS_AZ, journalAz);
+        if (journalAz == -1 || (unsigned long)journalAz == 4294967295UL) {
+            journalAz = 0;
         }
-    #else
-        // SSI/autres: Charger turnsAz (compteur de tours)
-        EEPROM.get(EEPROM_TURNS_AZ, turnsAz);
-        if (turnsAz == -1 || (unsigned long)turnsAz == 4294967295UL) {
-            turnsAz = 0;
-            EEPROM.put(EEPROM_TURNS_AZ, turnsAz);
+        EEPROM.get(EEPROM_TURNS_EL, journalEl);
+        if (journalEl == -1 || (unsigned long)journalEl == 4294967295UL) {
+            journalEl = 0;
         }
-    #endif
+        journalWrite(journalAz, journalEl);
+        journalFlush();
+    }
+    JOURNAL_VALUE_AZ = journalAz;
+    JOURNAL_VALUE_EL = journalEl;
 
+    // ─────────────────────────────────────────────────────────────
+    // CHARGEMENT AZIMUTH
+    // ─────────────────────────────────────────────────────────────
     EEPROM.get(EEPROM_OFFSET_AZ, offsetStepsAz);
     if (offsetStepsAz == -1 || (unsigned long)offsetStepsAz == 4294967295UL) {
         offsetStepsAz = 0;
@@ -948,22 +1279,6 @@ void loadCalibrationFromEEPROM() {
     // ─────────────────────────────────────────────────────────────
     // CHARGEMENT ÉLÉVATION
     // ─────────────────────────────────────────────────────────────
-    #if (ENCODER_EL_TYPE == ENCODER_POT_MT)
-        // POT_MT: Charger accumulatedAdcEl (méthode cumulative)
-        EEPROM.get(EEPROM_TURNS_EL, accumulatedAdcEl);
-        if (accumulatedAdcEl == -1 || (unsigned long)accumulatedAdcEl == 4294967295UL) {
-            accumulatedAdcEl = 0;
-            EEPROM.put(EEPROM_TURNS_EL, accumulatedAdcEl);
-        }
-    #else
-        // SSI/autres: Charger turnsEl
-        EEPROM.get(EEPROM_TURNS_EL, turnsEl);
-        if (turnsEl == -1 || (unsigned long)turnsEl == 4294967295UL) {
-            turnsEl = 0;
-            EEPROM.put(EEPROM_TURNS_EL, turnsEl);
-        }
-    #endif
-
     EEPROM.get(EEPROM_OFFSET_EL, offsetStepsEl);
     if (offsetStepsEl == -1 || (unsigned long)offsetStepsEl == 4294967295UL) {
         offsetStepsEl = 0;
@@ -992,11 +1307,11 @@ void loadCalibrationFromEEPROM() {
 // ════════════════════════════════════════════════════════════════
 
 void saveCalibrationToEEPROM() {
-    // TODO: Écriture valeurs EEPROM
-
-    // EEPROM.put(EEPROM_TURNS_AZ, turnsAz);
-    // EEPROM.put(EEPROM_OFFSET_AZ, offsetStepsAz);
-    // EEPROM.put(EEPROM_OFFSET_EL, offsetStepsEl);
+    // Écriture immédiate (sauvegarde d'urgence): seuls les octets
+    // modifiés sont écrits, offsets normalement inchangés
+    journalWriteNow(JOURNAL_VALUE_AZ, JOURNAL_VALUE_EL);
+    EEPROM.put(EEPROM_OFFSET_AZ, offsetStepsAz);
+    EEPROM.put(EEPROM_OFFSET_EL, offsetStepsEl);
 
     #if DEBUG_SERIAL
         Serial.println(F("Calibration sauvegardée dans EEPROM"));
@@ -1041,8 +1356,9 @@ void loadAzCorrectionTable() {
     } else {
         // Charger table depuis EEPROM
         for (int i = 0; i < AZ_TABLE_POINTS; i++) {
-            EEPROM.get(EEPROM_AZ_TABLE + (i * sizeof(long)), azCorrectionTable[i]);
+            EEPROM.get(EEPROM_AZ_TABLE + (i * sizeof(int32_t)), azCorrectionTable[i]);
         }
+        tableLookupRebuild(azLookup);
 
         #if DEBUG_SERIAL
             Serial.println(F("Table correction Az chargée depuis EEPROM"));
@@ -1070,8 +1386,9 @@ void resetAzCorrectionTable() {
 
     // Sauvegarder dans EEPROM
     for (int i = 0; i < AZ_TABLE_POINTS; i++) {
-        EEPROM.put(EEPROM_AZ_TABLE + (i * sizeof(long)), azCorrectionTable[i]);
+        EEPROM.put(EEPROM_AZ_TABLE + (i * sizeof(int32_t)), azCorrectionTable[i]);
     }
+    tableLookupRebuild(azLookup);
 
     #if DEBUG_SERIAL
         Serial.println(F("═══════════════════════════════════════"));
@@ -1084,70 +1401,19 @@ void resetAzCorrectionTable() {
     #endif
 }
 
-float adcToDegrees(long accumulatedAdc) {
-    // Conversion ADC cumulé → degrés avec interpolation linéaire
-    //
-    // 1. Trouver les deux points de la table qui encadrent l'ADC
-    // 2. Interpoler linéairement entre ces deux points
+angle_t adcToAngle(long accumulatedFine) {
+    // Conversion ADC cumulé → angle avec interpolation linéaire
     //
-    // Cas spéciaux:
+    // Segment et pente précalculée: voir table_lookup.h
     // - ADC < point 0: extrapolation avant (négatif)
     // - ADC > point 34: extrapolation après (>340°)
 
-    // Cas trivial: table non chargée → fallback linéaire
+    // Cas trivial: table non chargée → fallback linéaire (GEAR_RATIO_AZ)
     if (!azTableLoaded) {
-        float potDegreesTotal = (float)accumulatedAdc * 360.0 / 1024.0;
-        return potDegreesTotal / GEAR_RATIO_AZ;
-    }
-
-    // Trouver l'intervalle contenant cet ADC
-    int lowerIndex = -1;
-    int upperIndex = -1;
-
-    for (int i = 0; i < AZ_TABLE_POINTS - 1; i++) {
-        if (accumulatedAdc >= azCorrectionTable[i] && accumulatedAdc <= azCorrectionTable[i + 1]) {
-            lowerIndex = i;
-            upperIndex = i + 1;
-            break;
-        }
+        return angleScale(accumulatedFine, POT_MT_AZ_SCALE);
     }
 
-    // Cas: ADC avant le premier point (ex: valeurs négatives)
-    if (lowerIndex == -1 && accumulatedAdc < azCorrectionTable[0]) {
-        // Extrapolation linéaire basée sur les deux premiers points
-        lowerIndex = 0;
-        upperIndex = 1;
-    }
-
-    // Cas: ADC après le dernier point
-    if (lowerIndex == -1 && accumulatedAdc > azCorrectionTable[AZ_TABLE_POINTS - 1]) {
-        // Extrapolation linéaire basée sur les deux derniers points
-        lowerIndex = AZ_TABLE_POINTS - 2;
-        upperIndex = AZ_TABLE_POINTS - 1;
-    }
-
-    // Sécurité: si toujours pas trouvé, utiliser premier intervalle
-    if (lowerIndex == -1) {
-        lowerIndex = 0;
-        upperIndex = 1;
-    }
-
-    // Interpolation linéaire
-    long adcLow = azCorrectionTable[lowerIndex];
-    long adcHigh = azCorrectionTable[upperIndex];
-    float angleLow = (float)(lowerIndex * AZ_TABLE_STEP);   // ex: 170°
-    float angleHigh = (float)(upperIndex * AZ_TABLE_STEP);  // ex: 180°
-
-    // Éviter division par zéro
-    if (adcHigh == adcLow) {
-        return angleLow;
-    }
-
-    // Interpolation: angle = angleLow + (adc - adcLow) * (angleHigh - angleLow) / (adcHigh - adcLow)
-    float ratio = (float)(accumulatedAdc - adcLow) / (float)(adcHigh - adcLow);
-    float interpolatedAngle = angleLow + ratio * (angleHigh - angleLow);
-
-    return interpolatedAngle;
+    return tableLookupMdeg(azLookup, accumulatedFine);
 }
 
 void calibrateAzTablePoint(float realDegrees) {
@@ -1170,11 +1436,12 @@ void calibrateAzTablePoint(float realDegrees) {
     azCorrectionTable[pointIndex] = accumulatedAdcAz;
 
     // Sauvegarder dans EEPROM
-    EEPROM.put(EEPROM_AZ_TABLE + (pointIndex * sizeof(long)), azCorrectionTable[pointIndex]);
+    EEPROM.put(EEPROM_AZ_TABLE + (pointIndex * sizeof(int32_t)), azCorrectionTable[pointIndex]);
+    tableLookupRebuild(azLookup);
 
     // Mettre à jour position courante immédiatement
-    currentAz = (float)calibratedAngle;
-    filteredAz = currentAz;
+    setPositionAz(calibratedAngle * ANGLE_PER_DEG);
+    resetEstimatorAz(currentAzMdeg);
 
     #if DEBUG_SERIAL
         Serial.println(F("═══════════════════════════════════════"));
@@ -1188,6 +1455,20 @@ void calibrateAzTablePoint(float realDegrees) {
     #endif
 }
 
+void setAzCorrectionTable(const long *points) {
+    // Table complète (balayage automatique, table_sweep.h)
+    for (int i = 0; i < AZ_TABLE_POINTS; i++) {
+        azCorrectionTable[i] = points[i];
+        EEPROM.put(EEPROM_AZ_TABLE + (i * sizeof(int32_t)), azCorrectionTable[i]);
+    }
+    tableLookupRebuild(azLookup);
+    azTableLoaded = true;
+
+    // Position relue avec la nouvelle table, sans transitoire estimateur
+    setPositionAz(adcToAngle(accumulatedFineAz));
+    resetEstimatorAz(currentAzMdeg);
+}
+
 void printAzCorrectionTable() {
     // Affichage complet de la table de correction via sendToClient
     sendToClient("\r\n");
@@ -1239,8 +1520,9 @@ void loadElCorrectionTable() {
         resetElCorrectionTable();
     } else {
         for (int i = 0; i < EL_TABLE_POINTS; i++) {
-            EEPROM.get(EEPROM_EL_TABLE + (i * sizeof(long)), elCorrectionTable[i]);
+            EEPROM.get(EEPROM_EL_TABLE + (i * sizeof(int32_t)), elCorrectionTable[i]);
         }
+        tableLookupRebuild(elLookup);
 
         #if DEBUG_SERIAL
             Serial.println(F("Table correction El chargée depuis EEPROM"));
@@ -1266,8 +1548,9 @@ void resetElCorrectionTable() {
 
     // Sauvegarder dans EEPROM
     for (int i = 0; i < EL_TABLE_POINTS; i++) {
-        EEPROM.put(EEPROM_EL_TABLE + (i * sizeof(long)), elCorrectionTable[i]);
+        EEPROM.put(EEPROM_EL_TABLE + (i * sizeof(int32_t)), elCorrectionTable[i]);
     }
+    tableLookupRebuild(elLookup);
 
     #if DEBUG_SERIAL
         Serial.println(F("═══════════════════════════════════════"));
@@ -1283,55 +1566,14 @@ void resetElCorrectionTable() {
     #endif
 }
 
-float adcToDegreesEl(long accumulatedAdc) {
-    // Conversion ADC cumulé → degrés élévation avec interpolation linéaire
+angle_t adcToAngleEl(long accumulatedFine) {
+    // Conversion ADC cumulé → angle élévation avec interpolation linéaire
 
     if (!elTableLoaded) {
-        float potDegreesTotal = (float)accumulatedAdc * 360.0 / 1024.0;
-        return potDegreesTotal / GEAR_RATIO_EL;
-    }
-
-    // Trouver l'intervalle contenant cet ADC
-    int lowerIndex = -1;
-    int upperIndex = -1;
-
-    for (int i = 0; i < EL_TABLE_POINTS - 1; i++) {
-        if (accumulatedAdc >= elCorrectionTable[i] && accumulatedAdc <= elCorrectionTable[i + 1]) {
-            lowerIndex = i;
-            upperIndex = i + 1;
-            break;
-        }
-    }
-
-    // ADC avant premier point
-    if (lowerIndex == -1 && accumulatedAdc < elCorrectionTable[0]) {
-        lowerIndex = 0;
-        upperIndex = 1;
-    }
-
-    // ADC après dernier point
-    if (lowerIndex == -1 && accumulatedAdc > elCorrectionTable[EL_TABLE_POINTS - 1]) {
-        lowerIndex = EL_TABLE_POINTS - 2;
-        upperIndex = EL_TABLE_POINTS - 1;
+        return angleScale(accumulatedFine, POT_MT_EL_SCALE);
     }
 
-    if (lowerIndex == -1) {
-        lowerIndex = 0;
-        upperIndex = 1;
-    }
-
-    // Interpolation linéaire
-    long adcLow = elCorrectionTable[lowerIndex];
-    long adcHigh = elCorrectionTable[upperIndex];
-    float angleLow = (float)(EL_TABLE_START + lowerIndex * EL_TABLE_STEP);
-    float angleHigh = (float)(EL_TABLE_START + upperIndex * EL_TABLE_STEP);
-
-    if (adcHigh == adcLow) {
-        return angleLow;
-    }
-
-    float ratio = (float)(accumulatedAdc - adcLow) / (float)(adcHigh - adcLow);
-    return angleLow + ratio * (angleHigh - angleLow);
+    return tableLookupMdeg(elLookup, accumulatedFine);
 }
 
 void calibrateElTablePoint(float realDegrees) {
@@ -1344,10 +1586,11 @@ void calibrateElTablePoint(float realDegrees) {
     int calibratedAngle = EL_TABLE_START + pointIndex * EL_TABLE_STEP;
 
     elCorrectionTable[pointIndex] = accumulatedAdcEl;
-    EEPROM.put(EEPROM_EL_TABLE + (pointIndex * sizeof(long)), elCorrectionTable[pointIndex]);
+    EEPROM.put(EEPROM_EL_TABLE + (pointIndex * sizeof(int32_t)), elCorrectionTable[pointIndex]);
+    tableLookupRebuild(elLookup);
 
-    currentEl = (float)calibratedAngle;
-    filteredEl = currentEl;
+    setPositionEl(calibratedAngle * ANGLE_PER_DEG);
+    resetEstimatorEl(currentElMdeg);
 
     #if DEBUG_SERIAL
         Serial.println(F("═══════════════════════════════════════"));
@@ -1361,6 +1604,18 @@ void calibrateElTablePoint(float realDegrees) {
     #endif
 }
 
+void setElCorrectionTable(const long *points) {
+    for (int i = 0; i < EL_TABLE_POINTS; i++) {
+        elCorrectionTable[i] = points[i];
+        EEPROM.put(EEPROM_EL_TABLE + (i * sizeof(int32_t)), elCorrectionTable[i]);
+    }
+    tableLookupRebuild(elLookup);
+    elTableLoaded = true;
+
+    setPositionEl(adcToAngleEl(accumulatedFineEl));
+    resetEstimatorEl(currentElMdeg);
+}
+
 void printElCorrectionTable() {
     // Affichage complet de la table de correction via sendToClient
     sendToClient("\r\n");
@@ -20,14 +20,20 @@
   #include "encoder_ssi.h"
 #endif
 
+#if ENABLE_POWER_MONITOR && TEST_ENCODERS
+  #include "power_monitor.h"
+#endif
+
 #if TEST_MOTORS
   #if USE_NANO_STEPPER
     // Mode Nano: communication UART avec Arduino Nano dédié
     #include "motor_nano.h"
+    #include "table_sweep.h"
   #else
     // Mode direct: contrôle moteurs par le Mega
     #if (MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER)
       #include "motor_stepper.h"
+      #include "step_generator.h"
     #endif
   #endif
 
@@ -49,6 +55,8 @@
   #include "nextion.h"
 #endif
 
+#include "profiler.h"     // Macros vides si ENABLE_PROFILER = 0
+
 // ════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES TIMING
 // ════════════════════════════════════════════════════════════════
@@ -106,6 +114,11 @@ void setup() {
         delay(100);
     #endif
 
+    #if ENABLE_POWER_MONITOR && TEST_ENCODERS
+        // Après setupEncoders: canal alimentation échantillonné
+        setupPowerMonitor();
+    #endif
+
     // ─────────────────────────────────────────────────────────────
     // ÉTAPE 2 : MOTEURS (Nano, Stepper direct ou DC selon config)
     // ─────────────────────────────────────────────────────────────
@@ -181,12 +194,26 @@ void setup() {
 // ════════════════════════════════════════════════════════════════
 
 void loop() {
+    // ─────────────────────────────────────────────────────────────
+    // ÉTAPE 0 : SURVEILLANCE ALIMENTATION
+    // ─────────────────────────────────────────────────────────────
+    // Coupure: moteurs arrêtés et position sauvée par le moniteur,
+    // plus aucun mouvement ni écriture tant que la tension n'est pas
+    // revenue
+
+    #if ENABLE_POWER_MONITOR && TEST_ENCODERS
+        if (updatePowerMonitor()) return;
+    #endif
+
+    PROF_START();
+
     // ─────────────────────────────────────────────────────────────
     // ÉTAPE 1 : LECTURE ENCODEURS (toutes les 150ms)
     // ─────────────────────────────────────────────────────────────
 
     #if TEST_ENCODERS
         updateEncoders();
+        PROF_MARK(PROF_ENCODERS);
     #endif
 
     // ─────────────────────────────────────────────────────────────
@@ -197,6 +224,7 @@ void loop() {
         // Boutons manuels uniquement en mode direct (pas en mode Nano)
         #if (MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER)
             checkManualButtons();
+            PROF_MARK(PROF_BUTTONS);
         #endif
     #endif
 
@@ -206,6 +234,7 @@ void loop() {
 
     #if TEST_LIMITS
         checkLimits();
+        PROF_MARK(PROF_LIMITS);
     #endif
 
     // ─────────────────────────────────────────────────────────────
@@ -216,6 +245,9 @@ void loop() {
         #if USE_NANO_STEPPER
             // Mode Nano: le Nano gère les fins de course localement
             // On envoie juste les commandes et on lit les réponses
+            #if TABLE_SWEEP_ACTIVE
+                updateTableSweep();  // Balayage CSWEEP/ESWEEP (vitesse directe)
+            #endif
             updateMotorNano();
         #else
             // Mode direct: vérifier sécurité avant mouvement
@@ -232,6 +264,8 @@ void loop() {
                 if (azSafe && elSafe) {
                     updateMotorControl();
                 } else {
+                    // Impulsions de fond (ENABLE_STEP_TIMER) coupées
+                    stopStepGenerators();
                     if (!azSafe) {
                         extern float targetAz;
                         targetAz = -1.0;
@@ -260,6 +294,8 @@ void loop() {
                 if (!elSafeDC) stopMotorDC(2);
             }
         #endif
+
+        PROF_MARK(PROF_MOTORS);
     #endif
 
     // ─────────────────────────────────────────────────────────────
@@ -268,6 +304,7 @@ void loop() {
 
     #if TEST_NETWORK
         handleNetwork();
+        PROF_MARK(PROF_NETWORK);
     #endif
 
     // ─────────────────────────────────────────────────────────────
@@ -277,18 +314,23 @@ void loop() {
     #if ENABLE_NEXTION && TEST_NEXTION
         // Lecture événements tactiles (boutons CW, CCW, UP, DOWN, STOP)
         readNextionTouch();
+        PROF_MARK(PROF_NEXTION_TOUCH);
 
         // Gestion calibration par appui long (3 sec sur tAzCur/tElCur)
         handleCalibrationTouch();
+        PROF_MARK(PROF_NEXTION_CALIB);
 
         // Gestion boutons → envoi commandes Easycom incrémentales
         handleNextionButtons();
+        PROF_MARK(PROF_NEXTION_BUTTONS);
 
         // Mise à jour affichage positions (Az/El actuelle et cible)
         updateNextion();
+        PROF_MARK(PROF_NEXTION_UPDATE);
 
         // Mise à jour indicateurs état (direction moteurs, mode)
         updateNextionIndicators();
+        PROF_MARK(PROF_NEXTION_INDIC);
     #endif
 
     // ─────────────────────────────────────────────────────────────
@@ -336,6 +378,8 @@ void loop() {
     // ─────────────────────────────────────────────────────────────
 
     // yield();  // Pas nécessaire sur Arduino AVR, mais bonne pratique
+
+    PROF_END();
 }
 
 // ════════════════════════════════════════════════════════════════
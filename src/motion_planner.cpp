@@ -0,0 +1,43 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Mouvement coordonné Az/El (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: motion_planner.cpp
+// Description: Rapport des durées meneur / suiveur
+// ════════════════════════════════════════════════════════════════
+
+#include "motion_planner.h"
+
+#if ENABLE_COORDINATED_MOVE
+
+void coordinatedScale(angle_t errAz, angle_t errEl, long maxRateAz, long maxRateEl,
+                      long &scaleAz, long &scaleEl) {
+    scaleAz = MOTION_SCALE_ONE;
+    scaleEl = MOTION_SCALE_ONE;
+    if (maxRateAz <= 0 || maxRateEl <= 0) return;
+
+    // Durées comparées par produits croisés (pas de division)
+    float timeAz = (float)labs(errAz) * (float)maxRateEl;
+    float timeEl = (float)labs(errEl) * (float)maxRateAz;
+    if (timeAz == 0.0 || timeEl == 0.0) return;
+
+    if (timeAz >= timeEl) {
+        scaleEl = (long)(timeEl / timeAz * (float)MOTION_SCALE_ONE);
+    } else {
+        scaleAz = (long)(timeAz / timeEl * (float)MOTION_SCALE_ONE);
+    }
+}
+
+#else
+
+// ════════════════════════════════════════════════════════════════
+// STUB (axes indépendants)
+// ════════════════════════════════════════════════════════════════
+
+void coordinatedScale(angle_t errAz, angle_t errEl, long maxRateAz, long maxRateEl,
+                      long &scaleAz, long &scaleEl) {
+    (void)errAz; (void)errEl; (void)maxRateAz; (void)maxRateEl;
+    scaleAz = MOTION_SCALE_ONE;
+    scaleEl = MOTION_SCALE_ONE;
+}
+
+#endif // ENABLE_COORDINATED_MOVE
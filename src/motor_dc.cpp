@@ -3,109 +3,246 @@
 // ════════════════════════════════════════════════════════════════
 // Fichier: motor_dc.cpp
 // Description: Implémentation contrôle moteurs DC MC33926
-//              FUTUR - Pour rotator SVH3
+//              PID position cadencé par Timer5, pour rotator SVH3
 // ════════════════════════════════════════════════════════════════
 
 #include "motor_dc.h"
 #include "encoder_ssi.h"  // Pour currentAz, currentEl
+#include "adc_sampler.h"  // Pour ADC_CH_CURRENT_AZ/EL
+#include "trajectory.h"   // Cible interpolée en poursuite
+
+#define DC_ACTIVE (MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED || MOTOR_EL_TYPE == MOTOR_DC_BRUSHED)
+
+// Timer5 CTC, prescaler 8: tick de 0.5 µs
+#define PID_TIMER_TICKS  ((unsigned long)PID_PERIOD_MS * 2000UL)
+#define PID_MAX_PERIODS  3    // Périodes rattrapées au plus (loop retardée)
+
+static_assert(PID_TIMER_TICKS >= 1 && PID_TIMER_TICKS <= 65535UL,
+              "PID_PERIOD_MS: période Timer5 hors 16 bits (1 à 32 ms)");
+
+// Consignes et état mouvement (motor_stepper.cpp / motor_nano.cpp)
+extern float targetAz;
+extern float targetEl;
+extern bool movingAz;
+extern bool movingEl;
 
 // ════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES
 // ════════════════════════════════════════════════════════════════
 
 // Contrôleurs PID
-PIDController pidAz = {PID_KP_AZ, PID_KI_AZ, PID_KD_AZ, 0, 0, 0};
-PIDController pidEl = {PID_KP_EL, PID_KI_EL, PID_KD_EL, 0, 0, 0};
+PIDController pidAz = {PID_KP_AZ, PID_KI_AZ, PID_KD_AZ, PID_KFF_AZ, 0, 0, 0, false};
+PIDController pidEl = {PID_KP_EL, PID_KI_EL, PID_KD_EL, PID_KFF_EL, 0, 0, 0, false};
 
-// PWM courant
+// PWM courant (signé: > 0 = CW / UP)
 int currentPWM_Az = 0;
 int currentPWM_El = 0;
 
+// Consigne fixe atteinte: PWM à 0 jusqu'à PID_RESTART
+#if MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED
+static bool holdingAz = true;
+#endif
+#if MOTOR_EL_TYPE == MOTOR_DC_BRUSHED
+static bool holdingEl = true;
+#endif
+
+// Périodes Timer5 écoulées depuis le dernier calcul (ISR → loop)
+static volatile uint8_t pidPeriods = 0;
+
+// ════════════════════════════════════════════════════════════════
+// CADENCE TIMER5
+// ════════════════════════════════════════════════════════════════
+// L'ISR ne fait que compter: le calcul (flottant, lectures ADC) reste
+// dans loop(), au plus une période de gigue, dt constant pour le PID.
+
+#if DC_ACTIVE
+
+static inline void pidTick() {
+    if (pidPeriods < 255) pidPeriods++;
+}
+
+#if defined(__AVR__)
+ISR(TIMER5_COMPA_vect) { pidTick(); }
+
+static void startPidTimer() {
+    noInterrupts();
+    TCCR5A = 0;
+    TCCR5B = 0;
+    TCNT5 = 0;
+    OCR5A = PID_TIMER_TICKS - 1;
+    TIFR5 = _BV(OCF5A);
+    TIMSK5 |= _BV(OCIE5A);
+    TCCR5B = _BV(WGM52) | _BV(CS51);        // CTC, /8
+    interrupts();
+}
+#else
+static void startPidTimer() {
+    halTimerStart(5, PID_TIMER_TICKS, pidTick);
+}
+#endif
+
+#endif // DC_ACTIVE
+
 // ════════════════════════════════════════════════════════════════
 // INITIALISATION
 // ════════════════════════════════════════════════════════════════
 
 void setupMotorsDC() {
-    // TODO: Configuration pins moteur 1 (Azimuth)
+    // Configuration pins moteur 1 (Azimuth)
     #if MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED
-        // pinMode(M1_IN1, OUTPUT);    // PWM
-        // pinMode(M1_IN2, OUTPUT);    // Direction
-        // pinMode(M1_D2, OUTPUT);     // Disable
-        // pinMode(M1_SF, INPUT);      // Status Flag
-        // pinMode(M1_FB, INPUT);      // Current Feedback
-        //
-        // digitalWrite(M1_D2, HIGH);  // Disable au démarrage (sécurité)
-        // digitalWrite(M1_IN1, LOW);
-        // digitalWrite(M1_IN2, LOW);
+        pinMode(M1_IN1, OUTPUT);    // PWM
+        pinMode(M1_IN2, OUTPUT);    // Direction
+        pinMode(M1_D2, OUTPUT);     // Disable
+        pinMode(M1_SF, INPUT);      // Status Flag
+        pinMode(M1_FB, INPUT);      // Current Feedback
+
+        digitalWrite(M1_D2, HIGH);  // Disable au démarrage (sécurité)
+        digitalWrite(M1_IN1, LOW);
+        digitalWrite(M1_IN2, LOW);
     #endif
 
-    // TODO: Configuration pins moteur 2 (Élévation)
+    // Configuration pins moteur 2 (Élévation)
     #if MOTOR_EL_TYPE == MOTOR_DC_BRUSHED
-        // pinMode(M2_IN1, OUTPUT);
-        // pinMode(M2_IN2, OUTPUT);
-        // pinMode(M2_D2, OUTPUT);
-        // pinMode(M2_SF, INPUT);
-        // pinMode(M2_FB, INPUT);
-        //
-        // digitalWrite(M2_D2, HIGH);  // Disable au démarrage
-        // digitalWrite(M2_IN1, LOW);
-        // digitalWrite(M2_IN2, LOW);
+        pinMode(M2_IN1, OUTPUT);
+        pinMode(M2_IN2, OUTPUT);
+        pinMode(M2_D2, OUTPUT);
+        pinMode(M2_SF, INPUT);
+        pinMode(M2_FB, INPUT);
+
+        digitalWrite(M2_D2, HIGH);  // Disable au démarrage
+        digitalWrite(M2_IN1, LOW);
+        digitalWrite(M2_IN2, LOW);
     #endif
 
-    // TODO: Initialisation PID
-    // resetPID(pidAz);
-    // resetPID(pidEl);
+    resetPID(pidAz);
+    resetPID(pidEl);
+
+    #if DC_ACTIVE
+        startPidTimer();
+    #endif
 
     #if DEBUG_SERIAL
         Serial.println(F("=== MOTEURS DC BRUSHED INITIALISÉS ==="));
         Serial.println(F("Driver: MC33926 (mode sign-magnitude)"));
+        Serial.print(F("PID: Timer5, période "));
+        Serial.print(PID_PERIOD_MS);
+        Serial.println(F(" ms"));
     #endif
 }
 
+// ════════════════════════════════════════════════════════════════
+// ASSERVISSEMENT D'UN AXE
+// ════════════════════════════════════════════════════════════════
+
+#if DC_ACTIVE
+
+/**
+ * Rapproche la sortie de 0 d'au plus PWM_SLEW (arrêt sans à-coup)
+ */
+static float slewToZero(float output) {
+    if (output > PWM_SLEW) return output - PWM_SLEW;
+    if (output < -PWM_SLEW) return output + PWM_SLEW;
+    return 0.0;
+}
+
+/**
+ * Un pas d'asservissement
+ *
+ * @param motor    1=Azimuth, 2=Élévation
+ * @param pid      Contrôleur de l'axe
+ * @param trajAxis TRAJ_AZ ou TRAJ_EL
+ * @param target   Consigne (degrés, < 0 = aucune)
+ * @param current  Position lue (degrés)
+ * @param wrap     Erreur ramenée à ±180° (azimuth)
+ * @param limitPin Fin de course série NC (LOW = butée)
+ * @param holding  Consigne fixe atteinte (bande morte)
+ * @param dt       Période (secondes)
+ * @return PWM signé appliqué
+ */
+static int servoAxis(int motor, PIDController &pid, uint8_t trajAxis, float target, float current,
+                     bool wrap, uint8_t limitPin, bool &holding, float dt) {
+    // Fin de course: arrêt sec, comme le pas-à-pas
+    if (digitalRead(limitPin) == LOW) {
+        holding = true;
+        stopMotorDC(motor);
+        return 0;
+    }
+
+    if (target < 0) {
+        // Sans consigne: rampe jusqu'à 0 puis driver désactivé
+        holding = true;
+        pid.output = slewToZero(pid.output);
+        pid.lastMeasurement = current;
+        if (pid.output == 0.0) {
+            stopMotorDC(motor);
+            return 0;
+        }
+    } else {
+        // Cible interpolée en poursuite, vitesse en anticipation
+        angle_t goal = angleFromDegrees(target);
+        long rate = 0;
+        bool tracking = trajectoryTarget(trajAxis, goal, rate);
+
+        float error = angleToDegrees(goal) - current;
+        if (wrap) {
+            if (error > 180.0) error -= 360.0;
+            else if (error < -180.0) error += 360.0;
+        }
+
+        if (tracking) {
+            trajectoryRecordError(trajAxis, angleFromDegrees(error));
+            holding = false;
+        } else {
+            holding = abs(error) < (holding ? PID_RESTART : PID_DEADBAND);
+        }
+
+        if (holding) {
+            // Pont en frein, intégrale figée (frottement sec déjà compensé)
+            pid.output = slewToZero(pid.output);
+            pid.lastMeasurement = current;
+        } else {
+            calculatePID(pid, current + error, current, rate * 0.001, dt);
+        }
+    }
+
+    int pwm = (int)lround(pid.output);
+    setMotorDC(motor, abs(pwm), (pwm >= 0) ? HIGH : LOW);
+
+    // Vérifier status (fault detection)
+    if (!checkMotorStatus(motor)) {
+        stopMotorDC(motor);
+        #if DEBUG_SERIAL
+            Serial.println(motor == 1 ? F("ERREUR: Fault moteur Az") : F("ERREUR: Fault moteur El"));
+        #endif
+        return 0;
+    }
+    return pwm;
+}
+
+#endif // DC_ACTIVE
+
 // ════════════════════════════════════════════════════════════════
 // CONTRÔLE PRINCIPAL MOTEURS DC
 // ════════════════════════════════════════════════════════════════
 
 void updateMotorControlDC() {
-    // TODO: Logique similaire à motor_stepper mais avec PWM
-
-    // Variables externes (définies dans motor_stepper.h si actif)
-    // extern float targetAz, targetEl;
+    #if DC_ACTIVE
+        noInterrupts();
+        uint8_t periods = pidPeriods;
+        pidPeriods = 0;
+        interrupts();
+        if (periods == 0) return;
+
+        float dt = min((int)periods, PID_MAX_PERIODS) * (PID_PERIOD_MS * 0.001);
+    #endif
 
     // ─────────────────────────────────────────────────────────────
     // ASSERVISSEMENT AZIMUTH DC
     // ─────────────────────────────────────────────────────────────
 
     #if MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED
-        // if (targetAz >= 0) {
-        //     // Calcul erreur position
-        //     extern float calculateAngularError(float, float);
-        //     float errAz = calculateAngularError(targetAz, currentAz);
-        //
-        //     // Si position non atteinte
-        //     if (abs(errAz) > POSITION_TOLERANCE) {
-        //         // PID calcule vitesse (PWM) nécessaire
-        //         float pidOutput = calculatePID(pidAz, 0, errAz);  // Consigne: erreur → 0
-        //         int pwm = constrain((int)abs(pidOutput), 0, 255);
-        //         int direction = (errAz > 0) ? HIGH : LOW;
-        //
-        //         // Appliquer commande moteur
-        //         setMotorDC(1, pwm, direction);
-        //         currentPWM_Az = pwm;
-        //
-        //         // Vérifier status (fault detection)
-        //         if (!checkMotorStatus(1)) {
-        //             stopMotorDC(1);
-        //             Serial.println(F("ERREUR: Fault moteur Az"));
-        //         }
-        //     } else {
-        //         // Position atteinte
-        //         stopMotorDC(1);
-        //         targetAz = -1.0;
-        //     }
-        // } else {
-        //     stopMotorDC(1);
-        // }
+        currentPWM_Az = servoAxis(1, pidAz, TRAJ_AZ, targetAz, currentAz, true, LIMIT_AZ, holdingAz, dt);
+        movingAz = (currentPWM_Az != 0);
     #endif
 
     // ─────────────────────────────────────────────────────────────
@@ -113,32 +250,39 @@ void updateMotorControlDC() {
     // ─────────────────────────────────────────────────────────────
 
     #if MOTOR_EL_TYPE == MOTOR_DC_BRUSHED
-        // TODO: Logique identique pour élévation
+        currentPWM_El = servoAxis(2, pidEl, TRAJ_EL, targetEl, currentEl, false, LIMIT_EL, holdingEl, dt);
+        movingEl = (currentPWM_El != 0);
     #endif
 }
 
 // ════════════════════════════════════════════════════════════════
 // COMMANDE MOTEUR DC
 // ════════════════════════════════════════════════════════════════
+// Sign-magnitude: IN2 = sens. IN2 = HIGH, le moteur voit 255 - IN1:
+// IN1 reçoit alors le complément pour que pwmValue reste l'amplitude.
+// pwmValue = 0: IN1 = IN2, les deux sorties au même potentiel (frein).
 
 void setMotorDC(int motor, int pwmValue, int direction) {
-    // TODO: Application PWM + direction mode sign-magnitude
-
     // Validation PWM
-    pwmValue = constrain(pwmValue, 0, 255);
+    pwmValue = constrain(pwmValue, PWM_MIN, PWM_MAX);
+    int duty = (direction == HIGH) ? 255 - pwmValue : pwmValue;
 
     if (motor == 1) {  // Azimuth
         #if MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED
-            // digitalWrite(M1_D2, LOW);         // Enable driver
-            // analogWrite(M1_IN1, pwmValue);    // PWM vitesse
-            // digitalWrite(M1_IN2, direction);  // Direction
+            digitalWrite(M1_IN2, direction);  // Direction
+            analogWrite(M1_IN1, duty);        // PWM vitesse
+            digitalWrite(M1_D2, LOW);         // Enable driver
+        #else
+            (void)duty;
         #endif
 
     } else if (motor == 2) {  // Élévation
         #if MOTOR_EL_TYPE == MOTOR_DC_BRUSHED
-            // digitalWrite(M2_D2, LOW);
-            // analogWrite(M2_IN1, pwmValue);
-            // digitalWrite(M2_IN2, direction);
+            digitalWrite(M2_IN2, direction);
+            analogWrite(M2_IN1, duty);
+            digitalWrite(M2_D2, LOW);
+        #else
+            (void)duty;
         #endif
     }
 }
@@ -150,16 +294,22 @@ void setMotorDC(int motor, int pwmValue, int direction) {
 void stopMotorDC(int motor) {
     if (motor == 1) {  // Azimuth
         #if MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED
-            // analogWrite(M1_IN1, 0);       // PWM = 0
-            // digitalWrite(M1_D2, HIGH);    // Disable driver
+            analogWrite(M1_IN1, 0);       // PWM = 0
+            digitalWrite(M1_IN2, LOW);
+            digitalWrite(M1_D2, HIGH);    // Disable driver
             currentPWM_Az = 0;
+            movingAz = false;
+            resetPID(pidAz);
         #endif
 
     } else if (motor == 2) {  // Élévation
         #if MOTOR_EL_TYPE == MOTOR_DC_BRUSHED
-            // analogWrite(M2_IN1, 0);
-            // digitalWrite(M2_D2, HIGH);
+            analogWrite(M2_IN1, 0);
+            digitalWrite(M2_IN2, LOW);
+            digitalWrite(M2_D2, HIGH);
             currentPWM_El = 0;
+            movingEl = false;
+            resetPID(pidEl);
         #endif
     }
 }
@@ -181,37 +331,37 @@ void stopAllMotorsDC() {
 // CALCUL PID
 // ════════════════════════════════════════════════════════════════
 
-float calculatePID(PIDController &pid, float setpoint, float measurement) {
-    // TODO: Implémentation PID classique
-
-    // Calcul temps écoulé
-    // unsigned long now = millis();
-    // float deltaTime = (now - pid.lastTime) / 1000.0;  // secondes
-    // pid.lastTime = now;
-
+float calculatePID(PIDController &pid, float setpoint, float measurement, float feedForward, float dt) {
     // Calcul erreur
-    // float error = setpoint - measurement;
-
-    // Terme proportionnel
-    // float pTerm = pid.kp * error;
+    float error = setpoint - measurement;
+
+    // Dérivée sur la mesure (ramenée à ±180°): une nouvelle consigne
+    // ne produit pas d'impulsion
+    float rate = 0;
+    if (pid.primed && dt > 0) {
+        float delta = measurement - pid.lastMeasurement;
+        if (delta > 180.0) delta -= 360.0;
+        else if (delta < -180.0) delta += 360.0;
+        rate = delta / dt;
+    }
+    pid.lastMeasurement = measurement;
+    pid.primed = true;
 
-    // Terme intégral (avec anti-windup)
-    // pid.integral += error * deltaTime;
-    // pid.integral = constrain(pid.integral, -100, 100);  // Limiter windup
-    // float iTerm = pid.ki * pid.integral;
+    // Terme intégral candidat, sortie avant limitation
+    float integral = constrain(pid.integral + pid.ki * error * dt, -PID_I_LIMIT, PID_I_LIMIT);
+    float output = pid.kp * error + integral - pid.kd * rate + pid.kff * feedForward;
 
-    // Terme dérivé
-    // float dTerm = 0;
-    // if (deltaTime > 0) {
-    //     dTerm = pid.kd * (error - pid.lastError) / deltaTime;
-    // }
-    // pid.lastError = error;
+    // Saturation puis rampe
+    float limited = constrain(output, -PWM_MAX, PWM_MAX);
+    limited = constrain(limited, pid.output - PWM_SLEW, pid.output + PWM_SLEW);
 
-    // Sortie PID
-    // float output = pTerm + iTerm + dTerm;
-    // return constrain(output, -255, 255);
+    // Anti-windup: intégrale figée si la limitation retient la sortie
+    // dans le sens de l'erreur
+    bool clamped = (limited < output && error > 0) || (limited > output && error < 0);
+    if (!clamped) pid.integral = integral;
 
-    return 0.0;  // TODO: Remplacer par implémentation réelle
+    pid.output = limited;
+    return limited;
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -220,8 +370,9 @@ float calculatePID(PIDController &pid, float setpoint, float measurement) {
 
 void resetPID(PIDController &pid) {
     pid.integral = 0;
-    pid.lastError = 0;
-    pid.lastTime = millis();
+    pid.lastMeasurement = 0;
+    pid.output = 0;
+    pid.primed = false;
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -229,20 +380,14 @@ void resetPID(PIDController &pid) {
 // ════════════════════════════════════════════════════════════════
 
 float readMotorCurrent(int motor) {
-    // TODO: Lecture feedback courant MC33926
-
-    // int fbPin = (motor == 1) ? M1_FB : M2_FB;
-    // int adcValue = analogRead(fbPin);
+    // Sortie FB échantillonnée avec les pots (adc_sampler.h)
+    uint8_t ch = (motor == 1) ? ADC_CH_CURRENT_AZ : ADC_CH_CURRENT_EL;
 
-    // Conversion ADC → tension (5V ref, 10-bit ADC)
-    // float voltage = (adcValue * 5000.0) / 1023.0;  // mV
+    // Conversion ADC → tension (5V ref)
+    float voltage = adcSamplerRead(ch) * 5000.0 / POT_FINE_MAX;  // mV
 
     // Conversion tension → courant (MC33926: 525 mV/A)
-    // float current_mA = voltage / 0.525;
-
-    // return current_mA;
-
-    return 0.0;  // TODO: Remplacer par implémentation réelle
+    return voltage / 0.525;
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -250,18 +395,10 @@ float readMotorCurrent(int motor) {
 // ════════════════════════════════════════════════════════════════
 
 bool checkMotorStatus(int motor) {
-    // TODO: Lecture status flag (fault detection)
-
-    // int sfPin = (motor == 1) ? M1_SF : M2_SF;
+    int sfPin = (motor == 1) ? M1_SF : M2_SF;
 
     // SF = LOW → Fault (surintensité, surchauffe, court-circuit)
-    // if (digitalRead(sfPin) == LOW) {
-    //     return false;  // Fault détecté
-    // }
-
-    // return true;  // OK
-
-    return true;  // TODO: Remplacer par implémentation réelle
+    return digitalRead(sfPin) == HIGH;
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -275,7 +412,7 @@ void printMotorDCDebug() {
         Serial.print(F(" ("));
         Serial.print((currentPWM_Az * 100) / 255);
         Serial.print(F("%) | Current: "));
-        // Serial.print(readMotorCurrent(1), 0);
+        Serial.print(readMotorCurrent(1), 0);
         Serial.print(F("mA | Status: "));
         Serial.println(checkMotorStatus(1) ? F("OK") : F("FAULT"));
     #endif
@@ -286,7 +423,7 @@ void printMotorDCDebug() {
         Serial.print(F(" ("));
         Serial.print((currentPWM_El * 100) / 255);
         Serial.print(F("%) | Current: "));
-        // Serial.print(readMotorCurrent(2), 0);
+        Serial.print(readMotorCurrent(2), 0);
         Serial.print(F("mA | Status: "));
         Serial.println(checkMotorStatus(2) ? F("OK") : F("FAULT"));
     #endif
@@ -23,12 +23,16 @@
 // Protocole Nano → Mega:
 //   "OK\n"       - Commande reçue
 //   "READY\n"    - Nano prêt
-//   "LIMIT:AZ\n" - Fin de course Az
-//   "LIMIT:EL\n" - Fin de course El
+//   "LIMIT:AZ:CW\n" / "CLEAR:AZ:CW\n" - Fin de course (idem CCW, EL:UP, EL:DOWN)
+//
+// Protocole binaire négocié: voir motor_nano.h (trames 5 octets, CRC-8)
 // ════════════════════════════════════════════════════════════════
 
 #include "motor_nano.h"
 #include "encoder_ssi.h"
+#include "trajectory.h"     // Cible interpolée + vitesse d'anticipation
+#include "motion_planner.h" // Ralliement coordonné Az/El
+#include "step_fusion.h"    // Pas commandés (vitesses VEL intégrées)
 
 #if USE_NANO_STEPPER
 
@@ -60,6 +64,12 @@ int8_t currentDirEl = 0;
 // Mode vitesse actuel: 0=LENT, 1=RAPIDE
 uint8_t currentSpeedMode = 1;
 
+// Commande en vitesse (mdeg/s antenne)
+long targetRateAz = 0;
+long targetRateEl = 0;
+long commandRateAz = 0;
+long commandRateEl = 0;
+
 // Buffer réception
 char nanoRxBuffer[64];
 uint8_t nanoRxIndex = 0;
@@ -74,6 +84,528 @@ const unsigned long NANO_KEEPALIVE_INTERVAL = 500;  // 500ms entre keepalives (2
 unsigned long lastNanoResponse = 0;  // Timestamp dernière réponse valide
 bool nanoConnected = false;          // État connexion actuel
 
+// Protocole binaire (négocié au démarrage, voir motor_nano.h)
+bool nanoBinaryMode = false;
+static uint8_t nanoTxFrame[NANO_VEL_FRAME_SIZE];  // Dernière trame émise (renvoi)
+static uint8_t nanoTxFrameSize = 0;
+static uint8_t nanoTxSeq = 0;
+static bool nanoAwaitingAck = false;
+static unsigned long nanoLastSend = 0;
+static uint8_t nanoMissedAcks = 0;           // ACK perdus consécutifs
+
+#if NANO_BINARY_PROTOCOL
+static uint8_t nanoRxFrame[NANO_FRAME_SIZE];
+static uint8_t nanoRxFrameIndex = 0;         // 0 = hors trame
+static int16_t nanoRxSeq = -1;               // -1 = aucune trame reçue
+#endif
+
+// Statistiques liaison (printMotorNanoDebug)
+static unsigned long nanoCrcErrors = 0;      // Trames Nano rejetées (CRC)
+static unsigned long nanoLostFrames = 0;     // Trous de séquence Nano → Mega
+static unsigned long nanoAckTimeouts = 0;    // Commandes Mega sans ACK
+
+#if ENABLE_STEP_FUSION
+// Pas commandés (step_fusion.h): le Nano ne renvoie pas ses pas, les
+// vitesses VEL envoyées sont intégrées. Le Nano rejoint chaque vitesse
+// avec sa propre rampe (VEL_ACCEL_DPS2): sans ce retard, chaque départ
+// compterait ~0.04° de trop. Trame MOVE (texte, manuel, STOP) ou ACK
+// perdus: mouvement inconnu jusqu'à la prochaine trame VEL
+static int16_t countedVel[2] = { 0, 0 };     // Vitesse envoyée, 1/NANO_VEL_SCALE pas/s, sens antenne
+static long countedRate[2] = { 0, 0 };       // Vitesse du Nano (rampe), idem × 256
+static long countedSteps[2] = { 0, 0 };
+static long countedRemainder[2] = { 0, 0 };  // 1/NANO_VEL_SCALE pas × ms
+static unsigned long countedLastMs = 0;
+static bool countedValid = false;
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS INTERNES
+// ════════════════════════════════════════════════════════════════
+
+#if ENABLE_STEP_FUSION
+// Rampe Nano en 1/NANO_VEL_SCALE pas/s par ms, × 256
+#define COUNTED_ACCEL_Q8_AZ  ((long)(VEL_ACCEL_DPS2 * NANO_STEPS_PER_DEG_AZ * NANO_VEL_SCALE * 256.0 / 1000.0 + 0.5))
+#define COUNTED_ACCEL_Q8_EL  ((long)(VEL_ACCEL_DPS2 * NANO_STEPS_PER_DEG_EL * NANO_VEL_SCALE * 256.0 / 1000.0 + 0.5))
+
+static void integrateCountedSteps() {
+    static const long accelQ8[2] = { COUNTED_ACCEL_Q8_AZ, COUNTED_ACCEL_Q8_EL };
+    unsigned long now = millis();
+    // Au-delà d'une seconde sans trame, le chien de garde Nano a coupé
+    long dtMs = (long)min(now - countedLastMs, 1000UL);
+    countedLastMs = now;
+    for (uint8_t axis = FUSION_AZ; axis <= FUSION_EL; axis++) {
+        long target = (long)countedVel[axis] << 8;
+        long ms = dtMs;
+        // Rampe milliseconde par milliseconde (≤ 500 ms de 0 à VEL_MAX_DPS)
+        while (ms > 0 && countedRate[axis] != target) {
+            countedRate[axis] = constrain(target, countedRate[axis] - accelQ8[axis],
+                                          countedRate[axis] + accelQ8[axis]);
+            countedRemainder[axis] += countedRate[axis] >> 8;
+            ms--;
+        }
+        countedRemainder[axis] += (long)countedVel[axis] * ms;
+        countedSteps[axis] += countedRemainder[axis] / (NANO_VEL_SCALE * 1000L);
+        countedRemainder[axis] %= (NANO_VEL_SCALE * 1000L);
+    }
+}
+
+/**
+ * Nouvelle vitesse appliquée par le Nano (sens antenne)
+ * valid = false: mouvement non compté (trame MOVE, liaison perdue)
+ */
+static void countVelocity(int16_t velAz, int16_t velEl, bool valid) {
+    integrateCountedSteps();
+    countedVel[FUSION_AZ] = valid ? velAz : 0;
+    countedVel[FUSION_EL] = valid ? velEl : 0;
+    if (!valid) {
+        countedRate[FUSION_AZ] = 0;
+        countedRate[FUSION_EL] = 0;
+    }
+    countedValid = valid;
+}
+#endif
+
+static void setNanoConnected(bool connected) {
+    if (connected == nanoConnected) return;
+    nanoConnected = connected;
+    digitalWrite(NANO_STATUS_PIN, connected ? HIGH : LOW);
+    #if DEBUG_SERIAL
+        if (connected) Serial.println(F("[NANO] Communication établie"));
+        else Serial.println(F("[NANO] !!! COMMUNICATION PERDUE !!!"));
+    #endif
+}
+
+// CRC-8 polynôme 0x07 (SMBus), calcul bit à bit: 3 octets par trame
+static uint8_t nanoCrc8(const uint8_t *data, uint8_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+        crc ^= *data++;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static void requestNanoBinary() {
+    #if NANO_BINARY_PROTOCOL
+        nanoBinaryMode = false;
+        NANO_SERIAL.println(F("BIN?"));
+    #endif
+}
+
+/**
+ * Envoi commande combinée (texte "M:dirAz:dirEl:speed" ou trame MOVE)
+ * nanoDirEl: direction déjà inversée (câblage moteur côté Nano)
+ */
+static void sendNanoMove(int8_t dirAz, int8_t nanoDirEl, uint8_t speed) {
+    #if ENABLE_STEP_FUSION
+        countVelocity(0, 0, false);
+    #endif
+    if (nanoBinaryMode) {
+        nanoTxFrame[0] = NANO_FRAME_SYNC;
+        nanoTxFrame[1] = NANO_FRAME_MOVE;
+        nanoTxFrame[2] = ++nanoTxSeq;
+        nanoTxFrame[3] = (uint8_t)((dirAz + 1) | ((nanoDirEl + 1) << 2) | (speed << 4));
+        nanoTxFrame[4] = nanoCrc8(&nanoTxFrame[1], 3);
+        nanoTxFrameSize = NANO_FRAME_SIZE;
+        NANO_SERIAL.write(nanoTxFrame, NANO_FRAME_SIZE);
+        nanoAwaitingAck = true;
+        nanoLastSend = millis();
+        return;
+    }
+
+    NANO_SERIAL.print(F("M:"));
+    NANO_SERIAL.print(dirAz);
+    NANO_SERIAL.print(F(":"));
+    NANO_SERIAL.print(nanoDirEl);
+    NANO_SERIAL.print(F(":"));
+    NANO_SERIAL.println(speed);
+}
+
+/**
+ * Envoi trame VEL (binaire uniquement), unités 1/16 step/s
+ * nanoVelEl: vitesse El déjà inversée (câblage moteur côté Nano)
+ */
+static void sendNanoVelocity(int16_t velAz, int16_t nanoVelEl) {
+    #if ENABLE_STEP_FUSION
+        countVelocity(velAz, -nanoVelEl, true);
+    #endif
+    nanoTxFrame[0] = NANO_FRAME_SYNC;
+    nanoTxFrame[1] = NANO_FRAME_VEL;
+    nanoTxFrame[2] = ++nanoTxSeq;
+    nanoTxFrame[3] = (uint8_t)(velAz & 0xFF);
+    nanoTxFrame[4] = (uint8_t)((uint16_t)velAz >> 8);
+    nanoTxFrame[5] = (uint8_t)(nanoVelEl & 0xFF);
+    nanoTxFrame[6] = (uint8_t)((uint16_t)nanoVelEl >> 8);
+    nanoTxFrame[7] = nanoCrc8(&nanoTxFrame[1], NANO_VEL_FRAME_SIZE - 2);
+    nanoTxFrameSize = NANO_VEL_FRAME_SIZE;
+    NANO_SERIAL.write(nanoTxFrame, NANO_VEL_FRAME_SIZE);
+    nanoAwaitingAck = true;
+    nanoLastSend = millis();
+}
+
+static void resendNanoFrame() {
+    NANO_SERIAL.write(nanoTxFrame, nanoTxFrameSize);
+    nanoAwaitingAck = true;
+    nanoLastSend = millis();
+}
+
+static void printNanoLimitEvent(uint8_t bit, bool active) {
+    #if DEBUG_SERIAL
+        Serial.print(active ? F("[NANO] !!! LIMIT ") : F("[NANO] Limit "));
+        switch (bit) {
+            case NANO_LIMIT_BIT_CW:   Serial.print(F("CW")); break;
+            case NANO_LIMIT_BIT_CCW:  Serial.print(F("CCW")); break;
+            case NANO_LIMIT_BIT_UP:   Serial.print(F("UP")); break;
+            default:                  Serial.print(F("DOWN")); break;
+        }
+        Serial.println(active ? F(" !!!") : F(" clear"));
+    #else
+        (void)bit;
+        (void)active;
+    #endif
+}
+
+static uint8_t nanoLimitMask() {
+    return (nanoLimitCW ? NANO_LIMIT_BIT_CW : 0) |
+           (nanoLimitCCW ? NANO_LIMIT_BIT_CCW : 0) |
+           (nanoLimitUp ? NANO_LIMIT_BIT_UP : 0) |
+           (nanoLimitDown ? NANO_LIMIT_BIT_DOWN : 0);
+}
+
+/**
+ * Application d'un masque complet de fins de course
+ * Fin de course activée: arrêt de l'axe, cible conservée
+ * (permet le mouvement opposé)
+ */
+static void applyNanoLimits(uint8_t mask) {
+    uint8_t previous = nanoLimitMask();
+    uint8_t raised = mask & ~previous;
+
+    nanoLimitCW = (mask & NANO_LIMIT_BIT_CW) != 0;
+    nanoLimitCCW = (mask & NANO_LIMIT_BIT_CCW) != 0;
+    nanoLimitUp = (mask & NANO_LIMIT_BIT_UP) != 0;
+    nanoLimitDown = (mask & NANO_LIMIT_BIT_DOWN) != 0;
+
+    if (raised & (NANO_LIMIT_BIT_CW | NANO_LIMIT_BIT_CCW)) {
+        movingAz = false;
+        currentDirAz = 0;
+    }
+    if (raised & (NANO_LIMIT_BIT_UP | NANO_LIMIT_BIT_DOWN)) {
+        movingEl = false;
+        currentDirEl = 0;
+    }
+
+    for (uint8_t bit = NANO_LIMIT_BIT_CW; bit <= NANO_LIMIT_BIT_DOWN; bit <<= 1) {
+        if ((mask ^ previous) & bit) printNanoLimitEvent(bit, (mask & bit) != 0);
+    }
+}
+
+static uint8_t nanoLimitBit(const char *name) {
+    if (strcmp(name, "AZ:CW") == 0) return NANO_LIMIT_BIT_CW;
+    if (strcmp(name, "AZ:CCW") == 0) return NANO_LIMIT_BIT_CCW;
+    if (strcmp(name, "EL:UP") == 0) return NANO_LIMIT_BIT_UP;
+    if (strcmp(name, "EL:DOWN") == 0) return NANO_LIMIT_BIT_DOWN;
+    return 0;
+}
+
+static void handleNanoLine(const char *line) {
+    #if DEBUG_MOTOR_CMD
+        Serial.print(F("[NANO] ← "));
+        Serial.println(line);
+    #endif
+
+    // Toute réponse valide = communication OK
+    lastNanoResponse = millis();
+    setNanoConnected(true);
+
+    // OK → Commande reçue par le Nano (accusé réception, rien à faire)
+    if (strcmp(line, "OK") == 0) {
+        return;
+    }
+
+    // READY → Nano (re)démarré: reset états, renégociation binaire
+    if (strcmp(line, "READY") == 0) {
+        #if DEBUG_SERIAL
+            Serial.println(F("[NANO] Nano prêt!"));
+        #endif
+        currentDirAz = 0;
+        currentDirEl = 0;
+        requestNanoBinary();
+        return;
+    }
+
+    #if NANO_BINARY_PROTOCOL
+        // BIN:OK → Nano compatible, passage en trames binaires
+        if (strcmp(line, "BIN:OK") == 0) {
+            nanoBinaryMode = true;
+            nanoAwaitingAck = false;
+            nanoMissedAcks = 0;
+            nanoRxSeq = -1;
+            #if DEBUG_SERIAL
+                Serial.println(F("[NANO] Protocole binaire actif"));
+            #endif
+            return;
+        }
+    #endif
+
+    // LIMIT:xx / CLEAR:xx → Fin de course atteinte / dégagée
+    bool active = (strncmp(line, "LIMIT:", 6) == 0);
+    if (active || strncmp(line, "CLEAR:", 6) == 0) {
+        uint8_t bit = nanoLimitBit(line + 6);
+        uint8_t mask = nanoLimitMask();
+        applyNanoLimits(active ? (mask | bit) : (mask & ~bit));
+    }
+}
+
+#if NANO_BINARY_PROTOCOL
+/**
+ * Trame reçue complète (nanoRxFrame)
+ * @return false si CRC invalide (trame décalée ou corrompue)
+ */
+static bool handleNanoFrame() {
+    if (nanoCrc8(&nanoRxFrame[1], 3) != nanoRxFrame[4]) {
+        nanoCrcErrors++;
+        return false;
+    }
+
+    uint8_t type = nanoRxFrame[1];
+    uint8_t seq = nanoRxFrame[2];
+    uint8_t arg = nanoRxFrame[3];
+
+    // Trou de séquence = trame(s) Nano perdue(s)
+    if (nanoRxSeq >= 0) {
+        nanoLostFrames += (uint8_t)(seq - (uint8_t)nanoRxSeq - 1);
+    }
+    nanoRxSeq = seq;
+
+    lastNanoResponse = millis();
+    setNanoConnected(true);
+
+    #if DEBUG_MOTOR_CMD
+        Serial.print(F("[NANO] ← #"));
+        Serial.print(seq);
+        Serial.print(F(" type 0x"));
+        Serial.print(type, HEX);
+        Serial.print(F(" arg 0x"));
+        Serial.println(arg, HEX);
+    #endif
+
+    switch (type) {
+        case NANO_FRAME_ACK:
+            if (arg == nanoTxSeq) {
+                nanoAwaitingAck = false;
+                nanoMissedAcks = 0;
+            }
+            break;
+
+        case NANO_FRAME_NACK:
+            // Commande corrompue en route: renvoi immédiat
+            if (arg == nanoTxSeq) resendNanoFrame();
+            break;
+
+        case NANO_FRAME_LIMIT:
+            applyNanoLimits(arg);
+            break;
+    }
+    return true;
+}
+
+/**
+ * Resynchronisation après CRC invalide: un octet perdu décale la
+ * trame, qui a alors avalé le SYNC de la suivante. Reprise au
+ * prochain SYNC dans nanoRxFrame[1..4], sinon hors trame.
+ */
+static void resyncNanoFrame() {
+    for (uint8_t i = 1; i < NANO_FRAME_SIZE; i++) {
+        if (nanoRxFrame[i] == NANO_FRAME_SYNC) {
+            nanoRxFrameIndex = NANO_FRAME_SIZE - i;
+            memmove(nanoRxFrame, &nanoRxFrame[i], nanoRxFrameIndex);
+            return;
+        }
+    }
+    nanoRxFrameIndex = 0;
+}
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// SEUILS EN VIRGULE FIXE (millidegrés, angle.h)
+// ════════════════════════════════════════════════════════════════
+
+#define TOLERANCE_MDEG     ANGLE_DEG(POSITION_TOLERANCE)
+#define RESTART_MDEG       ANGLE_DEG(POSITION_RESTART)
+#define SPEED_SWITCH_MDEG  ANGLE_DEG(SPEED_SWITCH_THRESHOLD)
+
+// ════════════════════════════════════════════════════════════════
+// CIBLE INTERPOLÉE
+// ════════════════════════════════════════════════════════════════
+
+/**
+ * Consigne Easycom (float, bord protocole) → millidegrés
+ * Conversion refaite seulement quand la consigne change
+ */
+struct TargetAngle {
+    float degrees;
+    angle_t angle;
+};
+
+static TargetAngle targetAngleAz = { NO_TARGET, 0 };
+static TargetAngle targetAngleEl = { NO_TARGET, 0 };
+
+static angle_t targetAngle(TargetAngle &cache, float target) {
+    if (target != cache.degrees) {
+        cache.degrees = target;
+        cache.angle = angleFromDegrees(target);
+    }
+    return cache.angle;
+}
+
+/**
+ * Cible effective d'un axe: consigne fixe, ou cible interpolée du
+ * prédicteur en poursuite (erreur de poursuite enregistrée)
+ * rate: vitesse d'anticipation en mdeg/s (0 hors poursuite)
+ */
+static angle_t trackedGoal(uint8_t axis, float target, angle_t goal, angle_t current, long &rate) {
+    rate = 0;
+    if (target > NO_TARGET && trajectoryTarget(axis, goal, rate)) {
+        trajectoryRecordError(axis, goal - current);
+    }
+    return goal;
+}
+
+// ════════════════════════════════════════════════════════════════
+// COMMANDE EN VITESSE
+// ════════════════════════════════════════════════════════════════
+
+#if NANO_VELOCITY_CONTROL
+
+// Vitesses en mdeg/s, gain et accélération en Q8
+#define VEL_KP_Q8          ((long)(VEL_KP * 256.0 + 0.5))          // mdeg/s par mdeg
+#define VEL_ACCEL_Q8       ((long)(VEL_ACCEL_DPS2 * 256.0 + 0.5))  // mdeg/s par ms
+#define VEL_MAX_MDPS       ANGLE_DEG(VEL_MAX_DPS)
+#define VEL_DEADBAND_MDEG  ANGLE_DEG(VEL_DEADBAND)
+#define VEL_RESTART_MDEG   ANGLE_DEG(VEL_RESTART)
+#define FUSION_TOLERANCE_MDEG  ANGLE_DEG(FUSION_TOLERANCE)
+#define FUSION_RESTART_MDEG    ANGLE_DEG(FUSION_RESTART)
+
+// Unités Nano (pas/s × NANO_VEL_SCALE) par mdeg/s, Q16
+#define VEL_UNITS_Q16_AZ   ANGLE_SCALE_Q16(NANO_STEPS_PER_DEG_AZ * NANO_VEL_SCALE / 1000.0)
+#define VEL_UNITS_Q16_EL   ANGLE_SCALE_Q16(NANO_STEPS_PER_DEG_EL * NANO_VEL_SCALE / 1000.0)
+
+static_assert((double)VEL_MAX_MDPS * VEL_UNITS_Q16_AZ < 2147483647.0 &&
+              (double)VEL_MAX_MDPS * VEL_UNITS_Q16_EL < 2147483647.0,
+              "velocityUnits: VEL_MAX_DPS x pas/degré dépasse 32 bits");
+
+/**
+ * Vitesse d'un axe (mdeg/s): anticipation + proportionnel, bornée et
+ * limitée en variation (profil trapézoïdal)
+ *
+ * Consigne fixe (targetRate = 0): arrêt sous VEL_DEADBAND, reprise
+ * au-delà de VEL_RESTART. En poursuite, la correction reste continue.
+ *
+ * scaleQ16 (motion_planner.h) réduit palier et accélération de l'axe
+ * suiveur d'un ralliement coordonné, MOTION_SCALE_ONE sinon.
+ * locked: position sur les pas (step_fusion.h), seuils FUSION_*.
+ */
+static long axisVelocity(bool active, angle_t target, angle_t current, long targetRate,
+                         long lastRate, bool &moving, unsigned long dtMs, long scaleQ16,
+                         bool locked) {
+    long rate = 0;
+
+    if (active) {
+        angle_t err = target - current;
+        angle_t hold;
+        if (locked) hold = moving ? FUSION_TOLERANCE_MDEG : FUSION_RESTART_MDEG;
+        else hold = moving ? VEL_DEADBAND_MDEG : VEL_RESTART_MDEG;
+        if (targetRate != 0 || labs(err) > hold) {
+            rate = targetRate + ((err * VEL_KP_Q8) >> 8);
+        }
+        // Poursuite: pas d'inversion contre la cible pour une petite
+        // avance (bruit encodeur, jeu) → attendre que la cible rejoigne
+        if (((targetRate < 0 && rate > 0) || (targetRate > 0 && rate < 0)) &&
+            labs(err) <= VEL_RESTART_MDEG) {
+            rate = 0;
+        }
+    }
+
+    long maxRate = (VEL_MAX_MDPS * scaleQ16) >> 16;
+    rate = constrain(rate, -maxRate, maxRate);
+    long dv = ((((long)dtMs * VEL_ACCEL_Q8) >> 8) * scaleQ16) >> 16;
+    if (dv < 1) dv = 1;
+    rate = constrain(rate, lastRate - dv, lastRate + dv);
+    return rate;
+}
+
+static int16_t velocityUnits(long rateMdps, long unitsQ16) {
+    // Arrondi au plus proche (symétrique), comme lround()
+    long units = rateMdps * unitsQ16;
+    units = (units >= 0) ? (units + 0x8000L) >> 16 : -((-units + 0x8000L) >> 16);
+    return (int16_t)constrain(units, -32767L, 32767L);
+}
+
+static void updateVelocityControl(unsigned long now, unsigned long dtMs, angle_t goalAz, angle_t goalEl,
+                                  angle_t posAz, angle_t posEl) {
+    static int16_t sentVelAz = 0;
+    static int16_t sentVelEl = 0;
+
+    // Ralliement des deux axes sur consigne fixe: arrivée simultanée
+    long scaleAz = MOTION_SCALE_ONE;
+    long scaleEl = MOTION_SCALE_ONE;
+    if (targetAz > NO_TARGET && targetEl > NO_TARGET && targetRateAz == 0 && targetRateEl == 0) {
+        coordinatedScale(goalAz - posAz, goalEl - posEl, VEL_MAX_MDPS, VEL_MAX_MDPS, scaleAz, scaleEl);
+    }
+
+    long rateAz = axisVelocity(targetAz > NO_TARGET, goalAz, posAz, targetRateAz,
+                               commandRateAz, movingAz, dtMs, scaleAz, fusionLocked(FUSION_AZ));
+    long rateEl = axisVelocity(targetEl > NO_TARGET, goalEl, posEl, targetRateEl,
+                               commandRateEl, movingEl, dtMs, scaleEl, fusionLocked(FUSION_EL));
+
+    // Blocage directionnel sur fins de course (mouvement opposé permis)
+    if ((nanoLimitCW && rateAz > 0) || (nanoLimitCCW && rateAz < 0)) rateAz = 0;
+    if ((nanoLimitUp && rateEl > 0) || (nanoLimitDown && rateEl < 0)) rateEl = 0;
+
+    int16_t velAz = velocityUnits(rateAz, VEL_UNITS_Q16_AZ);
+    int16_t velEl = velocityUnits(rateEl, VEL_UNITS_Q16_EL);
+
+    commandRateAz = rateAz;
+    commandRateEl = rateEl;
+    movingAz = (velAz != 0);
+    movingEl = (velEl != 0);
+
+    int8_t dirAz = (velAz > 0) - (velAz < 0);
+    int8_t dirEl = (velEl > 0) - (velEl < 0);
+
+    #if DEBUG_MOTOR_CMD
+        if (dirAz != currentDirAz || dirEl != currentDirEl) {
+            Serial.print(F("[NANO] → VEL Az="));
+            Serial.print(rateAz);
+            Serial.print(F(" El="));
+            Serial.print(rateEl);
+            Serial.println(F(" mdeg/s"));
+        }
+    #endif
+
+    currentDirAz = dirAz;
+    currentDirEl = dirEl;
+    currentSpeedMode = 1;
+
+    // Envoi sur changement, keepalive 500 ms quand moteurs actifs
+    bool motorsActive = (velAz != 0 || velEl != 0);
+    bool changed = (velAz != sentVelAz || velEl != sentVelEl);
+    bool keepalive = motorsActive && (now - lastNanoKeepalive >= NANO_KEEPALIVE_INTERVAL);
+
+    if (changed || keepalive) {
+        lastNanoKeepalive = now;
+        // Inversion direction El (câblage moteur inversé côté Nano)
+        sendNanoVelocity(velAz, -velEl);
+        sentVelAz = velAz;
+        sentVelEl = velEl;
+    }
+}
+
+#endif // NANO_VELOCITY_CONTROL
+
 // ════════════════════════════════════════════════════════════════
 // INITIALISATION
 // ════════════════════════════════════════════════════════════════
@@ -103,6 +635,9 @@ void setupMotorNano() {
     while (NANO_SERIAL.available()) {
         NANO_SERIAL.read();
     }
+
+    // Proposition trames binaires (réponse traitée par readNanoResponse)
+    requestNanoBinary();
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -120,12 +655,26 @@ void updateMotorNano() {
     // ─────────────────────────────────────────────────────────────────
     if (lastNanoResponse > 0 && (now - lastNanoResponse) > NANO_TIMEOUT_MS) {
         // Timeout: plus de réponse depuis NANO_TIMEOUT_MS
-        if (nanoConnected) {
-            nanoConnected = false;
-            digitalWrite(NANO_STATUS_PIN, LOW);
-            #if DEBUG_SERIAL
-                Serial.println(F("[NANO] !!! COMMUNICATION PERDUE !!!"));
+        setNanoConnected(false);
+    }
+
+    // Binaire: ACK manquant → renvoi, puis perte après N échecs
+    if (nanoAwaitingAck && (now - nanoLastSend) > NANO_ACK_TIMEOUT_MS) {
+        nanoAwaitingAck = false;
+        nanoAckTimeouts++;
+        if (nanoMissedAcks < NANO_MAX_MISSED_ACKS) nanoMissedAcks++;
+
+        if (nanoMissedAcks >= NANO_MAX_MISSED_ACKS) {
+            // Dernière vitesse peut-être jamais appliquée: pas inconnus
+            #if ENABLE_STEP_FUSION
+                countVelocity(0, 0, false);
             #endif
+            setNanoConnected(false);
+            // Nano redémarré en texte (READY ignoré en binaire) ou
+            // liaison coupée: renégociation, commandes texte d'ici là
+            requestNanoBinary();
+        } else {
+            resendNanoFrame();
         }
     }
 
@@ -134,33 +683,54 @@ void updateMotorNano() {
     // ─────────────────────────────────────────────────────────────────
     // Si on est en mode manuel (speed=2), les commandes sont gérées
     // directement par sendManualMove(), on ne fait rien ici
-    if (currentSpeedMode == 2) {
+    // (idem balayage speed=3, sendNanoSweep())
+    if (currentSpeedMode >= 2) {
         return;
     }
 
     // Envoi commandes au Nano (périodique) - MODE AUTOMATIQUE seulement
     if (now - lastNanoUpdate >= NANO_UPDATE_INTERVAL) {
+        // Position à cet instant: dernière lecture + vitesse estimée
+        // (compense l'âge de la lecture, jusqu'à ENCODER_READ_INTERVAL)
+        angle_t posAz = currentAzAt(now);
+        angle_t posEl = currentElAt(now);
+
+        // Cible interpolée entre consignes PstRotator (prédicteur)
+        angle_t goalAz = trackedGoal(TRAJ_AZ, targetAz, targetAngle(targetAngleAz, targetAz),
+                                     posAz, targetRateAz);
+        angle_t goalEl = trackedGoal(TRAJ_EL, targetEl, targetAngle(targetAngleEl, targetEl),
+                                     posEl, targetRateEl);
+
+        #if NANO_VELOCITY_CONTROL
+            // Nano binaire: vitesse continue au lieu de direction + speedMode
+            if (nanoBinaryMode) {
+                unsigned long dtMs = min(now - lastNanoUpdate, 100UL);
+                lastNanoUpdate = now;
+                updateVelocityControl(now, dtMs, goalAz, goalEl, posAz, posEl);
+                return;
+            }
+        #endif
         lastNanoUpdate = now;
 
         // ─────────────────────────────────────────────────────────────
         // CALCUL DIRECTION AZIMUTH
         // ─────────────────────────────────────────────────────────────
         int8_t newDirAz = 0;
-        float errAz = 0;
+        angle_t errAz = 0;
 
         if (targetAz > NO_TARGET) {
             // Calcul erreur SANS wrap-around (rotor avec butées mécaniques 0-343°)
-            errAz = targetAz - currentAz;
+            errAz = goalAz - posAz;
 
             // Hystérésis: seuil différent selon état moteur
             //   En mouvement → s'arrête à POSITION_TOLERANCE (0.15°)
             //   À l'arrêt   → redémarre à POSITION_RESTART (0.50°)
-            float threshold = movingAz ? POSITION_TOLERANCE : POSITION_RESTART;
+            angle_t threshold = movingAz ? TOLERANCE_MDEG : RESTART_MDEG;
 
-            if (abs(errAz) > threshold) {
+            if (labs(errAz) > threshold) {
                 newDirAz = (errAz > 0) ? 1 : -1;
                 movingAz = true;
-            } else if (abs(errAz) <= POSITION_TOLERANCE) {
+            } else if (labs(errAz) <= TOLERANCE_MDEG) {
                 #if DEBUG_MOTOR_CMD
                     if (movingAz) {
                         Serial.print(F("[NANO] Az ATTEINT: "));
@@ -178,17 +748,17 @@ void updateMotorNano() {
         // CALCUL DIRECTION ÉLÉVATION
         // ─────────────────────────────────────────────────────────────
         int8_t newDirEl = 0;
-        float errEl = 0;
+        angle_t errEl = 0;
 
         if (targetEl > NO_TARGET) {
-            errEl = targetEl - currentEl;
+            errEl = goalEl - posEl;
 
-            float threshold = movingEl ? POSITION_TOLERANCE : POSITION_RESTART;
+            angle_t threshold = movingEl ? TOLERANCE_MDEG : RESTART_MDEG;
 
-            if (abs(errEl) > threshold) {
+            if (labs(errEl) > threshold) {
                 newDirEl = (errEl > 0) ? 1 : -1;
                 movingEl = true;
-            } else if (abs(errEl) <= POSITION_TOLERANCE) {
+            } else if (labs(errEl) <= TOLERANCE_MDEG) {
                 #if DEBUG_MOTOR_CMD
                     if (movingEl) {
                         Serial.print(F("[NANO] El ATTEINT: "));
@@ -214,8 +784,8 @@ void updateMotorNano() {
         // CALCUL MODE VITESSE (selon distance max des deux axes)
         // ─────────────────────────────────────────────────────────────
         // 0 = LENT (proche de la cible), 1 = RAPIDE (loin de la cible)
-        float maxErr = max(abs(errAz), abs(errEl));
-        uint8_t newSpeedMode = (maxErr > SPEED_SWITCH_THRESHOLD) ? 1 : 0;
+        angle_t maxErr = max(labs(errAz), labs(errEl));
+        uint8_t newSpeedMode = (maxErr > SPEED_SWITCH_MDEG) ? 1 : 0;
 
         // ─────────────────────────────────────────────────────────────
         // ENVOI COMMANDE AU NANO
@@ -232,13 +802,7 @@ void updateMotorNano() {
 
         if (stateChanged || keepalive) {
             lastNanoKeepalive = now;
-            // Format: M:dirAz:dirEl:speed
-            NANO_SERIAL.print(F("M:"));
-            NANO_SERIAL.print(newDirAz);
-            NANO_SERIAL.print(F(":"));
-            NANO_SERIAL.print(nanoDirEl);
-            NANO_SERIAL.print(F(":"));
-            NANO_SERIAL.println(newSpeedMode);
+            sendNanoMove(newDirAz, nanoDirEl, newSpeedMode);
 
             #if DEBUG_MOTOR_CMD
                 if (stateChanged) {
@@ -274,117 +838,32 @@ void updateMotorNano() {
 
 void readNanoResponse() {
     while (NANO_SERIAL.available()) {
-        char c = NANO_SERIAL.read();
+        uint8_t c = NANO_SERIAL.read();
+
+        #if NANO_BINARY_PROTOCOL
+            // Trame binaire: SYNC hors trame, puis 4 octets quelconques
+            if (nanoRxFrameIndex > 0 || c == NANO_FRAME_SYNC) {
+                nanoRxFrame[nanoRxFrameIndex++] = c;
+                if (nanoRxFrameIndex == NANO_FRAME_SIZE) {
+                    nanoRxFrameIndex = 0;
+                    if (!handleNanoFrame()) resyncNanoFrame();
+                }
+                continue;
+            }
+
+            // Binaire négocié: octet hors trame = reste d'une trame
+            // abîmée, jamais une ligne texte
+            if (nanoBinaryMode) continue;
+        #endif
 
         if (c == '\n' || c == '\r') {
             if (nanoRxIndex > 0) {
                 nanoRxBuffer[nanoRxIndex] = '\0';
-
-                #if DEBUG_MOTOR_CMD
-                    Serial.print(F("[NANO] ← "));
-                    Serial.println(nanoRxBuffer);
-                #endif
-
-                // ═══════════════════════════════════════════════════════
-                // MISE À JOUR STATUT COMMUNICATION
-                // ═══════════════════════════════════════════════════════
-                // Toute réponse valide = communication OK
-                lastNanoResponse = millis();
-                if (!nanoConnected) {
-                    nanoConnected = true;
-                    digitalWrite(NANO_STATUS_PIN, HIGH);
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] Communication établie"));
-                    #endif
-                }
-
-                // Parser la réponse
-                // OK → Commande reçue par le Nano
-                if (strcmp(nanoRxBuffer, "OK") == 0) {
-                    // Accusé réception, rien à faire
-                }
-                // READY → Nano démarré et prêt
-                else if (strcmp(nanoRxBuffer, "READY") == 0) {
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] Nano prêt!"));
-                    #endif
-                    // Reset des états au démarrage
-                    currentDirAz = 0;
-                    currentDirEl = 0;
-                }
-                // LIMIT:AZ:CW → Fin de course Az CW atteinte
-                else if (strcmp(nanoRxBuffer, "LIMIT:AZ:CW") == 0) {
-                    nanoLimitCW = true;
-                    movingAz = false;
-                    currentDirAz = 0;
-                    // NE PAS effacer targetAz: permet mouvement opposé (CCW)
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] !!! LIMIT CW !!!"));
-                    #endif
-                }
-                // LIMIT:AZ:CCW → Fin de course Az CCW atteinte
-                else if (strcmp(nanoRxBuffer, "LIMIT:AZ:CCW") == 0) {
-                    nanoLimitCCW = true;
-                    movingAz = false;
-                    currentDirAz = 0;
-                    // NE PAS effacer targetAz: permet mouvement opposé (CW)
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] !!! LIMIT CCW !!!"));
-                    #endif
-                }
-                // LIMIT:EL:UP → Fin de course El UP atteinte
-                else if (strcmp(nanoRxBuffer, "LIMIT:EL:UP") == 0) {
-                    nanoLimitUp = true;
-                    movingEl = false;
-                    currentDirEl = 0;
-                    // NE PAS effacer targetEl: permet mouvement opposé (DOWN)
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] !!! LIMIT UP !!!"));
-                    #endif
-                }
-                // LIMIT:EL:DOWN → Fin de course El DOWN atteinte
-                else if (strcmp(nanoRxBuffer, "LIMIT:EL:DOWN") == 0) {
-                    nanoLimitDown = true;
-                    movingEl = false;
-                    currentDirEl = 0;
-                    // NE PAS effacer targetEl: permet mouvement opposé (UP)
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] !!! LIMIT DOWN !!!"));
-                    #endif
-                }
-                // CLEAR:AZ:CW → Fin de course Az CW dégagée
-                else if (strcmp(nanoRxBuffer, "CLEAR:AZ:CW") == 0) {
-                    nanoLimitCW = false;
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] Limit CW clear"));
-                    #endif
-                }
-                // CLEAR:AZ:CCW → Fin de course Az CCW dégagée
-                else if (strcmp(nanoRxBuffer, "CLEAR:AZ:CCW") == 0) {
-                    nanoLimitCCW = false;
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] Limit CCW clear"));
-                    #endif
-                }
-                // CLEAR:EL:UP → Fin de course El UP dégagée
-                else if (strcmp(nanoRxBuffer, "CLEAR:EL:UP") == 0) {
-                    nanoLimitUp = false;
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] Limit UP clear"));
-                    #endif
-                }
-                // CLEAR:EL:DOWN → Fin de course El DOWN dégagée
-                else if (strcmp(nanoRxBuffer, "CLEAR:EL:DOWN") == 0) {
-                    nanoLimitDown = false;
-                    #if DEBUG_SERIAL
-                        Serial.println(F("[NANO] Limit DOWN clear"));
-                    #endif
-                }
-
+                handleNanoLine(nanoRxBuffer);
                 nanoRxIndex = 0;
             }
         } else if (nanoRxIndex < sizeof(nanoRxBuffer) - 1) {
-            nanoRxBuffer[nanoRxIndex++] = c;
+            nanoRxBuffer[nanoRxIndex++] = (char)c;
         }
     }
 }
@@ -395,11 +874,16 @@ void readNanoResponse() {
 
 void stopAllMotorsNano() {
     // Envoyer commande combinée STOP (les deux axes à 0)
-    NANO_SERIAL.println(F("M:0:0:0"));
+    sendNanoMove(0, 0, 0);
 
     // Reset état local
     targetAz = NO_TARGET;
     targetEl = NO_TARGET;
+    targetRateAz = 0;
+    targetRateEl = 0;
+    commandRateAz = 0;
+    commandRateEl = 0;
+    trajectoryReset();
     movingAz = false;
     movingEl = false;
     currentDirAz = 0;
@@ -419,11 +903,16 @@ void sendManualMove(int8_t dirAz, int8_t dirEl) {
     // Annuler les cibles automatiques (mode manuel prioritaire)
     targetAz = NO_TARGET;
     targetEl = NO_TARGET;
+    targetRateAz = 0;
+    targetRateEl = 0;
+    commandRateAz = 0;
+    commandRateEl = 0;
+    trajectoryReset();
 
     // Si STOP (0,0), repasser en mode automatique
     if (dirAz == 0 && dirEl == 0) {
         // Envoyer STOP et revenir en mode automatique
-        NANO_SERIAL.println(F("M:0:0:0"));
+        sendNanoMove(0, 0, 0);
         currentDirAz = 0;
         currentDirEl = 0;
         currentSpeedMode = 1;  // Retour mode automatique
@@ -439,11 +928,7 @@ void sendManualMove(int8_t dirAz, int8_t dirEl) {
     // Envoyer commande avec speed=1 (vitesse RAPIDE pour tests)
     // Inversion direction El (câblage moteur inversé côté Nano)
     int8_t nanoDirEl = -dirEl;
-    NANO_SERIAL.print(F("M:"));
-    NANO_SERIAL.print(dirAz);
-    NANO_SERIAL.print(F(":"));
-    NANO_SERIAL.print(nanoDirEl);
-    NANO_SERIAL.println(F(":1"));
+    sendNanoMove(dirAz, nanoDirEl, 1);
 
     // Mettre à jour état local
     currentDirAz = dirAz;
@@ -461,6 +946,81 @@ void sendManualMove(int8_t dirAz, int8_t dirEl) {
     #endif
 }
 
+// ════════════════════════════════════════════════════════════════
+// BALAYAGE À VITESSE CONSTANTE (Calibration automatique)
+// ════════════════════════════════════════════════════════════════
+
+bool sendNanoSweep(int16_t velAz, int16_t velEl) {
+    static int16_t sweepVelAz = 0;
+    static int16_t sweepVelEl = 0;
+
+    if (!nanoBinaryMode) return false;
+
+    unsigned long now = millis();
+    bool start = (currentSpeedMode != NANO_SPEED_SWEEP);
+
+    if (start) {
+        // Cibles automatiques annulées pendant le balayage
+        targetAz = NO_TARGET;
+        targetEl = NO_TARGET;
+        targetRateAz = 0;
+        targetRateEl = 0;
+        commandRateAz = 0;
+        commandRateEl = 0;
+        trajectoryReset();
+    }
+
+    bool changed = start || velAz != sweepVelAz || velEl != sweepVelEl;
+    if (changed || now - lastNanoKeepalive >= NANO_KEEPALIVE_INTERVAL) {
+        lastNanoKeepalive = now;
+        sendNanoVelocity(velAz, -velEl);
+        sweepVelAz = velAz;
+        sweepVelEl = velEl;
+    }
+
+    currentDirAz = (velAz > 0) - (velAz < 0);
+    currentDirEl = (velEl > 0) - (velEl < 0);
+    movingAz = (velAz != 0);
+    movingEl = (velEl != 0);
+
+    // Arrêt: retour au mode automatique
+    currentSpeedMode = (velAz == 0 && velEl == 0) ? 1 : NANO_SPEED_SWEEP;
+
+    #if DEBUG_MOTOR_CMD
+        if (changed) {
+            Serial.print(F("[NANO] → VEL balayage Az="));
+            Serial.print(velAz);
+            Serial.print(F(" El="));
+            Serial.print(velEl);
+            Serial.println(F(" (1/16 step/s)"));
+        }
+    #endif
+    return true;
+}
+
+// ════════════════════════════════════════════════════════════════
+// PAS COMMANDÉS (step_fusion.h)
+// ════════════════════════════════════════════════════════════════
+
+bool commandedSteps(uint8_t axis, long &steps, long &rate) {
+    #if ENABLE_STEP_FUSION
+        if (axis > FUSION_EL) {
+            steps = 0;
+            rate = 0;
+            return false;
+        }
+        integrateCountedSteps();
+        steps = countedSteps[axis];
+        rate = countedVel[axis];
+        return countedValid;
+    #else
+        (void)axis;
+        steps = 0;
+        rate = 0;
+        return false;
+    #endif
+}
+
 // ════════════════════════════════════════════════════════════════
 // DEBUG
 // ════════════════════════════════════════════════════════════════
@@ -511,6 +1071,16 @@ void printMotorNanoDebug() {
     if (nanoLimitDown) Serial.print(F(" LIM_DOWN!"));
 
     Serial.println();
+
+    // Liaison binaire: erreurs détectées par CRC / séquence / ACK
+    if (nanoBinaryMode) {
+        Serial.print(F("[NANO] BIN crc="));
+        Serial.print(nanoCrcErrors);
+        Serial.print(F(" perdues="));
+        Serial.print(nanoLostFrames);
+        Serial.print(F(" sansACK="));
+        Serial.println(nanoAckTimeouts);
+    }
 }
 
 #endif // USE_NANO_STEPPER
@@ -2,7 +2,8 @@
 // EME ROTATOR CONTROLLER - Moteurs Pas-à-Pas (Simple digitalWrite)
 // ════════════════════════════════════════════════════════════════
 // Fichier: motor_stepper.cpp
-// Description: Contrôle moteurs TB6600 - micros() timing, 1 step/call
+// Description: Contrôle moteurs TB6600 - vitesse et sens par loop(),
+//              impulsions sous interruption (step_generator.h)
 // ════════════════════════════════════════════════════════════════
 
 #include "config.h"
@@ -12,6 +13,34 @@
 
 #include "motor_stepper.h"
 #include "encoder_ssi.h"
+#include "step_generator.h"
+#include "motion_planner.h"
+#include "step_fusion.h"
+#include "trajectory.h"
+
+// Vitesses en pas/s (SPEED_xxx: µs par phase, deux phases par pas)
+#define RATE_FAST  (500000L / SPEED_FAST)
+#define RATE_SLOW  (500000L / SPEED_SLOW)
+
+// Pas moteur par degré antenne (réducteur MOTOR_GEAR_RATIO_xx)
+#define STEPS_PER_DEG_AZ  (STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_AZ / 360.0)
+#define STEPS_PER_DEG_EL  (STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_EL / 360.0)
+
+// Au moins un axe pas-à-pas (sinon axes DC seuls, motor_dc.h)
+#define STEPPER_AXES  (MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER)
+#define STEPPER_RAMP  (ENABLE_STEP_TIMER && ENABLE_STEPPER_RAMP && STEPPER_AXES)
+
+// Seuils d'arrêt / reprise (consigne conservée par la rampe): position
+// sur les pas (step_fusion.h) sans bruit pot → bande morte réduite
+#if STEPPER_RAMP
+static float stopTolerance(uint8_t axis) {
+    return fusionLocked(axis) ? FUSION_TOLERANCE : POSITION_TOLERANCE;
+}
+
+static float restartThreshold(uint8_t axis) {
+    return fusionLocked(axis) ? FUSION_RESTART : POSITION_RESTART;
+}
+#endif
 
 // ════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES
@@ -33,11 +62,26 @@ unsigned long lastStepTimeEl = 0;
 int currentDirAz = LOW;
 int currentDirEl = LOW;
 
+// Bouton manuel maintenu (-1, 0, +1), appliqué par updateMotorControl
+static int8_t manualDirAz = 0;
+static int8_t manualDirEl = 0;
+
+#if STEPPER_RAMP
+// Vitesse transmise au générateur (pas/s signés), suit la rampe
+static float rampRateAz = 0.0;
+static float rampRateEl = 0.0;
+static unsigned long rampLastUs = 0;
+#endif
+
 // ════════════════════════════════════════════════════════════════
 // INITIALISATION
 // ════════════════════════════════════════════════════════════════
 
 void setupMotors() {
+    #if ENABLE_STEP_TIMER
+        setupStepGenerator();
+    #endif
+
     #if MOTOR_AZ_TYPE == MOTOR_STEPPER
         pinMode(AZ_STEP, OUTPUT);
         pinMode(AZ_DIR, OUTPUT);
@@ -65,93 +109,251 @@ void setupMotors() {
 
 }
 
+#if !STEPPER_RAMP && STEPPER_AXES
 // ════════════════════════════════════════════════════════════════
-// STEP UNIQUE (non-bloquant, timing géré par appelant)
+// SORTIE DRIVER
 // ════════════════════════════════════════════════════════════════
+// dir: +1 (DIR HIGH), -1 (DIR LOW), 0 = arrêt.
+// ENABLE_STEP_TIMER: vitesse transmise au générateur, loop() repart
+// aussitôt. Sinon: rafale de 10 pas bloquante (1 à 4 ms).
+
+static void driveAxis(uint8_t axis, uint8_t stepPin, uint8_t dirPin, int8_t dir, bool fast) {
+    #if ENABLE_STEP_TIMER
+        (void)stepPin;
+        (void)dirPin;
+        setStepRate(axis, dir * (fast ? RATE_FAST : RATE_SLOW));
+    #else
+        (void)axis;
+        if (dir == 0) return;
+        digitalWrite(dirPin, (dir > 0) ? HIGH : LOW);
+
+        int stepDelay = fast ? SPEED_FAST : SPEED_SLOW;
+        for (int i = 0; i < 10; i++) {
+            digitalWrite(stepPin, HIGH);
+            delayMicroseconds(stepDelay);
+            digitalWrite(stepPin, LOW);
+            delayMicroseconds(stepDelay);
+        }
+    #endif
+}
+#endif
+
+#if STEPPER_RAMP
+// ════════════════════════════════════════════════════════════════
+// RAMPE D'ACCÉLÉRATION
+// ════════════════════════════════════════════════════════════════
+// Vitesse voulue: palier (SPEED_FAST / SPEED_SLOW) borné par la
+// vitesse de freinage √(2·a·distance), qui s'annule sur la cible.
+// La vitesse commandée s'en rapproche d'au plus a·dt par loop.
+// Départ depuis l'arrêt directement à STEPPER_START_DPS.
+// Ralliement coordonné (motion_planner.h): palier, accélération et
+// vitesse de départ × scale → profil homothétique de l'axe meneur.
+
+/**
+ * @param rate      Vitesse commandée courante (pas/s signés)
+ * @param dir       Sens voulu (-1, 0, +1)
+ * @param fast      Palier rapide
+ * @param distDeg   Distance restante jusqu'à la cible (°)
+ * @param stepsPerDeg Pas moteur par degré antenne
+ * @param scale     Facteur de l'axe (1.0 hors ralliement coordonné)
+ * @param dt        Temps depuis la loop précédente (s)
+ * @return Nouvelle vitesse commandée (pas/s signés)
+ */
+static float rampAxis(float rate, int8_t dir, bool fast, float distDeg, float stepsPerDeg,
+                      float scale, float dt) {
+    float accel = STEPPER_ACCEL_DPS2 * stepsPerDeg * scale;
+    float start = STEPPER_START_DPS * stepsPerDeg * scale;
+
+    float wanted = 0.0;
+    if (dir != 0) {
+        float brake = sqrt(2.0 * accel * distDeg * stepsPerDeg);
+        wanted = dir * max(start, min((fast ? RATE_FAST : RATE_SLOW) * scale, brake));
+    }
 
-inline void singleStep(uint8_t stepPin) {
-    digitalWrite(stepPin, HIGH);
-    delayMicroseconds(5);  // Pulse minimum 2.5µs pour TB6600
-    digitalWrite(stepPin, LOW);
+    float maxDelta = accel * dt;
+    float next = rate + constrain(wanted - rate, -maxDelta, maxDelta);
+
+    // Départ arrêté direct à la vitesse de démarrage. Arrêt et
+    // inversion par la rampe: le rotor est immobile au départ suivant
+    if (rate == 0.0 && wanted != 0.0 && fabs(next) < start) {
+        next = (wanted > 0) ? start : -start;
+    }
+    return next;
 }
+#endif
 
 // ════════════════════════════════════════════════════════════════
-// CONTRÔLE PRINCIPAL MOTEURS (1 step par appel, sans timing)
+// CONTRÔLE PRINCIPAL MOTEURS
 // ════════════════════════════════════════════════════════════════
 
 void updateMotorControl() {
+    #if STEPPER_RAMP
+        unsigned long nowUs = micros();
+        float dt = min((nowUs - rampLastUs) * 1e-6, 0.05);
+        rampLastUs = nowUs;
+    #endif
+
     // ─────────────────────────────────────────────────────────────
-    // AZIMUTH - 10 steps par appel, vitesse variable selon distance
+    // AZIMUTH - vitesse variable selon distance
     // ─────────────────────────────────────────────────────────────
 
     #if MOTOR_AZ_TYPE == MOTOR_STEPPER
-        if (targetAz >= 0) {
+        int8_t dirAz = 0;
+        bool fastAz = false;
+        float distAz = 360.0;       // Manuel: pas de freinage
+
+        if (manualDirAz != 0) {
+            // Bouton maintenu: vitesse lente continue
+            if (digitalRead(LIMIT_AZ) == HIGH) dirAz = manualDirAz;
+        } else if (targetAz >= 0) {
             float errAz = targetAz - currentAz;
             if (errAz > 180) errAz -= 360;
             if (errAz < -180) errAz += 360;
 
-            if (abs(errAz) > POSITION_TOLERANCE) {
-                if (digitalRead(LIMIT_AZ) == HIGH) {
-                    digitalWrite(AZ_DIR, (errAz > 0) ? HIGH : LOW);
+            #if STEPPER_RAMP
+                // Consigne conservée (dépassement rattrapé): arrêt à la
+                // tolérance, reprise au-delà du seuil de redémarrage
+                float thresholdAz = (rampRateAz != 0.0) ? stopTolerance(FUSION_AZ) : restartThreshold(FUSION_AZ);
+            #else
+                float thresholdAz = POSITION_TOLERANCE;
+            #endif
 
+            if (abs(errAz) > thresholdAz) {
+                if (digitalRead(LIMIT_AZ) == HIGH) {
+                    dirAz = (errAz > 0) ? 1 : -1;
                     // Vitesse variable: rapide si loin, lent si proche
-                    int stepDelay = (abs(errAz) > SPEED_SWITCH_THRESHOLD) ? SPEED_FAST : SPEED_SLOW;
-
-                    // Faire 10 steps (burst)
-                    for (int i = 0; i < 10; i++) {
-                        digitalWrite(AZ_STEP, HIGH);
-                        delayMicroseconds(stepDelay);
-                        digitalWrite(AZ_STEP, LOW);
-                        delayMicroseconds(stepDelay);
-                    }
-
-                    movingAz = true;
-                } else {
-                    movingAz = false;
+                    fastAz = abs(errAz) > SPEED_SWITCH_THRESHOLD;
+                    distAz = abs(errAz);
                 }
-            } else {
+            } else if (!STEPPER_RAMP) {
                 targetAz = -1.0;
-                movingAz = false;
             }
-        } else {
-            movingAz = false;
         }
     #endif
 
     // ─────────────────────────────────────────────────────────────
-    // ÉLÉVATION - 10 steps par appel, vitesse variable selon distance
+    // ÉLÉVATION - vitesse variable selon distance
     // ─────────────────────────────────────────────────────────────
 
     #if MOTOR_EL_TYPE == MOTOR_STEPPER
-        if (targetEl >= 0) {
+        int8_t dirEl = 0;
+        bool fastEl = false;
+        float distEl = 360.0;
+
+        if (manualDirEl != 0) {
+            if (digitalRead(LIMIT_EL) == HIGH) dirEl = manualDirEl;
+        } else if (targetEl >= 0) {
             float errEl = targetEl - currentEl;
 
-            if (abs(errEl) > POSITION_TOLERANCE) {
-                if (digitalRead(LIMIT_EL) == HIGH) {
-                    digitalWrite(EL_DIR, (errEl > 0) ? HIGH : LOW);
+            #if STEPPER_RAMP
+                float thresholdEl = (rampRateEl != 0.0) ? stopTolerance(FUSION_EL) : restartThreshold(FUSION_EL);
+            #else
+                float thresholdEl = POSITION_TOLERANCE;
+            #endif
 
-                    // Vitesse variable: rapide si loin, lent si proche
-                    int stepDelay = (abs(errEl) > SPEED_SWITCH_THRESHOLD) ? SPEED_FAST : SPEED_SLOW;
-
-                    for (int i = 0; i < 10; i++) {
-                        digitalWrite(EL_STEP, HIGH);
-                        delayMicroseconds(stepDelay);
-                        digitalWrite(EL_STEP, LOW);
-                        delayMicroseconds(stepDelay);
-                    }
-
-                    movingEl = true;
-                } else {
-                    movingEl = false;
+            if (abs(errEl) > thresholdEl) {
+                if (digitalRead(LIMIT_EL) == HIGH) {
+                    dirEl = (errEl > 0) ? 1 : -1;
+                    fastEl = abs(errEl) > SPEED_SWITCH_THRESHOLD;
+                    distEl = abs(errEl);
                 }
-            } else {
+            } else if (!STEPPER_RAMP) {
                 targetEl = -1.0;
-                movingEl = false;
             }
-        } else {
-            movingEl = false;
         }
     #endif
+
+    // ─────────────────────────────────────────────────────────────
+    // RALLIEMENT COORDONNÉ (rampe, deux axes pas-à-pas sur consigne)
+    // ─────────────────────────────────────────────────────────────
+    // Palier commun (celui de l'axe le plus loin), puis facteur
+    // homothétique sur l'axe le plus court (motion_planner.h)
+
+    #if STEPPER_RAMP && MOTOR_AZ_TYPE == MOTOR_STEPPER && MOTOR_EL_TYPE == MOTOR_STEPPER
+        float scaleAz = 1.0;
+        float scaleEl = 1.0;
+        if (manualDirAz == 0 && manualDirEl == 0 && dirAz != 0 && dirEl != 0) {
+            bool fast = fastAz || fastEl;
+            float rate = fast ? RATE_FAST : RATE_SLOW;
+            long sAz, sEl;
+            coordinatedScale(angleFromDegrees(distAz), angleFromDegrees(distEl),
+                             lround(rate * 1000.0 / STEPS_PER_DEG_AZ),
+                             lround(rate * 1000.0 / STEPS_PER_DEG_EL), sAz, sEl);
+            fastAz = fast;
+            fastEl = fast;
+            scaleAz = sAz / (float)MOTION_SCALE_ONE;
+            scaleEl = sEl / (float)MOTION_SCALE_ONE;
+        }
+    #elif STEPPER_RAMP
+        #if MOTOR_AZ_TYPE == MOTOR_STEPPER
+            const float scaleAz = 1.0;
+        #endif
+        #if MOTOR_EL_TYPE == MOTOR_STEPPER
+            const float scaleEl = 1.0;
+        #endif
+    #endif
+
+    // ─────────────────────────────────────────────────────────────
+    // COMMANDE GÉNÉRATEUR / RAFALES
+    // ─────────────────────────────────────────────────────────────
+
+    #if MOTOR_AZ_TYPE == MOTOR_STEPPER
+        #if STEPPER_RAMP
+            // Générateur coupé ailleurs (isAzimuthSafe): repart de zéro.
+            // Fin de course: arrêt sec, pas de rampe vers la butée
+            if (getStepRate(STEP_AXIS_AZ) == 0 && fabs(rampRateAz) >= STEP_RATE_MIN) rampRateAz = 0.0;
+            if (digitalRead(LIMIT_AZ) == LOW) rampRateAz = 0.0;
+            else rampRateAz = rampAxis(rampRateAz, dirAz, fastAz, distAz, STEPS_PER_DEG_AZ, scaleAz, dt);
+            setStepRate(STEP_AXIS_AZ, lround(rampRateAz));
+            movingAz = (rampRateAz != 0.0);
+        #else
+            (void)distAz;
+            driveAxis(STEP_AXIS_AZ, AZ_STEP, AZ_DIR, dirAz, fastAz);
+            movingAz = (dirAz != 0);
+        #endif
+    #endif
+
+    #if MOTOR_EL_TYPE == MOTOR_STEPPER
+        #if STEPPER_RAMP
+            if (getStepRate(STEP_AXIS_EL) == 0 && fabs(rampRateEl) >= STEP_RATE_MIN) rampRateEl = 0.0;
+            if (digitalRead(LIMIT_EL) == LOW) rampRateEl = 0.0;
+            else rampRateEl = rampAxis(rampRateEl, dirEl, fastEl, distEl, STEPS_PER_DEG_EL, scaleEl, dt);
+            setStepRate(STEP_AXIS_EL, lround(rampRateEl));
+            movingEl = (rampRateEl != 0.0);
+        #else
+            (void)distEl;
+            driveAxis(STEP_AXIS_EL, EL_STEP, EL_DIR, dirEl, fastEl);
+            movingEl = (dirEl != 0);
+        #endif
+    #endif
+}
+
+// ════════════════════════════════════════════════════════════════
+// PAS COMMANDÉS (step_fusion.h)
+// ════════════════════════════════════════════════════════════════
+// Compteur du générateur (fronts montants émis). Rafales bloquantes
+// ou axe DC (motor_dc.h): pas non comptés, position encodeur seule
+
+bool commandedSteps(uint8_t axis, long &steps, long &rate) {
+    #if ENABLE_STEP_TIMER
+        static const bool stepperAxis[2] = {
+            MOTOR_AZ_TYPE == MOTOR_STEPPER, MOTOR_EL_TYPE == MOTOR_STEPPER
+        };
+        if (axis > FUSION_EL || !stepperAxis[axis]) {
+            steps = 0;
+            rate = 0;
+            return false;
+        }
+        uint8_t channel = (axis == FUSION_AZ) ? STEP_AXIS_AZ : STEP_AXIS_EL;
+        steps = getStepPosition(channel);
+        rate = getStepRate(channel);
+        return true;
+    #else
+        (void)axis;
+        steps = 0;
+        rate = 0;
+        return false;
+    #endif
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -184,6 +386,13 @@ void stopAllMotors() {
     targetEl = -1.0;
     movingAz = false;
     movingEl = false;
+    manualDirAz = 0;
+    manualDirEl = 0;
+    #if STEPPER_RAMP
+        rampRateAz = 0.0;
+        rampRateEl = 0.0;
+    #endif
+    stopStepGenerators();
     #if DEBUG_MOTOR_CMD
         Serial.println(F("[MOTOR] STOP"));
     #endif
@@ -208,22 +417,46 @@ void checkManualButtons() {
         return;
     }
 
-    #if MOTOR_AZ_TYPE == MOTOR_STEPPER
-        if (digitalRead(BTN_CW) == LOW) {
-            doStep(AZ_STEP, AZ_DIR, HIGH, SPEED_SLOW, LIMIT_AZ);
+    #if ENABLE_STEP_TIMER
+        // Sens mémorisé, impulsions par updateMotorControl (un doStep
+        // croiserait les fronts de l'ISR sur la même broche)
+        int8_t dirAz = 0;
+        int8_t dirEl = 0;
+        #if MOTOR_AZ_TYPE == MOTOR_STEPPER
+            dirAz = (digitalRead(BTN_CW) == LOW) ? 1 : (digitalRead(BTN_CCW) == LOW) ? -1 : 0;
+        #endif
+        #if MOTOR_EL_TYPE == MOTOR_STEPPER
+            dirEl = (digitalRead(BTN_UP) == LOW) ? 1 : (digitalRead(BTN_DOWN) == LOW) ? -1 : 0;
+        #endif
+
+        // Appui: annuler les cibles automatiques (mode manuel prioritaire,
+        // comme sendManualMove() côté Nano), sinon la rampe y retourne
+        // au relâchement
+        if ((dirAz != 0 && manualDirAz == 0) || (dirEl != 0 && manualDirEl == 0)) {
+            targetAz = -1.0;
+            targetEl = -1.0;
+            trajectoryReset();
         }
-        if (digitalRead(BTN_CCW) == LOW) {
-            doStep(AZ_STEP, AZ_DIR, LOW, SPEED_SLOW, LIMIT_AZ);
-        }
-    #endif
+        manualDirAz = dirAz;
+        manualDirEl = dirEl;
+    #else
+        #if MOTOR_AZ_TYPE == MOTOR_STEPPER
+            if (digitalRead(BTN_CW) == LOW) {
+                doStep(AZ_STEP, AZ_DIR, HIGH, SPEED_SLOW, LIMIT_AZ);
+            }
+            if (digitalRead(BTN_CCW) == LOW) {
+                doStep(AZ_STEP, AZ_DIR, LOW, SPEED_SLOW, LIMIT_AZ);
+            }
+        #endif
 
-    #if MOTOR_EL_TYPE == MOTOR_STEPPER
-        if (digitalRead(BTN_UP) == LOW) {
-            doStep(EL_STEP, EL_DIR, HIGH, SPEED_SLOW, LIMIT_EL);
-        }
-        if (digitalRead(BTN_DOWN) == LOW) {
-            doStep(EL_STEP, EL_DIR, LOW, SPEED_SLOW, LIMIT_EL);
-        }
+        #if MOTOR_EL_TYPE == MOTOR_STEPPER
+            if (digitalRead(BTN_UP) == LOW) {
+                doStep(EL_STEP, EL_DIR, HIGH, SPEED_SLOW, LIMIT_EL);
+            }
+            if (digitalRead(BTN_DOWN) == LOW) {
+                doStep(EL_STEP, EL_DIR, LOW, SPEED_SLOW, LIMIT_EL);
+            }
+        #endif
     #endif
 }
 
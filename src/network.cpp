@@ -7,13 +7,14 @@
 
 #include "network.h"
 #include "easycom.h"  // Pour parseEasycomCommand()
+#include "telemetry.h"  // Pour setupTelemetry(), handleTelemetry()
 
 // ════════════════════════════════════════════════════════════════
 // VARIABLES GLOBALES
 // ════════════════════════════════════════════════════════════════
 
-// Buffer réception Serial/Ethernet
-#define RX_BUFFER_SIZE 64
+// Buffer réception Serial (RX_BUFFER_SIZE dans network.h)
+// En mode Ethernet, chaque session a son propre buffer ligne
 char rxBuffer[RX_BUFFER_SIZE];
 int rxBufferIndex = 0;
 
@@ -42,9 +43,141 @@ IPAddress subnet(SUBNET_OCTET_1, SUBNET_OCTET_2, SUBNET_OCTET_3, SUBNET_OCTET_4)
 // Serveur Easycom (port 4533)
 EthernetServer server(EASYCOM_PORT);
 
-// Client courant
-EthernetClient currentClient;
-bool clientConnected = false;
+#if EASYCOM_MAX_CLIENTS > MAX_SOCK_NUM - 1
+    #error "EASYCOM_MAX_CLIENTS: 1 socket W5500 doit rester en écoute"
+#endif
+
+// ─────────────────────────────────────────────────────────────────
+// SESSIONS CLIENTS
+// ─────────────────────────────────────────────────────────────────
+// Chaque session a son anneau de réception (lecture SPI groupée)
+// et son buffer ligne (commande en cours d'assemblage).
+// Service en tourniquet: au plus une commande par session et par
+// passage, pour qu'un client bavard ne retarde pas PstRotator.
+
+#define SESSION_RING_SIZE  32   // Puissance de 2 (masque d'index)
+
+struct EasycomSession {
+    EthernetClient client;
+    bool active;
+    uint8_t ring[SESSION_RING_SIZE];
+    uint8_t ringHead;                   // Prochain octet écrit
+    uint8_t ringTail;                   // Prochain octet lu
+    char line[RX_BUFFER_SIZE];
+    int lineIndex;
+};
+
+static EasycomSession sessions[EASYCOM_MAX_CLIENTS];
+static uint8_t nextSessionTurn = 0;     // Première session servie au prochain passage
+
+// Destinataire de sendToClient() pendant le traitement d'une commande
+// (NULL = message spontané → toutes les sessions)
+static EasycomSession *replySession = NULL;
+
+#endif  // USE_ETHERNET
+
+// ════════════════════════════════════════════════════════════════
+// ASSEMBLAGE LIGNE (commun Serial / sessions Ethernet)
+// ════════════════════════════════════════════════════════════════
+
+static bool appendLineChar(char *line, int &index, char c) {
+    // Détection fin de commande (\r ou \n)
+    if (c == '\r' || c == '\n') {
+        if (index > 0) {
+            // Commande complète reçue
+            line[index] = '\0';
+            return true;
+        }
+    } else if (index < RX_BUFFER_SIZE - 1) {
+        // Ajouter caractère au buffer
+        line[index++] = c;
+    }
+    // Si buffer plein, ignorer caractères supplémentaires
+    return false;
+}
+
+#if USE_ETHERNET
+
+// ════════════════════════════════════════════════════════════════
+// GESTION SESSIONS (Ethernet uniquement)
+// ════════════════════════════════════════════════════════════════
+
+static void openSession(EthernetClient &newClient) {
+    for (uint8_t i = 0; i < EASYCOM_MAX_CLIENTS; i++) {
+        EasycomSession &session = sessions[i];
+        if (session.active) continue;
+
+        session.client = newClient;
+        session.active = true;
+        session.ringHead = 0;
+        session.ringTail = 0;
+        session.lineIndex = 0;
+
+        #if DEBUG_NETWORK
+            Serial.print(F("[NET] Client "));
+            Serial.print(i);
+            Serial.print(F(": "));
+            Serial.println(newClient.remoteIP());
+        #endif
+        return;
+    }
+
+    // Toutes les sessions occupées
+    newClient.stop();
+    #if DEBUG_NETWORK
+        Serial.println(F("[NET] Client rejeté (sessions pleines)"));
+    #endif
+}
+
+static void closeSession(EasycomSession &session) {
+    session.client.stop();
+    session.active = false;
+    session.lineIndex = 0;
+
+    #if DEBUG_NETWORK
+        Serial.print(F("[NET] Client "));
+        Serial.print((int)(&session - sessions));
+        Serial.println(F(" déconnecté"));
+    #endif
+}
+
+static void serviceSession(EasycomSession &session) {
+    // ─────────────────────────────────────────────────────────────
+    // 1. Remplissage anneau: une lecture groupée (zone contiguë)
+    // ─────────────────────────────────────────────────────────────
+    uint8_t used = (uint8_t)(session.ringHead - session.ringTail) & (SESSION_RING_SIZE - 1);
+    uint8_t space = (SESSION_RING_SIZE - 1) - used;
+    int pending = session.client.available();
+
+    if (pending > 0 && space > 0) {
+        uint8_t head = session.ringHead & (SESSION_RING_SIZE - 1);
+        uint8_t chunk = SESSION_RING_SIZE - head;   // Jusqu'à la fin de l'anneau
+        if (chunk > space) chunk = space;
+        if ((int)chunk > pending) chunk = (uint8_t)pending;
+
+        int got = session.client.read(&session.ring[head], chunk);
+        if (got > 0) session.ringHead = (uint8_t)(session.ringHead + got);
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // 2. Assemblage: au plus une commande exécutée par passage
+    // ─────────────────────────────────────────────────────────────
+    while (session.ringTail != session.ringHead) {
+        char c = (char)session.ring[session.ringTail & (SESSION_RING_SIZE - 1)];
+        session.ringTail++;
+
+        if (appendLineChar(session.line, session.lineIndex, c)) {
+            lastCommandTime = millis();
+
+            replySession = &session;
+            parseEasycomCommand(session.line);
+            replySession = NULL;
+
+            session.lineIndex = 0;
+            return;
+        }
+    }
+}
 
 #endif  // USE_ETHERNET
 
@@ -89,8 +222,9 @@ bool setupNetwork() {
             #endif
         }
 
-        // Démarrage serveur TCP
+        // Démarrage serveurs TCP (Easycom + télémétrie push)
         server.begin();
+        setupTelemetry();
         networkInitialized = true;
 
         #if DEBUG_SERIAL
@@ -138,37 +272,28 @@ void handleNetwork() {
         // MODE ETHERNET
         // ─────────────────────────────────────────────────────────────
 
-        // Écoute nouvelles connexions
-        EthernetClient newClient = server.available();
-        if (newClient) {
-            if (!clientConnected) {
-                currentClient = newClient;
-                clientConnected = true;
-                rxBufferIndex = 0;
-
-                #if DEBUG_NETWORK
-                    Serial.print(F("[NET] Client: "));
-                    Serial.println(currentClient.remoteIP());
-                #endif
-            } else if (newClient != currentClient) {
-                newClient.stop();
-                #if DEBUG_NETWORK
-                    Serial.println(F("[NET] Client rejeté"));
-                #endif
-            }
+        // Nouvelles connexions (accept: chaque client renvoyé une seule fois)
+        EthernetClient newClient = server.accept();
+        while (newClient) {
+            openSession(newClient);
+            newClient = server.accept();
         }
 
-        // Lecture données client
-        if (clientConnected) {
-            if (currentClient.connected()) {
-                while (currentClient.available() > 0) {
-                    char c = currentClient.read();
-                    processReceivedChar(c);
-                }
+        // Service en tourniquet, départ décalé à chaque passage
+        for (uint8_t k = 0; k < EASYCOM_MAX_CLIENTS; k++) {
+            EasycomSession &session = sessions[(nextSessionTurn + k) % EASYCOM_MAX_CLIENTS];
+            if (!session.active) continue;
+
+            if (session.client.connected()) {
+                serviceSession(session);
             } else {
-                disconnectClient();
+                closeSession(session);
             }
         }
+        nextSessionTurn = (nextSessionTurn + 1) % EASYCOM_MAX_CLIENTS;
+
+        // Abonnés télémétrie (après les commandes: cibles à jour)
+        handleTelemetry();
 
     #else
         // ─────────────────────────────────────────────────────────────
@@ -188,27 +313,16 @@ void handleNetwork() {
 // ════════════════════════════════════════════════════════════════
 
 void processReceivedChar(char c) {
-    // Détection fin de commande (\r ou \n)
-    if (c == '\r' || c == '\n') {
-        if (rxBufferIndex > 0) {
-            // Commande complète reçue
-            rxBuffer[rxBufferIndex] = '\0';
-            String command = String(rxBuffer);
-
-            // Mettre à jour timestamp dernière commande (pour timeout)
-            lastCommandTime = millis();
+    if (appendLineChar(rxBuffer, rxBufferIndex, c)) {
+        // Mettre à jour timestamp dernière commande (pour timeout)
+        lastCommandTime = millis();
 
-            // Parser commande Easycom
-            parseEasycomCommand(command);
+        // Parser commande Easycom (sur place, sans copie String)
+        parseEasycomCommand(rxBuffer);
 
-            // Reset buffer
-            rxBufferIndex = 0;
-        }
-    } else if (rxBufferIndex < RX_BUFFER_SIZE - 1) {
-        // Ajouter caractère au buffer
-        rxBuffer[rxBufferIndex++] = c;
+        // Reset buffer
+        rxBufferIndex = 0;
     }
-    // Si buffer plein, ignorer caractères supplémentaires
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -217,8 +331,19 @@ void processReceivedChar(char c) {
 
 void sendToClient(const char* message) {
     #if USE_ETHERNET
-        if (clientConnected && currentClient.connected()) {
-            currentClient.print(message);
+        if (replySession != NULL) {
+            // Réponse à la session qui a envoyé la commande
+            if (replySession->client.connected()) {
+                replySession->client.print(message);
+            }
+            return;
+        }
+
+        // Message spontané (ex: STOP Nextion): toutes les sessions
+        for (uint8_t i = 0; i < EASYCOM_MAX_CLIENTS; i++) {
+            if (sessions[i].active && sessions[i].client.connected()) {
+                sessions[i].client.print(message);
+            }
         }
     #else
         Serial.print(message);
@@ -235,7 +360,7 @@ void sendToClient(String message) {
 
 bool isClientConnected() {
     #if USE_ETHERNET
-        return clientConnected && currentClient.connected();
+        return getClientCount() > 0;
     #else
         // Mode Serial: connecté si commande reçue dans les dernières 5 secondes
         // lastCommandTime=0 au démarrage → considéré déconnecté jusqu'à première commande
@@ -244,20 +369,28 @@ bool isClientConnected() {
     #endif
 }
 
+uint8_t getClientCount() {
+    #if USE_ETHERNET
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < EASYCOM_MAX_CLIENTS; i++) {
+            if (sessions[i].active && sessions[i].client.connected()) count++;
+        }
+        return count;
+    #else
+        return isClientConnected() ? 1 : 0;
+    #endif
+}
+
 // ════════════════════════════════════════════════════════════════
-// DÉCONNEXION CLIENT (Ethernet uniquement)
+// DÉCONNEXION CLIENTS (Ethernet uniquement)
 // ════════════════════════════════════════════════════════════════
 
 void disconnectClient() {
     #if USE_ETHERNET
-        if (clientConnected) {
-            currentClient.stop();
-            clientConnected = false;
-            rxBufferIndex = 0;
-
-            #if DEBUG_NETWORK
-                Serial.println(F("[NET] Déconnecté"));
-            #endif
+        for (uint8_t i = 0; i < EASYCOM_MAX_CLIENTS; i++) {
+            if (sessions[i].active) {
+                closeSession(sessions[i]);
+            }
         }
     #endif
 }
@@ -292,8 +425,10 @@ void printNetworkDebug() {
         Serial.print(Ethernet.localIP());
         Serial.print(F(" Port: "));
         Serial.print(EASYCOM_PORT);
-        Serial.print(F(" Client: "));
-        Serial.println(clientConnected ? F("OUI") : F("NON"));
+        Serial.print(F(" Clients: "));
+        Serial.print(getClientCount());
+        Serial.print(F("/"));
+        Serial.println(EASYCOM_MAX_CLIENTS);
     #else
         Serial.print(F("[COM] Serial USB @ "));
         Serial.print(SERIAL_BAUD);
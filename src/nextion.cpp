@@ -23,8 +23,10 @@
 // VARIABLES EXTERNES
 // ════════════════════════════════════════════════════════════════
 
-extern float currentAz;  // Position actuelle azimuth
+extern float currentAz;  // Position actuelle azimuth (miroir float, debug)
 extern float currentEl;  // Position actuelle élévation
+extern angle_t currentAzMdeg;  // Position actuelle (millidegrés, affichage)
+extern angle_t currentElMdeg;
 extern float targetAz;   // Position cible azimuth (NO_TARGET si aucune)
 extern float targetEl;   // Position cible élévation (NO_TARGET si aucune)
 
@@ -191,6 +193,16 @@ void setupNextion() {
 // MISE À JOUR AFFICHAGE (Appelé dans loop)
 // ════════════════════════════════════════════════════════════════
 
+/**
+ * Position millidegrés → "123.5" sans flottant (formatTenths, easycom.h)
+ */
+static void appendPositionText(String &cmd, angle_t mdeg) {
+    char text[12];
+    char *end = formatTenths(text, mdegToTenths(mdeg));
+    *end = '\0';
+    cmd += text;
+}
+
 void updateNextion() {
     // ─────────────────────────────────────────────────────────────
     // THROTTLING (ne pas saturer le Nextion)
@@ -205,7 +217,7 @@ void updateNextion() {
     // AZIMUTH - Position actuelle
     // ─────────────────────────────────────────────────────────────
     String cmd = "tAzCur.txt=\"";
-    cmd += String(currentAz, 1);  // 1 décimale (ex: "123.5")
+    appendPositionText(cmd, currentAzMdeg);  // 1 décimale (ex: "123.5")
     cmd += "°\"";
     sendToNextion(cmd);
 
@@ -238,9 +250,10 @@ void updateNextion() {
     // ─────────────────────────────────────────────────────────────
     // ÉLÉVATION - Position actuelle (avec offset parabole si activé)
     // ─────────────────────────────────────────────────────────────
-    float displayEl = elOffsetEnabled ? (currentEl + elDisplayOffset) : currentEl;
+    angle_t displayEl = currentElMdeg;
+    if (elOffsetEnabled) displayEl += angleFromDegrees(elDisplayOffset);
     cmd = "tElCur.txt=\"";
-    cmd += String(displayEl, 1);
+    appendPositionText(cmd, displayEl);
     cmd += "°\"";
     sendToNextion(cmd);
 
@@ -773,7 +786,8 @@ void handleNextionButtons() {
         #if USE_NANO_STEPPER
             sendManualMove(0, 0);
         #else
-            parseEasycomCommand("SA");
+            char stopCmd[] = "SA";
+            parseEasycomCommand(stopCmd);
         #endif
         manualMoving = false;
         return;
@@ -827,13 +841,17 @@ void handleNextionButtons() {
                 float newTarget = currentAz + (dirAz * MANUAL_INCREMENT_AZ);
                 if (newTarget >= 360.0) newTarget -= 360.0;
                 if (newTarget < 0.0) newTarget += 360.0;
-                parseEasycomCommand("AZ" + String(newTarget, 1));
+                char cmd[16] = "AZ";
+                dtostrf(newTarget, 1, 1, cmd + 2);
+                parseEasycomCommand(cmd);
             } else if (dirEl != 0) {
                 float newTarget = currentEl + (dirEl * MANUAL_INCREMENT_EL);
                 // Limites élévation: -15° (parabole offset) à +95°
                 if (newTarget > 95.0) newTarget = 95.0;
                 if (newTarget < -15.0) newTarget = -15.0;
-                parseEasycomCommand("EL" + String(newTarget, 1));
+                char cmd[16] = "EL";
+                dtostrf(newTarget, 1, 1, cmd + 2);
+                parseEasycomCommand(cmd);
             }
         #endif
         manualMoving = true;
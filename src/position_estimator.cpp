@@ -0,0 +1,67 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Estimateur position / vitesse (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: position_estimator.cpp
+// Description: Filtre alpha-beta en virgule fixe
+// ════════════════════════════════════════════════════════════════
+
+#include "position_estimator.h"
+
+// ════════════════════════════════════════════════════════════════
+// GAINS
+// ════════════════════════════════════════════════════════════════
+
+// α en Q8
+#define EST_ALPHA_MOVING_Q8  ((long)(ESTIMATOR_ALPHA_MOVING * 256.0 + 0.5))
+#define EST_ALPHA_HOLD_Q8    ((long)(ESTIMATOR_ALPHA_HOLD * 256.0 + 0.5))
+
+// β / dt nominal: résidu (mdeg Q8) → incrément vitesse (mdeg/ms Q16)
+//   Δv = r × β / dt × 2^(16 - 8), appliqué comme (r × K) >> 8
+#define EST_BETA_K           ((long)(ESTIMATOR_BETA_MOVING * 65536.0 / ENCODER_READ_INTERVAL + 0.5))
+
+#define EST_JUMP_Q8          ((long)ANGLE_DEG(ESTIMATOR_JUMP_DEG) << ESTIMATOR_POS_SHIFT)
+#define EST_MAX_DT_MS        100    // Lecture manquée: prédiction bornée
+
+// Produits sur 32 bits: résidu borné par EST_JUMP_Q8
+static_assert((double)EST_JUMP_Q8 * EST_BETA_K < 2147483647.0 &&
+              (double)EST_JUMP_Q8 * 256.0 < 2147483647.0,
+              "position_estimator: ESTIMATOR_JUMP_DEG trop grand pour 32 bits");
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+void estimatorReset(PositionEstimator &est, angle_t position) {
+    est.position = position * (1L << ESTIMATOR_POS_SHIFT);
+    est.velocity = 0;
+    est.initialized = true;
+}
+
+angle_t estimatorUpdate(PositionEstimator &est, angle_t measured, unsigned long dtMs, bool commanded) {
+    if (!est.initialized) {
+        estimatorReset(est, measured);
+        return measured;
+    }
+
+    // Prédiction: vitesse Q16 × ms → Q8
+    long dt = (long)min(dtMs, (unsigned long)EST_MAX_DT_MS);
+    est.position += (est.velocity * dt) >> (ESTIMATOR_VEL_SHIFT - ESTIMATOR_POS_SHIFT);
+
+    long residual = measured * (1L << ESTIMATOR_POS_SHIFT) - est.position;
+    if (labs(residual) > EST_JUMP_Q8) {
+        // Saut de mesure: la prédiction n'a plus de sens
+        estimatorReset(est, measured);
+        return measured;
+    }
+
+    if (commanded) {
+        est.position += (residual * EST_ALPHA_MOVING_Q8) >> 8;
+        est.velocity += (residual * EST_BETA_K) >> 8;
+    } else {
+        // Moteur arrêté: lissage seul, vitesse amortie (÷2 en ~50 ms)
+        est.position += (residual * EST_ALPHA_HOLD_Q8) >> 8;
+        est.velocity -= est.velocity >> 2;
+    }
+
+    return estimatorPosition(est);
+}
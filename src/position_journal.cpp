@@ -0,0 +1,284 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Journal EEPROM position (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: position_journal.cpp
+// Description: Anneau d'enregistrements séquencés, CRC-16, écriture
+//              octet par octet sans attente
+// ════════════════════════════════════════════════════════════════
+
+#include "position_journal.h"
+#include <EEPROM.h>
+#include <string.h>
+
+#if defined(__AVR__)
+  #include <avr/eeprom.h>
+#endif
+
+#if EEPROM_JOURNAL_START + EEPROM_JOURNAL_SLOTS * JOURNAL_RECORD_SIZE > E2END + 1
+  #error "EEPROM_JOURNAL_SLOTS: journal au-delà de la fin de l'EEPROM"
+#endif
+
+// Position des champs dans une case
+#define REC_SEQ   0
+#define REC_AZ    2
+#define REC_EL    6
+#define REC_CRC   10
+
+// ════════════════════════════════════════════════════════════════
+// VARIABLES
+// ════════════════════════════════════════════════════════════════
+
+static JournalStats stats = {0, 0, 0, JOURNAL_SEQ_ERASED, 0, false};
+static bool hasRecord = false;          // stats.slot/sequence valides
+
+// Enregistrement en cours d'écriture
+static uint8_t txRecord[JOURNAL_RECORD_SIZE];
+static uint8_t txIndex = 0;
+
+// Demande en attente (écriture en cours)
+static bool pending = false;
+static long pendingAz = 0;
+static long pendingEl = 0;
+
+// Valeurs que l'EEPROM contiendra une fois tout écrit
+static bool queuedValid = false;
+static long queuedAz = 0;
+static long queuedEl = 0;
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS INTERNES
+// ════════════════════════════════════════════════════════════════
+
+static uint16_t crc16(const uint8_t *data, uint8_t len) {
+    // CRC-16/CCITT (polynôme 0x1021, init 0xFFFF)
+    uint16_t crc = 0xFFFF;
+    while (len--) {
+        crc ^= (uint16_t)(*data++) << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static int slotAddress(uint16_t slot) {
+    return EEPROM_JOURNAL_START + slot * JOURNAL_RECORD_SIZE;
+}
+
+// Champs petit-boutiste, indépendants de la taille de long (HAL native)
+static void packU16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void packI32(uint8_t *p, long v) {
+    uint32_t u = (uint32_t)v;
+    for (uint8_t i = 0; i < 4; i++) p[i] = (uint8_t)(u >> (8 * i));
+}
+
+static uint16_t unpackU16(const uint8_t *p) {
+    return (uint16_t)(p[0] | ((uint16_t)p[1] << 8));
+}
+
+static long unpackI32(const uint8_t *p) {
+    uint32_t u = 0;
+    for (uint8_t i = 0; i < 4; i++) u |= (uint32_t)p[i] << (8 * i);
+    return (long)(int32_t)u;
+}
+
+static uint16_t readSequence(uint16_t slot) {
+    int addr = slotAddress(slot);
+    return (uint16_t)(EEPROM.read(addr) | ((uint16_t)EEPROM.read(addr + 1) << 8));
+}
+
+static bool eepromReady() {
+    #if defined(__AVR__)
+        return eeprom_is_ready();
+    #else
+        return true;
+    #endif
+}
+
+static void packRecord(uint16_t seq) {
+    packU16(&txRecord[REC_SEQ], seq);
+    packI32(&txRecord[REC_AZ], pendingAz);
+    packI32(&txRecord[REC_EL], pendingEl);
+    packU16(&txRecord[REC_CRC], crc16(txRecord, REC_CRC));
+    pending = false;
+    txIndex = 0;
+}
+
+static void startRecord() {
+    uint16_t seq = hasRecord ? (uint16_t)(stats.sequence + 1) : 0;
+    if (seq == JOURNAL_SEQ_ERASED) seq = 0;
+    uint16_t slot = hasRecord ? (uint16_t)((stats.slot + 1) % EEPROM_JOURNAL_SLOTS) : 0;
+
+    packRecord(seq);
+    stats.slot = slot;
+    stats.sequence = seq;
+    stats.busy = true;
+    hasRecord = true;
+}
+
+// Dernier enregistrement valide (sans toucher à l'état d'écriture)
+static bool findLatest(uint8_t *rec, uint16_t &slotOut, uint16_t &rejected) {
+    // Plus récente séquence (modulo 2^16), lecture de 2 octets par case
+    int16_t best = -1;
+    uint16_t bestSeq = 0;
+    for (uint16_t slot = 0; slot < EEPROM_JOURNAL_SLOTS; slot++) {
+        uint16_t seq = readSequence(slot);
+        if (seq == JOURNAL_SEQ_ERASED) continue;
+        if (best < 0 || (int16_t)(seq - bestSeq) > 0) {
+            best = (int16_t)slot;
+            bestSeq = seq;
+        }
+    }
+    rejected = 0;
+    if (best < 0) return false;     // Journal vierge
+
+    // Vérification CRC, en reculant dans l'anneau si la case est coupée
+    for (uint16_t back = 0; back < EEPROM_JOURNAL_SLOTS; back++) {
+        uint16_t slot = (uint16_t)((best + EEPROM_JOURNAL_SLOTS - back) % EEPROM_JOURNAL_SLOTS);
+        int addr = slotAddress(slot);
+        for (uint8_t i = 0; i < JOURNAL_RECORD_SIZE; i++) rec[i] = EEPROM.read(addr + i);
+
+        if (unpackU16(&rec[REC_SEQ]) == JOURNAL_SEQ_ERASED ||
+            crc16(rec, REC_CRC) != unpackU16(&rec[REC_CRC])) {
+            rejected++;
+            continue;
+        }
+        slotOut = slot;
+        return true;
+    }
+    return false;                   // Aucune case valide
+}
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+bool journalRecover(long &az, long &el) {
+    // État repris de zéro (écriture interrompue abandonnée)
+    memset(&stats, 0, sizeof(stats));
+    stats.sequence = JOURNAL_SEQ_ERASED;
+    hasRecord = false;
+    pending = false;
+    queuedValid = false;
+
+    uint8_t rec[JOURNAL_RECORD_SIZE];
+    uint16_t slot = 0;
+    if (!findLatest(rec, slot, stats.rejected)) return false;
+
+    az = unpackI32(&rec[REC_AZ]);
+    el = unpackI32(&rec[REC_EL]);
+
+    // Prochain enregistrement juste après: les cases coupées
+    // sont réécrites en premier
+    stats.slot = slot;
+    stats.sequence = unpackU16(&rec[REC_SEQ]);
+    hasRecord = true;
+    queuedAz = az;
+    queuedEl = el;
+    queuedValid = true;
+
+    #if DEBUG_SERIAL
+        Serial.print(F("Journal EEPROM: case "));
+        Serial.print(slot);
+        Serial.print(F(" séquence "));
+        Serial.print(stats.sequence);
+        if (stats.rejected > 0) {
+            Serial.print(F(" ("));
+            Serial.print(stats.rejected);
+            Serial.print(F(" case(s) invalide(s) ignorée(s))"));
+        }
+        Serial.println();
+    #endif
+    return true;
+}
+
+bool journalReadLatest(long &az, long &el) {
+    uint8_t rec[JOURNAL_RECORD_SIZE];
+    uint16_t slot, rejected;
+    if (!findLatest(rec, slot, rejected)) return false;
+    az = unpackI32(&rec[REC_AZ]);
+    el = unpackI32(&rec[REC_EL]);
+    return true;
+}
+
+void journalWrite(long az, long el) {
+    if (queuedValid && az == queuedAz && el == queuedEl) {
+        stats.skipped++;
+        return;
+    }
+    pendingAz = az;
+    pendingEl = el;
+    pending = true;
+    queuedAz = az;
+    queuedEl = el;
+    queuedValid = true;
+}
+
+void journalWriteIfMoved(long az, long el, long deadbandAz, long deadbandEl) {
+    if (queuedValid && labs(az - queuedAz) <= deadbandAz && labs(el - queuedEl) <= deadbandEl) {
+        stats.skipped++;
+        return;
+    }
+    journalWrite(az, el);
+}
+
+void journalWriteNow(long az, long el) {
+    if (!stats.busy && !pending && queuedValid && az == queuedAz && el == queuedEl) {
+        stats.skipped++;
+        return;                     // EEPROM déjà à jour
+    }
+    pendingAz = az;
+    pendingEl = el;
+    queuedAz = az;
+    queuedEl = el;
+    queuedValid = true;
+
+    if (stats.busy) {
+        // Même case, même séquence: reprise au premier octet, les
+        // octets déjà écrits et identiques sont sautés
+        packRecord(stats.sequence);
+    } else {
+        pending = true;
+    }
+    journalFlush();
+}
+
+void journalService() {
+    if (!stats.busy) {
+        if (!pending) return;
+        startRecord();
+    }
+    if (!eepromReady()) return;
+
+    // Au plus une écriture effective; octets identiques sautés
+    // (CRC en dernier: case coupée → CRC faux)
+    int addr = slotAddress(stats.slot);
+    while (txIndex < JOURNAL_RECORD_SIZE) {
+        uint8_t b = txRecord[txIndex];
+        int cell = addr + txIndex;
+        txIndex++;
+        if (EEPROM.read(cell) != b) {
+            EEPROM.write(cell, b);
+            break;
+        }
+    }
+
+    if (txIndex >= JOURNAL_RECORD_SIZE) {
+        stats.busy = false;
+        stats.writes++;
+    }
+}
+
+void journalFlush() {
+    while (stats.busy || pending) {
+        journalService();
+    }
+}
+
+const JournalStats &journalGetStats() {
+    return stats;
+}
@@ -0,0 +1,152 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Surveillance alimentation (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: power_monitor.cpp
+// Description: Seuils sur le canal ADC_CH_SUPPLY, arrêt moteurs et
+//              sauvegarde d'urgence de la position
+// ════════════════════════════════════════════════════════════════
+
+#include "power_monitor.h"
+
+#if POWER_MONITOR_ACTIVE
+
+#include "adc_sampler.h"
+#include "encoder_ssi.h"
+
+#if TEST_MOTORS
+  #if USE_NANO_STEPPER
+    #include "motor_nano.h"
+  #elif (MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER)
+    #include "motor_stepper.h"
+  #endif
+  #if (MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED || MOTOR_EL_TYPE == MOTOR_DC_BRUSHED)
+    #include "motor_dc.h"
+  #endif
+#endif
+
+// Seuils convertis une fois pour toutes en pas ADC fins (comparaison
+// entière dans loop(), pas de float)
+#define VOLTS_TO_FINE(v)  ((uint16_t)((v) / POWER_SENSE_RATIO / 5.0 * 1024.0 * (1 << POT_FINE_BITS)))
+#define FAIL_FINE         VOLTS_TO_FINE(POWER_FAIL_V)
+#define RESTORE_FINE      VOLTS_TO_FINE(POWER_RESTORE_V)
+
+// ════════════════════════════════════════════════════════════════
+// VARIABLES
+// ════════════════════════════════════════════════════════════════
+
+static uint8_t state = POWER_STATE_DISARMED;
+static unsigned long restoreSince = 0;
+static bool restoring = false;
+static unsigned int failCount = 0;
+
+// ════════════════════════════════════════════════════════════════
+// SAUVEGARDE D'URGENCE
+// ════════════════════════════════════════════════════════════════
+
+static void lastGasp() {
+    // Moteurs d'abord: leur courant vide la réserve des condensateurs
+    #if TEST_MOTORS
+        #if USE_NANO_STEPPER
+            stopAllMotorsNano();
+        #elif (MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER)
+            stopAllMotors();
+        #endif
+        #if (MOTOR_AZ_TYPE == MOTOR_DC_BRUSHED || MOTOR_EL_TYPE == MOTOR_DC_BRUSHED)
+            stopAllMotorsDC();
+        #endif
+    #endif
+
+    saveCalibrationToEEPROM();
+}
+
+// ════════════════════════════════════════════════════════════════
+// INITIALISATION
+// ════════════════════════════════════════════════════════════════
+
+void setupPowerMonitor() {
+    state = POWER_STATE_DISARMED;
+    restoring = false;
+    updatePowerMonitor();
+
+    #if DEBUG_SERIAL
+        Serial.print(F("Alimentation: "));
+        Serial.print(powerSupplyVolts(), 1);
+        Serial.print(F(" V, coupure < "));
+        Serial.print(POWER_FAIL_V, 1);
+        Serial.println(state == POWER_STATE_ARMED ? F(" V (armée)") : F(" V (non armée: USB seul ?)"));
+    #endif
+}
+
+// ════════════════════════════════════════════════════════════════
+// SURVEILLANCE
+// ════════════════════════════════════════════════════════════════
+
+bool updatePowerMonitor() {
+    uint16_t fine = adcSamplerRead(ADC_CH_SUPPLY);
+
+    switch (state) {
+        case POWER_STATE_DISARMED:
+            if (fine >= RESTORE_FINE) state = POWER_STATE_ARMED;
+            return false;
+
+        case POWER_STATE_ARMED:
+            if (fine >= FAIL_FINE) return false;
+            lastGasp();
+            state = POWER_STATE_FAILED;
+            restoring = false;
+            failCount++;
+            #if DEBUG_SERIAL
+                Serial.print(F("!!! COUPURE ALIMENTATION ("));
+                Serial.print(powerSupplyVolts(), 1);
+                Serial.println(F(" V): moteurs arrêtés, position sauvée"));
+            #endif
+            return true;
+
+        default:
+            // Micro-coupure tenue: reprise après POWER_RESTORE_MS stables
+            if (fine < RESTORE_FINE) {
+                restoring = false;
+                return true;
+            }
+            if (!restoring) {
+                restoring = true;
+                restoreSince = millis();
+            }
+            if (millis() - restoreSince < POWER_RESTORE_MS) return true;
+            state = POWER_STATE_ARMED;
+            #if DEBUG_SERIAL
+                Serial.println(F("Alimentation rétablie, reprise"));
+            #endif
+            return false;
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// ACCESSEURS
+// ════════════════════════════════════════════════════════════════
+
+float powerSupplyVolts() {
+    return adcSamplerRead(ADC_CH_SUPPLY) * (5.0 * POWER_SENSE_RATIO / 1024.0 / (1 << POT_FINE_BITS));
+}
+
+uint8_t powerMonitorState() {
+    return state;
+}
+
+unsigned int powerFailCount() {
+    return failCount;
+}
+
+#else
+
+// ════════════════════════════════════════════════════════════════
+// STUBS (surveillance désactivée)
+// ════════════════════════════════════════════════════════════════
+
+void setupPowerMonitor() {}
+bool updatePowerMonitor() { return false; }
+float powerSupplyVolts() { return 0.0; }
+uint8_t powerMonitorState() { return POWER_STATE_DISARMED; }
+unsigned int powerFailCount() { return 0; }
+
+#endif // POWER_MONITOR_ACTIVE
@@ -0,0 +1,149 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Profileur boucle principale (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: profiler.cpp
+// Description: Histogrammes log2 des durées d'étapes de loop()
+// ════════════════════════════════════════════════════════════════
+
+#include "profiler.h"
+
+#if ENABLE_PROFILER
+
+#include "network.h"        // Pour sendToClient
+
+// ════════════════════════════════════════════════════════════════
+// STATISTIQUES PAR ÉTAPE
+// ════════════════════════════════════════════════════════════════
+
+struct ProfilerStats {
+    uint16_t hist[PROF_BUCKETS];    // Comptages par bucket log2
+    uint32_t count;                 // Nombre total d'échantillons
+    uint32_t minUs;
+    uint32_t maxUs;
+};
+
+static ProfilerStats profStats[PROF_STAGE_COUNT];
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS INTERNES
+// ════════════════════════════════════════════════════════════════
+
+static uint8_t bucketOf(unsigned long us) {
+    // Nombre de bits significatifs: 0 → 0, 1 → 1, 2-3 → 2, 4-7 → 3, ...
+    uint8_t b = 0;
+    while (us != 0 && b < PROF_BUCKETS - 1) {
+        us >>= 1;
+        b++;
+    }
+    return b;
+}
+
+static unsigned long bucketUpperUs(uint8_t b) {
+    // Borne haute incluse du bucket b
+    return (b == 0) ? 0UL : ((1UL << b) - 1UL);
+}
+
+static const __FlashStringHelper *stageName(uint8_t stage) {
+    switch (stage) {
+        case PROF_ENCODERS:        return F("ENCODEURS ");
+        case PROF_BUTTONS:         return F("BOUTONS   ");
+        case PROF_LIMITS:          return F("FINS_COUR ");
+        case PROF_MOTORS:          return F("MOTEURS   ");
+        case PROF_NETWORK:         return F("RESEAU    ");
+        case PROF_NEXTION_TOUCH:   return F("NX_TOUCH  ");
+        case PROF_NEXTION_CALIB:   return F("NX_CALIB  ");
+        case PROF_NEXTION_BUTTONS: return F("NX_BOUTONS");
+        case PROF_NEXTION_UPDATE:  return F("NX_AFFICH ");
+        case PROF_NEXTION_INDIC:   return F("NX_INDIC  ");
+        case PROF_LOOP:            return F("BOUCLE    ");
+        case PROF_RESPONSE:        return F("REPONSE   ");
+        default:                   return F("?         ");
+    }
+}
+
+static unsigned long percentile99(const ProfilerStats &s) {
+    // Premier bucket où le cumul atteint 99% des échantillons
+    // (total ≤ 16 × 65535: total × 99 tient dans 32 bits)
+    uint32_t total = 0;
+    for (uint8_t b = 0; b < PROF_BUCKETS; b++) total += s.hist[b];
+    if (total == 0) return 0;
+
+    uint32_t cumul = 0;
+    for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+        cumul += s.hist[b];
+        if (cumul * 100UL >= total * 99UL) {
+            unsigned long upper = bucketUpperUs(b);
+            // Dernier bucket ouvert, ou borne au-delà du max observé
+            if (b == PROF_BUCKETS - 1 || upper > s.maxUs) upper = s.maxUs;
+            return upper;
+        }
+    }
+    return s.maxUs;
+}
+
+static String padRight(unsigned long value, uint8_t width) {
+    String str = String(value);
+    while (str.length() < width) str += " ";
+    return str;
+}
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+unsigned long profilerRecord(uint8_t stage, unsigned long startUs) {
+    unsigned long now = micros();
+    unsigned long dt = now - startUs;   // Correct même après débordement micros()
+
+    ProfilerStats &s = profStats[stage];
+    uint8_t b = bucketOf(dt);
+
+    if (s.hist[b] == 0xFFFF) {
+        // Saturation: division par 2 de tout l'histogramme de l'étape
+        // (arrondi supérieur: un bucket rare, ex. pic max, ne disparaît pas)
+        for (uint8_t i = 0; i < PROF_BUCKETS; i++) s.hist[i] = (s.hist[i] + 1U) >> 1;
+    }
+    s.hist[b]++;
+
+    if (s.count == 0 || dt < s.minUs) s.minUs = dt;
+    if (dt > s.maxUs) s.maxUs = dt;
+    s.count++;
+
+    return now;
+}
+
+void profilerReset() {
+    memset(profStats, 0, sizeof(profStats));
+}
+
+void printProfilerReport() {
+    sendToClient("\r\n");
+    sendToClient("=== PROFIL BOUCLE (us) ===\r\n");
+    sendToClient("Etape      n         min     max     p99<=\r\n");
+
+    for (uint8_t stage = 0; stage < PROF_STAGE_COUNT; stage++) {
+        const ProfilerStats &s = profStats[stage];
+        if (s.count == 0) continue;     // Étape non compilée ou jamais exécutée
+
+        String line = String(stageName(stage)) + " ";
+        line += padRight(s.count, 10);
+        line += padRight(s.minUs, 8);
+        line += padRight(s.maxUs, 8);
+        line += String(percentile99(s));
+        line += "\r\n";
+        sendToClient(line);
+
+        // Histogramme: "<borne haute>:<comptage>" pour chaque bucket non vide
+        String hist = "  ";
+        for (uint8_t b = 0; b < PROF_BUCKETS; b++) {
+            if (s.hist[b] == 0) continue;
+            if (b == PROF_BUCKETS - 1) hist += ">";
+            hist += String(b == PROF_BUCKETS - 1 ? bucketUpperUs(b - 1) : bucketUpperUs(b));
+            hist += ":" + String(s.hist[b]) + " ";
+        }
+        hist += "\r\n";
+        sendToClient(hist);
+    }
+}
+
+#endif // ENABLE_PROFILER
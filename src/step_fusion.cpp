@@ -0,0 +1,115 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Fusion pas commandés / encodeur (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: step_fusion.cpp
+// Description: Décalage figé en rampe, recalé en régime établi
+// ════════════════════════════════════════════════════════════════
+
+#include "step_fusion.h"
+
+#if ENABLE_STEP_FUSION
+
+#define FUSION_OFFSET_SHIFT  8
+
+// Millidegrés antenne par pas moteur (Q16)
+#define FUSION_STEP_SCALE_AZ  ANGLE_SCALE_Q16(360000.0 / (STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_AZ))
+#define FUSION_STEP_SCALE_EL  ANGLE_SCALE_Q16(360000.0 / (STEPS_PER_REV_MOTOR * MOTOR_GEAR_RATIO_EL))
+
+#define FUSION_RESYNC_MDEG    ANGLE_DEG(FUSION_RESYNC_DEG)
+
+static bool axisLocked[2] = { false, false };
+
+void fusionReset(StepFusion &f) {
+    f.offset = 0;
+    f.rate = 0;
+    f.steadyMs = 0;
+    f.residualSum = 0;
+    f.windowMs = 0;
+    f.initialized = false;
+}
+
+angle_t fusionUpdate(StepFusion &f, uint8_t axis, angle_t encoder, unsigned long dtMs) {
+    long steps = 0;
+    long rate = 0;
+    bool counted = commandedSteps(axis, steps, rate);
+    angle_t stepAngle = angleScale(steps, (axis == FUSION_AZ) ? FUSION_STEP_SCALE_AZ : FUSION_STEP_SCALE_EL);
+
+    // Pas inconnus: encodeur seul, décalage réancré à chaque lecture
+    if (!counted || !f.initialized) {
+        f.offset = (long)(encoder - stepAngle) << FUSION_OFFSET_SHIFT;
+        f.rate = rate;
+        f.steadyMs = 0;
+        f.residualSum = 0;
+        f.windowMs = 0;
+        f.initialized = true;
+        axisLocked[axis] = counted;
+        return encoder;
+    }
+    axisLocked[axis] = true;
+
+    angle_t fused = stepAngle + (angle_t)(f.offset >> FUSION_OFFSET_SHIFT);
+
+    // Vitesse variable: pas seuls (l'encodeur filtré est en retard),
+    // puis attendre que le filtre pot rejoigne l'antenne
+    if (rate != f.rate) {
+        f.rate = rate;
+        f.steadyMs = 0;
+        f.residualSum = 0;
+        f.windowMs = 0;
+        return fused;
+    }
+    if (f.steadyMs < FUSION_SETTLE_MS) {
+        f.steadyMs += dtMs;
+        return fused;
+    }
+
+    angle_t residual = encoder - fused;
+    if (rate == 0) {
+        if (labs(residual) > FUSION_RESYNC_MDEG) {
+            // Pas perdus / blocage: recalage immédiat
+            f.offset = (long)(encoder - stepAngle) << FUSION_OFFSET_SHIFT;
+            f.residualSum = 0;
+            f.windowMs = 0;
+            return encoder;
+        }
+
+        // Arrêt: résidu moyenné puis appliqué d'un bloc. Un recalage
+        // progressif ferait repartir le moteur à chaque franchissement
+        // de FUSION_RESTART (jeu de 0.1° → plusieurs retouches)
+        f.residualSum += residual * (long)dtMs;
+        f.windowMs += dtMs;
+        if (f.windowMs >= FUSION_AVERAGE_MS) {
+            f.offset += (f.residualSum << FUSION_OFFSET_SHIFT) / (long)f.windowMs;
+            f.residualSum = 0;
+            f.windowMs = 0;
+        }
+        return stepAngle + (angle_t)(f.offset >> FUSION_OFFSET_SHIFT);
+    }
+
+    // Palier: dérive lente: décalage += résidu × dt / τ
+    residual = constrain(residual, -FUSION_RESYNC_MDEG, FUSION_RESYNC_MDEG);
+    f.offset += ((long)residual << FUSION_OFFSET_SHIFT) * (long)min(dtMs, 100UL) / FUSION_TAU_MS;
+    return stepAngle + (angle_t)(f.offset >> FUSION_OFFSET_SHIFT);
+}
+
+bool fusionLocked(uint8_t axis) {
+    if (axis > FUSION_EL) return false;
+    return axisLocked[axis];
+}
+
+#else
+
+// ════════════════════════════════════════════════════════════════
+// STUBS (encodeur seul)
+// ════════════════════════════════════════════════════════════════
+
+void fusionReset(StepFusion &f) { f.initialized = false; }
+
+angle_t fusionUpdate(StepFusion &f, uint8_t axis, angle_t encoder, unsigned long dtMs) {
+    (void)f; (void)axis; (void)dtMs;
+    return encoder;
+}
+
+bool fusionLocked(uint8_t axis) { (void)axis; return false; }
+
+#endif // ENABLE_STEP_FUSION
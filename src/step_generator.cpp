@@ -0,0 +1,319 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Générateur d'impulsions STEP (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: step_generator.cpp
+// Description: ISR TIMER1_COMPA / TIMER3_COMPA, bascule STEP,
+//              comptage des pas, changements au front descendant
+// ════════════════════════════════════════════════════════════════
+
+#include "step_generator.h"
+
+#if STEP_GENERATOR_ACTIVE || defined(NATIVE_HAL)
+
+// Axes pilotés. HAL native: les deux (banc --bench-steps), les timers
+// émulés ne partagent rien avec les PWM DC
+#if defined(NATIVE_HAL)
+  #define STEP_USE_AZ  1
+  #define STEP_USE_EL  1
+#else
+  #define STEP_USE_AZ  (MOTOR_AZ_TYPE == MOTOR_STEPPER)
+  #define STEP_USE_EL  (MOTOR_EL_TYPE == MOTOR_STEPPER)
+#endif
+
+static const bool axisUsed[2] = { STEP_USE_AZ, STEP_USE_EL };
+
+// ════════════════════════════════════════════════════════════════
+// ÉTAT PARTAGÉ AVEC LES ISR
+// ════════════════════════════════════════════════════════════════
+
+struct StepChannel {
+    uint8_t stepPin;
+    uint8_t dirPin;
+#if defined(__AVR__)
+    volatile uint8_t *stepOut;
+    volatile uint8_t *dirOut;
+    uint8_t stepMask;
+    uint8_t dirMask;
+#endif
+    volatile uint16_t ticks;          // Demi-période appliquée (ticks 0.5 µs)
+    volatile uint16_t pendingTicks;   // Demandée par loop(), 0 = arrêt
+    volatile int8_t dir;              // Sens appliqué (+1 / -1)
+    volatile int8_t pendingDir;
+    volatile bool high;               // Niveau courant de STEP
+    volatile bool running;            // Timer actif
+    volatile long position;           // Pas émis (signé)
+    long rate;                        // Dernière vitesse demandée (loop seule)
+};
+
+static StepChannel channels[2];
+
+// ════════════════════════════════════════════════════════════════
+// SORTIES STEP / DIR
+// ════════════════════════════════════════════════════════════════
+// Registre de port résolu une fois (une écriture par front dans l'ISR).
+// Hors AVR: digitalWrite (front horodaté par la HAL).
+
+#if defined(__AVR__)
+static inline void writeStep(StepChannel &c, uint8_t level) {
+    if (level) *c.stepOut |= c.stepMask;
+    else *c.stepOut &= ~c.stepMask;
+}
+
+static inline void writeDir(StepChannel &c) {
+    if (c.dir > 0) *c.dirOut |= c.dirMask;
+    else *c.dirOut &= ~c.dirMask;
+}
+#else
+static inline void writeStep(StepChannel &c, uint8_t level) {
+    digitalWrite(c.stepPin, level);
+}
+
+static inline void writeDir(StepChannel &c) {
+    digitalWrite(c.dirPin, (c.dir > 0) ? HIGH : LOW);
+}
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// TIMERS (appelés interruptions coupées ou depuis l'ISR)
+// ════════════════════════════════════════════════════════════════
+
+#if defined(__AVR__)
+
+static void timerStart(uint8_t axis, uint16_t ticks) {
+    if (axis == STEP_AXIS_AZ) {
+        TCCR1B = 0;
+        TCNT1 = 0;
+        OCR1A = ticks - 1;
+        TIFR1 = _BV(OCF1A);
+        TIMSK1 |= _BV(OCIE1A);
+        TCCR1B = _BV(WGM12) | _BV(CS11);    // CTC, /8
+    } else {
+        TCCR3B = 0;
+        TCNT3 = 0;
+        OCR3A = ticks - 1;
+        TIFR3 = _BV(OCF3A);
+        TIMSK3 |= _BV(OCIE3A);
+        TCCR3B = _BV(WGM32) | _BV(CS31);
+    }
+}
+
+static void timerStop(uint8_t axis) {
+    if (axis == STEP_AXIS_AZ) {
+        TCCR1B = 0;
+        TIMSK1 &= ~_BV(OCIE1A);
+    } else {
+        TCCR3B = 0;
+        TIMSK3 &= ~_BV(OCIE3A);
+    }
+}
+
+// Dans l'ISR: TCNT vient de repasser à 0, la nouvelle valeur vaut
+// pour la demi-période en cours (≥ 50 ticks à STEP_RATE_MAX, bien
+// au-delà de la latence ISR)
+static inline void timerSetCompare(uint8_t axis, uint16_t ticks) {
+    if (axis == STEP_AXIS_AZ) OCR1A = ticks - 1;
+    else OCR3A = ticks - 1;
+}
+
+#else
+
+static void stepIsrAz();
+static void stepIsrEl();
+
+static void timerStart(uint8_t axis, uint16_t ticks) {
+    if (axis == STEP_AXIS_AZ) halTimerStart(1, ticks, stepIsrAz);
+    else halTimerStart(3, ticks, stepIsrEl);
+}
+
+static void timerStop(uint8_t axis) {
+    halTimerStop(axis == STEP_AXIS_AZ ? 1 : 3);
+}
+
+static inline void timerSetCompare(uint8_t axis, uint16_t ticks) {
+    halTimerSetCompare(axis == STEP_AXIS_AZ ? 1 : 3, ticks);
+}
+
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// ISR
+// ════════════════════════════════════════════════════════════════
+
+static inline void stepTick(StepChannel &c, uint8_t axis) {
+    if (!c.high) {
+        // Arrêt demandé STEP bas: aucun pas de plus
+        if (c.pendingTicks == 0) {
+            timerStop(axis);
+            c.running = false;
+            return;
+        }
+        writeStep(c, HIGH);
+        c.high = true;
+        c.position += c.dir;
+        return;
+    }
+
+    writeStep(c, LOW);
+    c.high = false;
+
+    // Changements au front descendant: DIR stable une demi-période
+    // avant le pas suivant
+    if (c.pendingTicks == 0) {
+        timerStop(axis);
+        c.running = false;
+        return;
+    }
+    if (c.pendingDir != c.dir) {
+        c.dir = c.pendingDir;
+        writeDir(c);
+    }
+    if (c.pendingTicks != c.ticks) {
+        c.ticks = c.pendingTicks;
+        timerSetCompare(axis, c.ticks);
+    }
+}
+
+#if defined(__AVR__)
+  #if STEP_USE_AZ
+    ISR(TIMER1_COMPA_vect) { stepTick(channels[STEP_AXIS_AZ], STEP_AXIS_AZ); }
+  #endif
+  #if STEP_USE_EL
+    ISR(TIMER3_COMPA_vect) { stepTick(channels[STEP_AXIS_EL], STEP_AXIS_EL); }
+  #endif
+#else
+static void stepIsrAz() { stepTick(channels[STEP_AXIS_AZ], STEP_AXIS_AZ); }
+static void stepIsrEl() { stepTick(channels[STEP_AXIS_EL], STEP_AXIS_EL); }
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// INITIALISATION
+// ════════════════════════════════════════════════════════════════
+
+static void setupChannel(uint8_t axis, uint8_t stepPin, uint8_t dirPin) {
+    StepChannel &c = channels[axis];
+    c.stepPin = stepPin;
+    c.dirPin = dirPin;
+    #if defined(__AVR__)
+        c.stepOut = portOutputRegister(digitalPinToPort(stepPin));
+        c.dirOut = portOutputRegister(digitalPinToPort(dirPin));
+        c.stepMask = digitalPinToBitMask(stepPin);
+        c.dirMask = digitalPinToBitMask(dirPin);
+    #endif
+
+    pinMode(stepPin, OUTPUT);
+    pinMode(dirPin, OUTPUT);
+    digitalWrite(stepPin, LOW);
+    digitalWrite(dirPin, LOW);
+
+    noInterrupts();
+    timerStop(axis);
+    c.ticks = 0;
+    c.pendingTicks = 0;
+    c.dir = -1;
+    c.pendingDir = -1;
+    c.high = false;
+    c.running = false;
+    c.position = 0;
+    c.rate = 0;
+    interrupts();
+}
+
+void setupStepGenerator() {
+    #if defined(__AVR__)
+        // Timers 1 et 3 réglés en PWM par le core Arduino: mode normal
+        #if STEP_USE_AZ
+            TCCR1A = 0;
+        #endif
+        #if STEP_USE_EL
+            TCCR3A = 0;
+        #endif
+    #endif
+
+    #if STEP_USE_AZ
+        setupChannel(STEP_AXIS_AZ, AZ_STEP, AZ_DIR);
+    #endif
+    #if STEP_USE_EL
+        setupChannel(STEP_AXIS_EL, EL_STEP, EL_DIR);
+    #endif
+
+    #if DEBUG_SERIAL
+        Serial.print(F("Générateur STEP: Timer1/Timer3, "));
+        Serial.print(STEP_RATE_MIN);
+        Serial.print(F(" à "));
+        Serial.print(STEP_RATE_MAX);
+        Serial.println(F(" pas/s"));
+    #endif
+}
+
+// ════════════════════════════════════════════════════════════════
+// COMMANDE
+// ════════════════════════════════════════════════════════════════
+
+void setStepRate(uint8_t axis, long stepsPerSec) {
+    if (axis > STEP_AXIS_EL || !axisUsed[axis]) return;
+    StepChannel &c = channels[axis];
+
+    long speed = labs(stepsPerSec);
+    if (speed < STEP_RATE_MIN) speed = 0;
+    else if (speed > STEP_RATE_MAX) speed = STEP_RATE_MAX;
+
+    int8_t dir = (stepsPerSec < 0) ? -1 : 1;
+    uint16_t ticks = (speed > 0) ? (uint16_t)((STEP_TIMER_HZ / 2 + speed / 2) / speed) : 0;
+    c.rate = dir * speed;
+
+    // Registres 16 bits (registre TEMP commun) et état partagé: atomique
+    noInterrupts();
+    c.pendingTicks = ticks;
+    c.pendingDir = dir;
+    if (!c.running && ticks != 0) {
+        c.dir = dir;
+        c.ticks = ticks;
+        c.high = false;
+        c.running = true;
+        writeDir(c);
+        timerStart(axis, ticks);
+    }
+    interrupts();
+}
+
+void stopStepGenerators() {
+    setStepRate(STEP_AXIS_AZ, 0);
+    setStepRate(STEP_AXIS_EL, 0);
+}
+
+// ════════════════════════════════════════════════════════════════
+// ACCESSEURS
+// ════════════════════════════════════════════════════════════════
+
+long getStepRate(uint8_t axis) {
+    if (axis > STEP_AXIS_EL) return 0;
+    return channels[axis].rate;
+}
+
+bool stepGeneratorRunning(uint8_t axis) {
+    if (axis > STEP_AXIS_EL) return false;
+    return channels[axis].running;
+}
+
+long getStepPosition(uint8_t axis) {
+    if (axis > STEP_AXIS_EL) return 0;
+    noInterrupts();
+    long position = channels[axis].position;
+    interrupts();
+    return position;
+}
+
+#else
+
+// ════════════════════════════════════════════════════════════════
+// STUBS (Nano ou rafales delayMicroseconds)
+// ════════════════════════════════════════════════════════════════
+
+void setupStepGenerator() {}
+void setStepRate(uint8_t axis, long stepsPerSec) { (void)axis; (void)stepsPerSec; }
+void stopStepGenerators() {}
+long getStepRate(uint8_t axis) { (void)axis; return 0; }
+bool stepGeneratorRunning(uint8_t axis) { (void)axis; return false; }
+long getStepPosition(uint8_t axis) { (void)axis; return 0; }
+
+#endif // STEP_GENERATOR_ACTIVE || NATIVE_HAL
@@ -0,0 +1,67 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Recherche dans les tables de correction (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: table_lookup.cpp
+// Description: Segment mémorisé, dichotomie, interpolation Q16
+// ════════════════════════════════════════════════════════════════
+
+#include "table_lookup.h"
+#include "adc_sampler.h"        // Pour POT_FINE_BITS
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS INTERNES
+// ════════════════════════════════════════════════════════════════
+
+static bool inSegment(const TableLookup &t, uint8_t seg, long adc) {
+    // Premier / dernier segment ouverts vers l'extérieur (extrapolation)
+    if (seg > 0 && adc < t.adc[seg]) return false;
+    if (seg < t.points - 2 && adc >= t.adc[seg + 1]) return false;
+    return true;
+}
+
+static uint8_t findSegment(const TableLookup &t, long adc) {
+    // Segment précédent puis voisins: cas courant en poursuite
+    uint8_t hint = t.hint;
+    if (inSegment(t, hint, adc)) return hint;
+    if (hint + 1 < t.points - 1 && inSegment(t, hint + 1, adc)) return hint + 1;
+    if (hint > 0 && inSegment(t, hint - 1, adc)) return hint - 1;
+
+    // Dichotomie: dernier point ≤ adc, borné aux segments existants
+    uint8_t low = 0;
+    uint8_t high = t.points - 2;
+    while (low < high) {
+        uint8_t mid = (uint8_t)((low + high + 1) / 2);
+        if (t.adc[mid] <= adc) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return low;
+}
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+void tableLookupRebuild(TableLookup &table) {
+    for (uint8_t i = 0; i + 1 < table.points; i++) {
+        long width = (table.adc[i + 1] - table.adc[i]) * (1L << POT_FINE_BITS);
+        table.slope[i] = (width != 0)
+            ? (long)(((int64_t)table.stepMdeg << TABLE_SLOPE_SHIFT) / width)
+            : 0;
+    }
+    if (table.hint > table.points - 2) table.hint = 0;
+}
+
+angle_t tableLookupMdeg(TableLookup &table, long fine) {
+    long adc = fine >> POT_FINE_BITS;
+    uint8_t seg = findSegment(table, adc);
+    table.hint = seg;
+
+    long offset = fine - table.adc[seg] * (1L << POT_FINE_BITS);
+    angle_t base = table.startMdeg + (angle_t)seg * table.stepMdeg;
+
+    // Produit 64 bits: extrapolation loin de la table sans débordement
+    return base + (angle_t)(((int64_t)offset * table.slope[seg]) >> TABLE_SLOPE_SHIFT);
+}
@@ -0,0 +1,280 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Balayage automatique des tables (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: table_sweep.cpp
+// Description: Balayage à vitesse constante, régression locale par
+//              point, remplacement de la table en fin de course
+// ════════════════════════════════════════════════════════════════
+
+#include "table_sweep.h"
+
+#if TABLE_SWEEP_AZ || TABLE_SWEEP_EL
+
+#include "adc_sampler.h"
+#include "encoder_ssi.h"
+#include "motor_nano.h"
+#include "network.h"
+
+#define SWEEP_MAX_POINTS  (AZ_TABLE_POINTS > EL_TABLE_POINTS ? AZ_TABLE_POINTS : EL_TABLE_POINTS)
+
+// ════════════════════════════════════════════════════════════════
+// VARIABLES
+// ════════════════════════════════════════════════════════════════
+
+static bool running = false;
+static uint8_t sweepAxis = SWEEP_AXIS_AZ;
+
+// Géométrie de la table balayée
+static uint8_t points = 0;
+static int firstDeg = 0;            // Angle du point 0
+static int stepDeg = 0;
+
+// Référence: angle(t) = startDeg + rateDps × (t - startMs)
+static float startDeg = 0.0;
+static float rateDps = 0.0;         // Vitesse exacte des pas commandés
+static int16_t velUnits = 0;        // Trame VEL (1/16 step/s)
+static unsigned long startMs = 0;
+static unsigned long lastSampleMs = 0;
+
+// Table en cours (LSB 10 bits), points ajustés
+static long table[SWEEP_MAX_POINTS];
+static bool fitted[SWEEP_MAX_POINTS];
+static uint8_t fittedCount = 0;
+
+// Fenêtre de régression ouverte (x = angle - point, y = ADC - y0)
+static int8_t window = -1;
+static unsigned int n = 0;
+static long y0Fine = 0;
+static float sx, sy, sxx, sxy, xMin, xMax;
+
+// ════════════════════════════════════════════════════════════════
+// RÉGRESSION PAR POINT
+// ════════════════════════════════════════════════════════════════
+
+static void closeWindow() {
+    if (window < 0) return;
+
+    // Couverture suffisante pour extrapoler jusqu'au point (bords)
+    if (n >= SWEEP_MIN_SAMPLES && xMax - xMin >= stepDeg * 0.25) {
+        float denom = n * sxx - sx * sx;
+        float b = (sy * sxx - sx * sxy) / denom;
+        table[window] = lround((float)y0Fine / (1 << POT_FINE_BITS) + b);
+        fitted[window] = true;
+        fittedCount++;
+    }
+    window = -1;
+}
+
+static void addSample(float refDeg, long fine) {
+    int idx = (int)lround((refDeg - firstDeg) / stepDeg);
+    if (idx < 0 || idx >= points) {
+        closeWindow();
+        return;
+    }
+
+    if (idx != window) {
+        closeWindow();
+        window = idx;
+        n = 0;
+        y0Fine = fine;
+        sx = sy = sxx = sxy = 0.0;
+        xMin = xMax = refDeg - (firstDeg + idx * stepDeg);
+    }
+
+    float x = refDeg - (firstDeg + idx * stepDeg);
+    float y = (float)(fine - y0Fine) / (1 << POT_FINE_BITS);
+    n++;
+    sx += x;
+    sy += y;
+    sxx += x * x;
+    sxy += x * y;
+    xMin = min(xMin, x);
+    xMax = max(xMax, x);
+}
+
+/**
+ * Points non balayés: interpolés entre voisins ajustés, extrapolés
+ * depuis les deux plus proches aux extrémités
+ * @return false si moins de 2 points ajustés
+ */
+static bool fillMissing() {
+    if (fittedCount < 2) return false;
+
+    for (int i = 0; i < points; i++) {
+        if (fitted[i]) continue;
+
+        int lo = -1, hi = -1;
+        for (int j = i - 1; j >= 0; j--) if (fitted[j]) { lo = j; break; }
+        for (int j = i + 1; j < points; j++) if (fitted[j]) { hi = j; break; }
+
+        // Extrémité: deux voisins du même côté
+        if (lo < 0) {
+            lo = hi;
+            for (int j = hi + 1; j < points; j++) if (fitted[j]) { hi = j; break; }
+        } else if (hi < 0) {
+            hi = lo;
+            for (int j = lo - 1; j >= 0; j--) if (fitted[j]) { lo = j; break; }
+        }
+
+        float slope = (float)(table[hi] - table[lo]) / (hi - lo);
+        table[i] = lround(table[lo] + slope * (i - lo));
+    }
+    return true;
+}
+
+// ════════════════════════════════════════════════════════════════
+// FIN DE BALAYAGE
+// ════════════════════════════════════════════════════════════════
+
+static void finishSweep(bool complete) {
+    running = false;
+    if (currentSpeedMode == NANO_SPEED_SWEEP) sendNanoSweep(0, 0);
+    closeWindow();
+
+    const char *name = (sweepAxis == SWEEP_AXIS_AZ) ? "AZ" : "EL";
+    String line = "SWEEP " + String(name);
+
+    if (!complete || !fillMissing()) {
+        line += complete ? " echec: moins de 2 points ajustes\r\n" : " interrompu, table inchangee\r\n";
+        sendToClient(line);
+        #if DEBUG_SERIAL
+            Serial.print(F("Balayage table ")); Serial.print(name);
+            Serial.println(F(": annulé, table inchangée"));
+        #endif
+        return;
+    }
+
+    #if TABLE_SWEEP_AZ
+        if (sweepAxis == SWEEP_AXIS_AZ) setAzCorrectionTable(table);
+    #endif
+    #if TABLE_SWEEP_EL
+        if (sweepAxis == SWEEP_AXIS_EL) setElCorrectionTable(table);
+    #endif
+
+    line += " termine: " + String(points) + " points, " + String(fittedCount) + " ajustes, ";
+    line += String(points - fittedCount) + " extrapoles\r\n";
+    sendToClient(line);
+
+    #if DEBUG_SERIAL
+        Serial.print(F("Balayage table ")); Serial.print(name);
+        Serial.print(F(": ")); Serial.print(fittedCount);
+        Serial.print(F("/")); Serial.print(points);
+        Serial.println(F(" points ajustés, table sauvegardée"));
+    #endif
+}
+
+// ════════════════════════════════════════════════════════════════
+// DÉMARRAGE
+// ════════════════════════════════════════════════════════════════
+
+bool startTableSweep(uint8_t axis, float realDeg) {
+    if (running) return false;
+
+    float stepsPerDeg = 0.0;
+    bool limit = false;
+
+    if (axis == SWEEP_AXIS_AZ) {
+        #if TABLE_SWEEP_AZ
+            points = AZ_TABLE_POINTS;
+            firstDeg = 0;
+            stepDeg = AZ_TABLE_STEP;
+            stepsPerDeg = NANO_STEPS_PER_DEG_AZ;
+            limit = nanoLimitCW;
+        #else
+            return false;
+        #endif
+    } else {
+        #if TABLE_SWEEP_EL
+            points = EL_TABLE_POINTS;
+            firstDeg = EL_TABLE_START;
+            stepDeg = EL_TABLE_STEP;
+            stepsPerDeg = NANO_STEPS_PER_DEG_EL;
+            limit = nanoLimitUp;
+        #else
+            return false;
+        #endif
+    }
+
+    float endDeg = firstDeg + (points - 1) * stepDeg + stepDeg * 0.5;
+    if (limit || realDeg >= endDeg) return false;
+
+    // Vitesse quantifiée en unités VEL: la référence suit les pas réels
+    velUnits = (int16_t)lround(SWEEP_RATE_DPS * stepsPerDeg * NANO_VEL_SCALE);
+    rateDps = velUnits / (stepsPerDeg * NANO_VEL_SCALE);
+
+    bool sent = (axis == SWEEP_AXIS_AZ) ? sendNanoSweep(velUnits, 0) : sendNanoSweep(0, velUnits);
+    if (!sent) return false;
+
+    running = true;
+    sweepAxis = axis;
+    startDeg = realDeg;
+    startMs = millis();
+    lastSampleMs = lastEncoderReadTime;
+    window = -1;
+    fittedCount = 0;
+    for (int i = 0; i < points; i++) fitted[i] = false;
+
+    String line = "SWEEP " + String(axis == SWEEP_AXIS_AZ ? "AZ" : "EL");
+    line += " depart " + String(realDeg, 1) + " vitesse " + String(rateDps, 3) + "/s\r\n";
+    sendToClient(line);
+    return true;
+}
+
+// ════════════════════════════════════════════════════════════════
+// MISE À JOUR
+// ════════════════════════════════════════════════════════════════
+
+void updateTableSweep() {
+    if (!running) return;
+
+    // Commande manuelle, stopAllMotorsNano() ou perte du Nano
+    if (currentSpeedMode != NANO_SPEED_SWEEP || !nanoConnected) {
+        finishSweep(false);
+        return;
+    }
+
+    bool isAz = (sweepAxis == SWEEP_AXIS_AZ);
+
+    // Nouvelle lecture encodeur: couple (référence, ADC) au même instant
+    if (lastEncoderReadTime != lastSampleMs) {
+        lastSampleMs = lastEncoderReadTime;
+        long elapsed = (long)(lastSampleMs - startMs);
+        if (elapsed >= SWEEP_SETTLE_MS) {
+            addSample(startDeg + rateDps * elapsed * 0.001f, isAz ? accumulatedFineAz : accumulatedFineEl);
+        }
+    }
+
+    float refDeg = startDeg + rateDps * (long)(millis() - startMs) * 0.001f;
+    float endDeg = firstDeg + (points - 1) * stepDeg + stepDeg * 0.5;
+    bool limit = isAz ? nanoLimitCW : nanoLimitUp;
+
+    if (refDeg >= endDeg || limit) {
+        finishSweep(true);
+        return;
+    }
+
+    // Keepalive
+    if (isAz) sendNanoSweep(velUnits, 0);
+    else sendNanoSweep(0, velUnits);
+}
+
+void abortTableSweep() {
+    if (running) finishSweep(false);
+}
+
+bool tableSweepRunning() {
+    return running;
+}
+
+#else
+
+// ════════════════════════════════════════════════════════════════
+// STUBS (balayage indisponible dans cette configuration)
+// ════════════════════════════════════════════════════════════════
+
+bool startTableSweep(uint8_t axis, float startDeg) { (void)axis; (void)startDeg; return false; }
+void updateTableSweep() {}
+void abortTableSweep() {}
+bool tableSweepRunning() { return false; }
+
+#endif // TABLE_SWEEP_AZ || TABLE_SWEEP_EL
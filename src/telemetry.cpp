@@ -0,0 +1,256 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Télémétrie push (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: telemetry.cpp
+// Description: Serveur TCP TELEMETRY_PORT, trames JSON compactes
+// ════════════════════════════════════════════════════════════════
+
+#include "telemetry.h"
+
+#if USE_ETHERNET && ENABLE_TELEMETRY
+
+#include <Ethernet.h>
+#include "easycom.h"        // Pour angleToTenths, formatTenths
+
+#if TEST_MOTORS
+  #if USE_NANO_STEPPER
+    #include "motor_nano.h"     // Pour movingAz/El, nanoLimitxx
+  #elif (MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER)
+    #include "motor_stepper.h"  // Pour movingAz/El
+  #endif
+#endif
+
+#if TEST_LIMITS
+  #include "safety.h"           // Pour limitAzTriggered, limitElTriggered
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// VARIABLES EXTERNES (définies dans autres modules)
+// ════════════════════════════════════════════════════════════════
+
+extern angle_t currentAzMdeg; // encoder_ssi.cpp
+extern angle_t currentElMdeg; // encoder_ssi.cpp
+extern float targetAz;      // motor_stepper.cpp / motor_nano.cpp
+extern float targetEl;      // motor_stepper.cpp / motor_nano.cpp
+
+#if EASYCOM_MAX_CLIENTS + TELEMETRY_MAX_CLIENTS + 2 > MAX_SOCK_NUM
+    #error "Sockets W5500 insuffisantes: EASYCOM_MAX_CLIENTS + TELEMETRY_MAX_CLIENTS + 2 écoutes"
+#endif
+
+// ════════════════════════════════════════════════════════════════
+// ÉTAT
+// ════════════════════════════════════════════════════════════════
+
+#define TELEMETRY_STATE_IDLE    0
+#define TELEMETRY_STATE_MOVING  1
+#define TELEMETRY_STATE_LIMIT   2
+
+// {"t":4294967295,"az":-xxxx.x,...,"state":"moving"}\r\n < 128
+#define TELEMETRY_FRAME_SIZE 128
+
+#define TELEMETRY_THRESHOLD_MDEG  ANGLE_DEG(TELEMETRY_THRESHOLD)
+
+static EthernetServer telemetryServer(TELEMETRY_PORT);
+static EthernetClient subscribers[TELEMETRY_MAX_CLIENTS];
+static bool subscriberActive[TELEMETRY_MAX_CLIENTS];
+
+// Dernière trame émise (base de la détection de changement)
+static angle_t lastAz, lastEl;
+static float lastTargetAz, lastTargetEl;
+static uint8_t lastState = TELEMETRY_STATE_IDLE;
+static unsigned long lastFrameTime = 0;
+static bool frameForced = false;        // Nouvel abonné: trame immédiate
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS INTERNES
+// ════════════════════════════════════════════════════════════════
+
+static uint8_t readState() {
+    #if TEST_MOTORS && USE_NANO_STEPPER
+        if (nanoLimitCW || nanoLimitCCW || nanoLimitUp || nanoLimitDown) return TELEMETRY_STATE_LIMIT;
+    #endif
+    #if TEST_LIMITS
+        if (limitAzTriggered || limitElTriggered) return TELEMETRY_STATE_LIMIT;
+    #endif
+    #if TEST_MOTORS && (USE_NANO_STEPPER || MOTOR_AZ_TYPE == MOTOR_STEPPER || MOTOR_EL_TYPE == MOTOR_STEPPER)
+        if (movingAz || movingEl) return TELEMETRY_STATE_MOVING;
+    #endif
+    return TELEMETRY_STATE_IDLE;
+}
+
+static bool movedBy(float now, float last) {
+    return fabs(now - last) >= TELEMETRY_THRESHOLD;
+}
+
+static bool positionMoved(angle_t now, angle_t last) {
+    return labs(now - last) >= TELEMETRY_THRESHOLD_MDEG;
+}
+
+// Pas de cible: toute valeur négative (-999 Nano/Easycom, -1 pas-à-pas
+// direct et DC), comme l'acceptent tous les modules moteur
+static bool hasTarget(float target) {
+    return target >= 0;
+}
+
+static bool targetChanged(float now, float last) {
+    // Apparition / disparition de cible, ou déplacement ≥ seuil
+    if (hasTarget(now) != hasTarget(last)) return true;
+    return hasTarget(now) && movedBy(now, last);
+}
+
+static char *appendText(char *p, const char *text) {
+    while (*text) *p++ = *text++;
+    return p;
+}
+
+static char *appendAngle(char *p, const char *key, float value, bool valid) {
+    p = appendText(p, key);
+    if (!valid) return appendText(p, "null");
+    return formatTenths(p, angleToTenths(value));
+}
+
+static char *appendPosition(char *p, const char *key, angle_t mdeg) {
+    p = appendText(p, key);
+    return formatTenths(p, mdegToTenths(mdeg));
+}
+
+static uint8_t buildFrame(char *frame, unsigned long now, uint8_t state) {
+    char *p = frame;
+    p = appendText(p, "{\"t\":");
+    ultoa(now, p, 10);
+    p += strlen(p);
+    p = appendPosition(p, ",\"az\":", currentAzMdeg);
+    p = appendPosition(p, ",\"el\":", currentElMdeg);
+    p = appendAngle(p, ",\"target_az\":", targetAz, hasTarget(targetAz));
+    p = appendAngle(p, ",\"target_el\":", targetEl, hasTarget(targetEl));
+    p = appendText(p, ",\"state\":\"");
+    p = appendText(p, state == TELEMETRY_STATE_LIMIT ? "limit" :
+                      state == TELEMETRY_STATE_MOVING ? "moving" : "idle");
+    p = appendText(p, "\"}\r\n");
+    return (uint8_t)(p - frame);
+}
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+void setupTelemetry() {
+    telemetryServer.begin();
+
+    #if DEBUG_NETWORK
+        Serial.print(F("[TLM] Télémétrie port "));
+        Serial.println(TELEMETRY_PORT);
+    #endif
+}
+
+void handleTelemetry() {
+    // ─────────────────────────────────────────────────────────────
+    // ABONNEMENTS
+    // ─────────────────────────────────────────────────────────────
+    EthernetClient newClient = telemetryServer.accept();
+    while (newClient) {
+        bool placed = false;
+        for (uint8_t i = 0; i < TELEMETRY_MAX_CLIENTS && !placed; i++) {
+            if (subscriberActive[i]) continue;
+            subscribers[i] = newClient;
+            subscriberActive[i] = true;
+            frameForced = true;
+            placed = true;
+
+            #if DEBUG_NETWORK
+                Serial.print(F("[TLM] Abonné "));
+                Serial.print(i);
+                Serial.print(F(": "));
+                Serial.println(newClient.remoteIP());
+            #endif
+        }
+        if (!placed) {
+            newClient.stop();
+            #if DEBUG_NETWORK
+                Serial.println(F("[TLM] Abonné rejeté (complet)"));
+            #endif
+        }
+        newClient = telemetryServer.accept();
+    }
+
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+        if (!subscriberActive[i]) continue;
+
+        if (!subscribers[i].connected()) {
+            subscribers[i].stop();
+            subscriberActive[i] = false;
+            #if DEBUG_NETWORK
+                Serial.print(F("[TLM] Abonné "));
+                Serial.print(i);
+                Serial.println(F(" déconnecté"));
+            #endif
+            continue;
+        }
+
+        // Flux sortant uniquement: données reçues ignorées
+        while (subscribers[i].available() > 0) {
+            uint8_t discard[16];
+            subscribers[i].read(discard, sizeof(discard));
+        }
+        count++;
+    }
+
+    if (count == 0) {
+        return;
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // DÉCISION D'ÉMISSION
+    // ─────────────────────────────────────────────────────────────
+    unsigned long now = millis();
+    unsigned long elapsed = now - lastFrameTime;
+    uint8_t state = readState();
+
+    if (!frameForced) {
+        if (elapsed < TELEMETRY_PERIOD_MS) return;
+
+        bool changed = positionMoved(currentAzMdeg, lastAz) || positionMoved(currentElMdeg, lastEl) ||
+                       targetChanged(targetAz, lastTargetAz) ||
+                       targetChanged(targetEl, lastTargetEl) ||
+                       state != lastState;
+        if (!changed && elapsed < TELEMETRY_HEARTBEAT_MS) return;
+    }
+
+    // ─────────────────────────────────────────────────────────────
+    // ÉMISSION: trame formatée une fois, un bloc par abonné
+    // ─────────────────────────────────────────────────────────────
+    char frame[TELEMETRY_FRAME_SIZE];
+    uint8_t len = buildFrame(frame, now, state);
+
+    for (uint8_t i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+        if (!subscriberActive[i]) continue;
+        if (subscribers[i].availableForWrite() < len) continue;   // Abonné lent: trame sautée
+        subscribers[i].write((const uint8_t *)frame, len);
+    }
+
+    lastAz = currentAzMdeg;
+    lastEl = currentElMdeg;
+    lastTargetAz = targetAz;
+    lastTargetEl = targetEl;
+    lastState = state;
+    lastFrameTime = now;
+    frameForced = false;
+}
+
+uint8_t getTelemetryClientCount() {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < TELEMETRY_MAX_CLIENTS; i++) {
+        if (subscriberActive[i] && subscribers[i].connected()) count++;
+    }
+    return count;
+}
+
+#else
+
+// Télémétrie désactivée (ou mode Serial): fonctions vides
+void setupTelemetry() {}
+void handleTelemetry() {}
+uint8_t getTelemetryClientCount() { return 0; }
+
+#endif // USE_ETHERNET && ENABLE_TELEMETRY
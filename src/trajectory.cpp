@@ -0,0 +1,207 @@
+// ════════════════════════════════════════════════════════════════
+// EME ROTATOR CONTROLLER - Prédicteur de trajectoire (Implementation)
+// ════════════════════════════════════════════════════════════════
+// Fichier: trajectory.cpp
+// Description: Régression linéaire sur les dernières consignes
+// ════════════════════════════════════════════════════════════════
+
+#include "trajectory.h"
+
+#if ENABLE_TRAJECTORY
+
+#include "network.h"        // Pour sendToClient
+
+// ════════════════════════════════════════════════════════════════
+// ÉTAT PAR AXE
+// ════════════════════════════════════════════════════════════════
+
+struct TrajectoryAxis {
+    unsigned long time[TRAJ_HISTORY];   // millis() de réception
+    float value[TRAJ_HISTORY];          // Consignes (°)
+    uint8_t count;                      // Consignes en mémoire
+    uint8_t head;                       // Prochaine case écrite
+
+    bool tracking;                      // Vitesse estimée valide
+    angle_t fitPosition;                // Position ajustée à fitTime
+    unsigned long fitTime;              // millis() de la dernière consigne
+    long rateQ16;                       // Vitesse estimée (mdeg/ms = °/s, Q16)
+
+    unsigned long errCount;             // Statistiques de poursuite (mdeg)
+    uint64_t errSumSq;
+    uint16_t errMax;
+};
+
+static TrajectoryAxis axes[2];
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS INTERNES
+// ════════════════════════════════════════════════════════════════
+
+static uint8_t sampleIndex(const TrajectoryAxis &a, uint8_t age) {
+    // age 0 = consigne la plus récente
+    return (uint8_t)((a.head + TRAJ_HISTORY - 1 - age) % TRAJ_HISTORY);
+}
+
+static void clearHistory(TrajectoryAxis &a) {
+    a.count = 0;
+    a.head = 0;
+    a.tracking = false;
+    a.rateQ16 = 0;
+}
+
+static angle_t predictAt(const TrajectoryAxis &a, unsigned long now) {
+    // Au-delà de TRAJ_TIMEOUT_MS la poursuite est abandonnée: produit
+    // borné à 0.05°/s × 15 s en Q16, tient sur 32 bits
+    unsigned long dt = min(now - a.fitTime, (unsigned long)TRAJ_TIMEOUT_MS);
+    return a.fitPosition + ((a.rateQ16 * (long)dt) >> 16);
+}
+
+/**
+ * Droite des moindres carrés sur l'historique
+ * Temps et valeurs relatifs à la dernière consigne (précision float)
+ * Calcul float à la réception d'une consigne seulement; le résultat
+ * est stocké en virgule fixe pour predictAt()
+ */
+static void refit(TrajectoryAxis &a) {
+    uint8_t newest = sampleIndex(a, 0);
+    a.fitTime = a.time[newest];
+    a.fitPosition = angleFromDegrees(a.value[newest]);
+    a.rateQ16 = 0;
+    a.tracking = false;
+
+    if (a.count < TRAJ_MIN_SAMPLES) return;
+
+    float sumT = 0, sumV = 0, sumTT = 0, sumTV = 0;
+    for (uint8_t age = 0; age < a.count; age++) {
+        uint8_t i = sampleIndex(a, age);
+        float t = -(float)(a.fitTime - a.time[i]) / 1000.0;
+        float v = a.value[i] - a.value[newest];
+        sumT += t;
+        sumV += v;
+        sumTT += t * t;
+        sumTV += t * v;
+    }
+
+    float n = (float)a.count;
+    float den = n * sumTT - sumT * sumT;
+    if (den <= 0.0) return;             // Consignes simultanées
+
+    float rate = (n * sumTV - sumT * sumV) / den;
+    if (abs(rate) > TRAJ_MAX_RATE_DPS) return;
+
+    // Position de la droite à l'instant de la dernière consigne
+    float meanT = sumT / n;
+    float meanV = sumV / n;
+    a.fitPosition = angleFromDegrees(a.value[newest] + meanV - rate * meanT);
+    a.rateQ16 = lround(rate * 65536.0);
+    a.tracking = true;
+}
+
+// ════════════════════════════════════════════════════════════════
+// FONCTIONS PUBLIQUES
+// ════════════════════════════════════════════════════════════════
+
+void trajectorySetpoint(uint8_t axis, float value) {
+    TrajectoryAxis &a = axes[axis];
+    unsigned long now = millis();
+
+    if (a.count > 0) {
+        unsigned long silence = now - a.time[sampleIndex(a, 0)];
+        float predicted = a.tracking ? angleToDegrees(predictAt(a, now)) : a.value[sampleIndex(a, 0)];
+
+        // Ralliement ou reprise après silence: nouvelle trajectoire
+        if (silence > TRAJ_TIMEOUT_MS || abs(value - predicted) > TRAJ_JUMP_DEG) {
+            clearHistory(a);
+        }
+    }
+
+    a.time[a.head] = now;
+    a.value[a.head] = value;
+    a.head = (a.head + 1) % TRAJ_HISTORY;
+    if (a.count < TRAJ_HISTORY) a.count++;
+
+    // Oubli des consignes hors fenêtre
+    while (a.count > 1 && now - a.time[sampleIndex(a, a.count - 1)] > TRAJ_WINDOW_MS) {
+        a.count--;
+    }
+
+    refit(a);
+}
+
+void trajectoryReset() {
+    clearHistory(axes[TRAJ_AZ]);
+    clearHistory(axes[TRAJ_EL]);
+}
+
+bool trajectoryTarget(uint8_t axis, angle_t &position, long &rate) {
+    TrajectoryAxis &a = axes[axis];
+    unsigned long now = millis();
+
+    if (a.tracking && now - a.fitTime > TRAJ_TIMEOUT_MS) {
+        // Plus de consigne: arrêt de l'extrapolation
+        clearHistory(a);
+    }
+
+    if (!a.tracking) {
+        rate = 0;
+        return false;
+    }
+
+    position = predictAt(a, now);
+    rate = (a.rateQ16 * 1000L) >> 16;   // mdeg/s
+    return true;
+}
+
+void trajectoryRecordError(uint8_t axis, angle_t error) {
+    TrajectoryAxis &a = axes[axis];
+    // Erreur bornée à 65.535°: carré sur 32 bits (16 × 16)
+    uint16_t e = (uint16_t)min(labs(error), 65535L);
+    a.errCount++;
+    a.errSumSq += (uint32_t)e * e;
+    if (e > a.errMax) a.errMax = e;
+}
+
+void trajectoryClearStats() {
+    for (uint8_t i = 0; i < 2; i++) {
+        axes[i].errCount = 0;
+        axes[i].errSumSq = 0;
+        axes[i].errMax = 0;
+    }
+}
+
+void printTrajectoryReport() {
+    sendToClient("\r\n");
+    sendToClient("=== POURSUITE (deg) ===\r\n");
+
+    for (uint8_t i = 0; i < 2; i++) {
+        const TrajectoryAxis &a = axes[i];
+        String line = (i == TRAJ_AZ) ? "AZ " : "EL ";
+        line += a.tracking ? "suivi " : "fixe  ";
+        line += "vit=" + String(a.rateQ16 * 60.0 / 65536.0, 3) + "/min ";
+        line += "cons=" + String(a.count) + " ";
+        line += "n=" + String(a.errCount);
+        if (a.errCount > 0) {
+            line += " rms=" + String(sqrt((double)a.errSumSq / a.errCount) / 1000.0, 3);
+            line += " max=" + String(a.errMax / 1000.0, 3);
+        }
+        line += "\r\n";
+        sendToClient(line);
+    }
+}
+
+#else
+
+// Prédicteur désactivé: consigne fixe
+void trajectorySetpoint(uint8_t axis, float value) { (void)axis; (void)value; }
+void trajectoryReset() {}
+bool trajectoryTarget(uint8_t axis, angle_t &position, long &rate) {
+    (void)axis;
+    (void)position;
+    rate = 0;
+    return false;
+}
+void trajectoryRecordError(uint8_t axis, angle_t error) { (void)axis; (void)error; }
+void printTrajectoryReport() {}
+void trajectoryClearStats() {}
+
+#endif // ENABLE_TRAJECTORY